@@ -336,6 +336,7 @@ struct Analyser::AnalyserImpl
     std::vector<AnalyserExternalVariablePtr> mExternalVariables;
 
     std::vector<AnalyserInternalVariablePtr> mInternalVariables;
+    std::map<size_t, AnalyserInternalVariablePtr> mEquivalenceClassInternalVariables;
     std::vector<AnalyserInternalEquationPtr> mInternalEquations;
 
     explicit AnalyserImpl(Analyser *analyser);
@@ -486,27 +487,28 @@ AnalyserInternalVariablePtr Analyser::AnalyserImpl::internalVariable(const Varia
     // Find and return, if there is one, the internal variable associated with
     // the given variable.
 
-    AnalyserInternalVariablePtr res = nullptr;
+    // Note: all the variables that are equivalent to one another share the
+    //       same internal variable, so we can look it up using their
+    //       equivalence class.
 
-    for (const auto &internalVariable : mInternalVariables) {
-        if (mModel->areEquivalentVariables(variable, internalVariable->mVariable)) {
-            res = internalVariable;
+    auto equivalenceClass = mModel->mPimpl->equivalenceClass(variable);
+    auto internalVariable = mEquivalenceClassInternalVariables.find(equivalenceClass);
 
-            break;
-        }
-    }
-
-    if (res != nullptr) {
-        return res;
+    if (internalVariable != mEquivalenceClassInternalVariables.end()) {
+        return internalVariable->second;
     }
 
     // No internal variable exists for the given variable, so create one, track
     // it and return it.
 
-    res = std::shared_ptr<AnalyserInternalVariable> {new AnalyserInternalVariable {variable}};
+    auto res = std::shared_ptr<AnalyserInternalVariable> {new AnalyserInternalVariable {variable}};
 
     mInternalVariables.push_back(res);
 
+    if (equivalenceClass != AnalyserModel::AnalyserModelImpl::UNKNOWN_EQUIVALENCE_CLASS) {
+        mEquivalenceClassInternalVariables[equivalenceClass] = res;
+    }
+
     return res;
 }
 
@@ -1255,7 +1257,10 @@ void Analyser::AnalyserImpl::analyseModel(const ModelPtr &model)
 
     mModel = std::shared_ptr<AnalyserModel> {new AnalyserModel {}};
 
+    mModel->mPimpl->mModel = model;
+
     mInternalVariables.clear();
+    mEquivalenceClassInternalVariables.clear();
     mInternalEquations.clear();
 
     // Recursively analyse the model's components, so that we end up with an AST
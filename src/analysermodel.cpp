@@ -16,7 +16,11 @@ limitations under the License.
 
 #include "libcellml/analysermodel.h"
 
+#include "libcellml/component.h"
+#include "libcellml/model.h"
+
 #include "analysermodel_p.h"
+#include "namedentity_p.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -358,39 +362,109 @@ bool AnalyserModel::needAcothFunction() const
     return mPimpl->mNeedAcothFunction;
 }
 
+void AnalyserModel::AnalyserModelImpl::indexEquivalenceClasses(const ComponentPtr &component,
+                                                               size_t &equivalenceClassCount)
+{
+    // Give a new class to each variable of the given component that has not
+    // yet been indexed and to all the variables to which it is (directly or
+    // indirectly) equivalent, i.e. to all the variables in its connected set.
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+
+        if (mEquivalenceClasses.find(variable.get()) != mEquivalenceClasses.end()) {
+            continue;
+        }
+
+        auto equivalenceClass = equivalenceClassCount++;
+        std::vector<VariablePtr> variables = {variable};
+
+        mEquivalenceClasses[variable.get()] = {variable, equivalenceClass};
+
+        while (!variables.empty()) {
+            auto currentVariable = variables.back();
+
+            variables.pop_back();
+
+            for (size_t j = 0; j < currentVariable->equivalentVariableCount(); ++j) {
+                auto equivalentVariable = currentVariable->equivalentVariable(j);
+
+                if ((equivalentVariable != nullptr)
+                    && mEquivalenceClasses.emplace(equivalentVariable.get(), EquivalenceClassEntry {equivalentVariable, equivalenceClass}).second) {
+                    variables.push_back(equivalentVariable);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        indexEquivalenceClasses(component->component(i), equivalenceClassCount);
+    }
+}
+
+size_t AnalyserModel::AnalyserModelImpl::equivalenceClass(const VariablePtr &variable)
+{
+    // Our index covers all the variables of our model and it is only valid for
+    // as long as no equivalence has been added to or removed from our model,
+    // and no component has been added to, removed from or moved within our
+    // model, since it was built, i.e. for as long as the equivalence revision
+    // of our model is the one for which it was built.
+
+    auto model = mModel.lock();
+
+    if (model == nullptr) {
+        return UNKNOWN_EQUIVALENCE_CLASS;
+    }
+
+    mEquivalenceClassesRevision.update(equivalenceRevision(model.get()), [&]() {
+        size_t equivalenceClassCount = 0;
+
+        mEquivalenceClasses.clear();
+
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            indexEquivalenceClasses(model->component(i), equivalenceClassCount);
+        }
+    });
+
+    auto entry = mEquivalenceClasses.find(variable.get());
+
+    if ((entry != mEquivalenceClasses.end())
+        && (entry->second.mVariable.lock() == variable)) {
+        return entry->second.mClass;
+    }
+
+    return UNKNOWN_EQUIVALENCE_CLASS;
+}
+
 bool AnalyserModel::areEquivalentVariables(const VariablePtr &variable1,
                                            const VariablePtr &variable2)
 {
-    // This is a cached version of the areEquivalentVariables() utility. Indeed,
-    // an AnalyserModel object refers to a static version of a model, which
-    // means that we can safely cache the result of a call to that utility. In
-    // turn, this means that we can speed up any feature (e.g., code generation)
-    // that also relies on that utility. When it comes to the key for the cache,
-    // we use the Cantor pairing function with the address of the two variables
-    // as parameters, thus ensuring the uniqueness of the key (see
-    // https://en.wikipedia.org/wiki/Pairing_function#Cantor_pairing_function).
+    // Rather than testing the equivalence of two variables by traversing their
+    // equivalences, we compare the equivalence classes to which they belong,
+    // which is a constant-time lookup once the equivalence classes of our model
+    // have been indexed.
 
-    auto v1 = reinterpret_cast<uintptr_t>(variable1.get());
-    auto v2 = reinterpret_cast<uintptr_t>(variable2.get());
+    if ((variable1 == nullptr) || (variable2 == nullptr)) {
+        return variable1 == variable2;
+    }
 
-    if (v2 < v1) {
-        v1 += v2;
-        v2 = v1 - v2;
-        v1 = v1 - v2;
+    if (variable1 == variable2) {
+        return true;
     }
 
-    auto key = ((v1 + v2) * (v1 + v2 + 1) >> 1U) + v2;
-    auto cacheKey = mPimpl->mCachedEquivalentVariables.find(key);
+    auto equivalenceClass1 = mPimpl->equivalenceClass(variable1);
+    auto equivalenceClass2 = mPimpl->equivalenceClass(variable2);
 
-    if (cacheKey != mPimpl->mCachedEquivalentVariables.end()) {
-        return cacheKey->second;
+    if ((equivalenceClass1 != AnalyserModelImpl::UNKNOWN_EQUIVALENCE_CLASS)
+        && (equivalenceClass2 != AnalyserModelImpl::UNKNOWN_EQUIVALENCE_CLASS)) {
+        return equivalenceClass1 == equivalenceClass2;
     }
 
-    bool res = libcellml::areEquivalentVariables(variable1, variable2);
-
-    mPimpl->mCachedEquivalentVariables[key] = res;
+    // At least one of the variables is not part of the analysed model (or that
+    // model no longer exists), so fall back to traversing the equivalences of
+    // the variables.
 
-    return res;
+    return libcellml::areEquivalentVariables(variable1, variable2);
 }
 
 } // namespace libcellml
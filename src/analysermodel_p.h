@@ -16,6 +16,12 @@ limitations under the License.
 
 #include "libcellml/analysermodel.h"
 
+#include <limits>
+#include <unordered_map>
+
+#include "internaltypes.h"
+#include "utilities.h"
+
 namespace libcellml {
 
 /**
@@ -61,7 +67,28 @@ struct AnalyserModel::AnalyserModelImpl
     bool mNeedAcschFunction = false;
     bool mNeedAcothFunction = false;
 
-    std::map<uintptr_t, bool> mCachedEquivalentVariables;
+    /**
+     * @brief An entry of the equivalence class index.
+     *
+     * The variable is tracked through a weak pointer, so that we can detect
+     * that an entry refers to a variable that no longer exists, even if its
+     * address has since been reused by another variable.
+     */
+    struct EquivalenceClassEntry
+    {
+        VariableWeakPtr mVariable;
+        size_t mClass = 0;
+    };
+
+    static constexpr size_t UNKNOWN_EQUIVALENCE_CLASS = std::numeric_limits<size_t>::max();
+
+    ModelWeakPtr mModel;
+
+    IndexRevision mEquivalenceClassesRevision;
+    std::unordered_map<const Variable *, EquivalenceClassEntry> mEquivalenceClasses;
+
+    void indexEquivalenceClasses(const ComponentPtr &component, size_t &equivalenceClassCount);
+    size_t equivalenceClass(const VariablePtr &variable);
 };
 
 } // namespace libcellml
@@ -479,14 +479,14 @@ public:
      * Returns @c true if @p variable1 is equivalent to @p variable2 and
      * @c false otherwise.
      *
-     * To test for equivalence is time consuming, so caching is used to speed
-     * things up. During the analysis of a model, various tests are performed
-     * and their result cached. So, if you test two variables that were tested
-     * during the analysis then the cached result will be returned otherwise the
-     * two variables will be properly tested and their result cached. This works
-     * because an @c AnalyserModel always refers to a static version of a
-     * @c Model. However, this might break if a @c Model is modified after it
-     * has been analysed.
+     * To test for equivalence is time consuming, so an index is used to speed
+     * things up. The first time two variables are tested, each variable of the
+     * analysed model and all the variables to which it is equivalent are given
+     * the same equivalence class, after which any test only needs to compare
+     * the equivalence class of the two variables. The index is automatically
+     * rebuilt if an equivalence is added to or removed from the analysed
+     * model, e.g. using @ref Variable::addEquivalence or
+     * @ref Variable::removeEquivalence.
      *
      * @param variable1 The @c Variable to test if it is equivalent to
      * @p variable2.
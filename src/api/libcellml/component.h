@@ -16,6 +16,8 @@ limitations under the License.
 
 #pragma once
 
+#include <vector>
+
 #include "libcellml/componententity.h"
 #include "libcellml/exportdefinitions.h"
 #include "libcellml/importedentity.h"
@@ -105,7 +107,7 @@ public:
      *
      * @return @c std::string math for this component.
      */
-    std::string math() const;
+    const std::string &math() const;
 
     /**
      * @brief Set the math string for this component.
@@ -117,6 +119,19 @@ public:
      */
     void setMath(const std::string &math);
 
+    /**
+     * @overload
+     *
+     * @brief Set the math string for this component.
+     *
+     * Sets the math string for this component, moving @p math rather than
+     * copying it. If @p math is an empty string, math will be removed from
+     * the component.
+     *
+     * @param math The @c std::string to move for this component.
+     */
+    void setMath(std::string &&math);
+
     /**
      * @brief Clear the math from this component.
      *
@@ -143,6 +158,38 @@ public:
      */
     bool addVariable(const VariablePtr &variable);
 
+    /**
+     * @brief Add several variables by reference as part of this component.
+     *
+     * Add the given variables by reference to the component, in the given
+     * order. This gives the same result as calling @ref addVariable for each
+     * of the @p variables, but it is faster when adding many variables since
+     * the check for variables that already exist in this component is only
+     * done once for all of them.
+     *
+     * A variable is skipped if it is the @c nullptr or if its reference
+     * already exists in this component (including earlier in @p variables).
+     *
+     * @sa addVariable, reserveVariables
+     *
+     * @param variables The variables to add.
+     *
+     * @return @c true if all the variables are added or @c false otherwise.
+     */
+    bool addVariables(const std::vector<VariablePtr> &variables);
+
+    /**
+     * @brief Reserve space for the given number of variables.
+     *
+     * Reserve space for @p count variables in this component, so that adding
+     * up to that number of variables does not require any reallocation.
+     *
+     * @sa addVariables
+     *
+     * @param count The number of variables to reserve space for.
+     */
+    void reserveVariables(size_t count);
+
     /**
      * @brief Remove the variable at the given @p index from this component.
      *
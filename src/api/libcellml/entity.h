@@ -47,6 +47,18 @@ public:
      */
     void setId(const std::string &id);
 
+    /**
+     * @overload
+     *
+     * @brief Set the @p id document identifier for this entity.
+     *
+     * Set the @p id document identifier for this entity, moving it rather than
+     * copying it.
+     *
+     * @param id The @c std::string document identifier to move.
+     */
+    void setId(std::string &&id);
+
     /**
      * @brief Get the document identifier for this entity.
      *
@@ -57,7 +69,7 @@ public:
      *
      * @return The @c std::string document identifier for this entity.
      */
-    std::string id() const;
+    const std::string &id() const;
 
     /**
      * @brief Returns the parent of the CellML Entity.
@@ -16,9 +16,11 @@ limitations under the License.
 
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 #include "libcellml/exportdefinitions.h"
+#include "libcellml/logger.h"
 #include "libcellml/types.h"
 
 namespace libcellml {
@@ -28,10 +30,10 @@ namespace libcellml {
  *
  * The Generator class is for representing a CellML Generator.
  */
-class LIBCELLML_EXPORT Generator
+class LIBCELLML_EXPORT Generator: public Logger
 {
 public:
-    ~Generator(); /**< Destructor. */
+    ~Generator() override; /**< Destructor. */
     Generator(const Generator &rhs) = delete; /**< Copy constructor. */
     Generator(Generator &&rhs) noexcept = delete; /**< Move constructor. */
     Generator &operator=(Generator rhs) = delete; /**< Assignment operator. */
@@ -89,7 +91,9 @@ public:
      * @brief Get the interface code for the @c AnalyserModel.
      *
      * Return the interface code for the @c AnalyserModel, using the
-     * @c GeneratorProfile.
+     * @c GeneratorProfile. An issue is raised for each external variable of
+     * the @c AnalyserModel if the @c GeneratorProfile cannot generate the
+     * methods that compute its rates and variables.
      *
      * @return The interface code as a @c std::string.
      */
@@ -99,12 +103,39 @@ public:
      * @brief Get the implementation code for the @c AnalyserModel.
      *
      * Return the implementation code for the @c AnalyserModel, using the
-     * @c GeneratorProfile.
+     * @c GeneratorProfile. An issue is raised for each external variable of
+     * the @c AnalyserModel if the @c GeneratorProfile cannot generate the
+     * methods that compute its rates and variables.
      *
      * @return The implementation code as a @c std::string.
      */
     std::string implementationCode() const;
 
+    /**
+     * @brief Write the interface code for the @c AnalyserModel to a stream.
+     *
+     * Write the interface code for the @c AnalyserModel, using the
+     * @c GeneratorProfile, to the given @c std::ostream. The code is written
+     * out as it is generated rather than being built up in memory first, which
+     * is of interest for large models.
+     *
+     * @param stream The @c std::ostream to write the interface code to.
+     */
+    void writeInterface(std::ostream &stream) const;
+
+    /**
+     * @brief Write the implementation code for the @c AnalyserModel to a
+     * stream.
+     *
+     * Write the implementation code for the @c AnalyserModel, using the
+     * @c GeneratorProfile, to the given @c std::ostream. The code is written
+     * out as it is generated rather than being built up in memory first, which
+     * is of interest for large models.
+     *
+     * @param stream The @c std::ostream to write the implementation code to.
+     */
+    void writeImplementation(std::ostream &stream) const;
+
 private:
     Generator(); /**< Constructor. */
 
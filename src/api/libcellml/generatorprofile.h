@@ -35,13 +35,41 @@ public:
      * @brief The type of a profile.
      *
      * A profile can be of one of the following types:
-     *  - C: a profile that targets the C language; or
-     *  - PYTHON: a profile that targets the Python language.
+     *  - C: a profile that targets the C language;
+     *  - PYTHON: a profile that targets the Python language;
+     *  - C_SIMD: a profile that targets the C language and evaluates a
+     *    batch of @c LANE_COUNT instances of a model at once, using OpenMP
+     *    SIMD directives to vectorise the computations; or
+     *  - CXX: a profile that targets the C++ language and generates a
+     *    header-only @c Model structure, which methods are templated on the
+     *    type of real numbers to use (e.g. @c float, @c double or a dual
+     *    number type for forward-mode automatic differentiation).
      */
     enum class Profile
     {
         C,
-        PYTHON
+        PYTHON,
+        C_SIMD,
+        CXX
+    };
+
+    /**
+     * @brief The precision used by a generator profile.
+     *
+     * The precision of the numbers used by a generator profile:
+     *  - DOUBLE: all the numbers are double-precision numbers;
+     *  - SINGLE: all the numbers are single-precision numbers; or
+     *  - MIXED: states and rates are stored as single-precision numbers while
+     *    all the other numbers are double-precision numbers, meaning that
+     *    computations are essentially done using double precision.
+     *
+     * Only the C profile currently supports a precision other than DOUBLE.
+     */
+    enum class Precision
+    {
+        DOUBLE,
+        SINGLE,
+        MIXED
     };
 
     ~GeneratorProfile(); /**< Destructor. */
@@ -81,6 +109,32 @@ public:
      */
     void setProfile(Profile profile);
 
+    /**
+     * @brief Get the @c Precision for this @c GeneratorProfile.
+     *
+     * Return the @c Precision for this @c GeneratorProfile.
+     *
+     * @return The @c Precision for this @c GeneratorProfile.
+     */
+    Precision precision() const;
+
+    /**
+     * @brief Set the @c Precision.
+     *
+     * Set the @c Precision for this @c GeneratorProfile. Like for
+     * @ref setProfile, this (re)loads all the settings of the profile,
+     * meaning that any customisation will be lost.
+     *
+     * Only the C profile supports a precision other than DOUBLE. For any
+     * other profile, the precision is left unchanged, and switching to
+     * another profile using @ref setProfile resets the precision to DOUBLE.
+     *
+     * @param precision The @c Precision to use.
+     *
+     * @return @c true if the @c Precision was set, @c false otherwise.
+     */
+    bool setPrecision(Precision precision);
+
     // Whether the profile requires an interface to be generated.
 
     /**
@@ -1571,6 +1625,60 @@ public:
      */
     void setHasConditionalOperator(bool hasConditionalOperator);
 
+    /**
+     * @brief Get the @c std::string representing the MathML "piecewise"
+     * statement in its branchless form.
+     *
+     * Return the @c std::string representing the MathML "piecewise" statement
+     * in its branchless form, i.e. a call that evaluates both the "if" and the
+     * "else" parts and then selects one of them using the condition.
+     *
+     * @return The @c std::string representing the MathML "piecewise"
+     * statement in its branchless form.
+     */
+    std::string branchlessPiecewiseString() const;
+
+    /**
+     * @brief Set the @c std::string representing the MathML "piecewise"
+     * statement in its branchless form.
+     *
+     * Set the @c std::string representing the MathML "piecewise" statement in
+     * its branchless form. The string may contain the <CONDITION>,
+     * <IF_STATEMENT> and <ELSE_STATEMENT> tags.
+     *
+     * @param branchlessPiecewiseString The @c std::string representing the
+     * MathML "piecewise" statement in its branchless form.
+     */
+    void setBranchlessPiecewiseString(const std::string &branchlessPiecewiseString);
+
+    /**
+     * @brief Test if this @c GeneratorProfile generates "piecewise" statements
+     * in their branchless form.
+     *
+     * Test if this @c GeneratorProfile generates "piecewise" statements in
+     * their branchless form. If so, a "piecewise" statement that selects the
+     * minimum or the maximum of two values is generated using the "min" or
+     * "max" function, while any other "piecewise" statement is generated using
+     * the branchless "piecewise" string.
+     *
+     * @return @c true if the @c GeneratorProfile generates "piecewise"
+     * statements in their branchless form, @c false otherwise.
+     */
+    bool hasBranchlessPiecewise() const;
+
+    /**
+     * @brief Set whether this @c GeneratorProfile generates "piecewise"
+     * statements in their branchless form.
+     *
+     * Set whether this @c GeneratorProfile generates "piecewise" statements in
+     * their branchless form.
+     *
+     * @param hasBranchlessPiecewise A @c bool to determine whether this
+     * @c GeneratorProfile generates "piecewise" statements in their branchless
+     * form.
+     */
+    void setHasBranchlessPiecewise(bool hasBranchlessPiecewise);
+
     // Constants.
 
     /**
@@ -1688,6 +1796,47 @@ public:
      */
     void setNanString(const std::string &nanString);
 
+    /**
+     * @brief Get the @c std::string for the prefix of a real literal.
+     *
+     * Return the @c std::string for the prefix of a real literal.
+     *
+     * @return The @c std::string for the prefix of a real literal.
+     */
+    std::string realLiteralPrefixString() const;
+
+    /**
+     * @brief Set the @c std::string for the prefix of a real literal.
+     *
+     * Set the @c std::string for the prefix of a real literal, e.g. "Real("
+     * (together with a suffix of ")") to generate literals of the real type of
+     * a C++ template.
+     *
+     * @param realLiteralPrefixString The @c std::string to use for the prefix
+     * of a real literal.
+     */
+    void setRealLiteralPrefixString(const std::string &realLiteralPrefixString);
+
+    /**
+     * @brief Get the @c std::string for the suffix of a real literal.
+     *
+     * Return the @c std::string for the suffix of a real literal.
+     *
+     * @return The @c std::string for the suffix of a real literal.
+     */
+    std::string realLiteralSuffixString() const;
+
+    /**
+     * @brief Set the @c std::string for the suffix of a real literal.
+     *
+     * Set the @c std::string for the suffix of a real literal, e.g. "f" to
+     * generate single-precision literals in C.
+     *
+     * @param realLiteralSuffixString The @c std::string to use for the suffix
+     * of a real literal.
+     */
+    void setRealLiteralSuffixString(const std::string &realLiteralSuffixString);
+
     // Arithmetic functions.
 
     /**
@@ -1939,6 +2088,27 @@ public:
      */
     void setMaxFunctionString(const std::string &maxFunctionString);
 
+    /**
+     * @brief Get the @c std::string for the "blend" function implementation.
+     *
+     * Return the @c std::string for the "blend" function implementation, i.e.
+     * the function used by the branchless form of a "piecewise" statement.
+     *
+     * @return The @c std::string for the "blend" function implementation.
+     */
+    std::string blendFunctionString() const;
+
+    /**
+     * @brief Set the @c std::string for the "blend" function implementation.
+     *
+     * Set the @c std::string for the "blend" function implementation, i.e.
+     * the function used by the branchless form of a "piecewise" statement.
+     *
+     * @param blendFunctionString The @c std::string for the "blend" function
+     * implementation.
+     */
+    void setBlendFunctionString(const std::string &blendFunctionString);
+
     // Trigonometric function implementations.
 
     /**
@@ -2315,6 +2485,29 @@ public:
      */
     void setImplementationHeaderString(const std::string &implementationHeaderString);
 
+    /**
+     * @brief Get the @c std::string for an implementation footer.
+     *
+     * Return the @c std::string for an implementation footer.
+     *
+     * @return The @c std::string for an implementation footer.
+     */
+    std::string implementationFooterString() const;
+
+    /**
+     * @brief Set the @c std::string for an implementation footer.
+     *
+     * Set the @c std::string for an implementation footer, i.e. some code that
+     * is to be added at the very end of the implementation code (e.g. to close
+     * a scope opened in the implementation header).
+     *
+     * @sa implementationHeaderString
+     *
+     * @param implementationFooterString The @c std::string to use for an
+     * implementation footer.
+     */
+    void setImplementationFooterString(const std::string &implementationFooterString);
+
     /**
      * @brief Get the @c std::string for the interface of the version constant.
      *
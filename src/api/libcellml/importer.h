@@ -16,7 +16,9 @@ limitations under the License.
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include "libcellml/logger.h"
 #include "libcellml/types.h"
@@ -67,16 +69,53 @@ public:
      * @brief Resolve all imports in the @p model.
      *
      * Resolve all @c Component and @c Units imports by loading the models
-     * from local disk through relative URLs.  The @p baseFile is used to determine
-     * the full path to the source model relative to this one.
+     * through relative URLs, from local disk unless another loader has been
+     * set using @ref setLoader.  The @p baseFile is used to determine
+     * the full path to the source model relative to this one.  The files that
+     * may be needed are read and parsed concurrently before any import gets
+     * resolved.
+     *
+     * If lazy resolution is enabled, then no model gets loaded at this stage.
+     * Instead, the model of an import source gets loaded, and its own imports
+     * get set up to be resolved lazily, the first time that it is needed,
+     * i.e. through @ref ImportSource::model.  Any issue is then reported
+     * when the model is loaded.
+     *
+     * @sa setLazyResolution
      *
      * @param model The @c Model whose imports need resolution.
      * @param baseFile The @c std::string location on local disk of the source @c Model.
      * 
-     * @return @c true if all imports have been resolved successfully, @c false otherwise.
+     * @return @c true if all imports have been resolved successfully, or
+     * lazy resolution is enabled, @c false otherwise.
      */
     bool resolveImports(ModelPtr &model, const std::string &baseFile);
 
+    /**
+     * @brief Set whether imports are to be resolved lazily.
+     *
+     * Set whether @ref resolveImports is to only load the model of an import
+     * source the first time that it is needed, so that only the imports that
+     * are actually used cost anything.  Lazily loaded models may be requested
+     * from several threads at once.  The importer must, however, not be
+     * otherwise used while this happens.  Lazy resolution is disabled by
+     * default.
+     *
+     * @param lazyResolution Whether imports are to be resolved lazily.
+     */
+    void setLazyResolution(bool lazyResolution);
+
+    /**
+     * @brief Get whether imports are to be resolved lazily.
+     *
+     * Get whether imports are to be resolved lazily.
+     *
+     * @sa setLazyResolution
+     *
+     * @return @c true if imports are to be resolved lazily, @c false otherwise.
+     */
+    bool lazyResolution() const;
+
     /**
      * @brief Return the number of models present in the importer's library.
      *
@@ -151,6 +190,205 @@ public:
      */
     bool replaceModel(const ModelPtr &model, const std::string &key);
 
+    /**
+     * @brief Set the loader used to read imported files.
+     *
+     * Set the function used to get the contents of the files that need to be
+     * read when resolving imports.  The loader is given the resolved URL of a
+     * file, i.e. the URL of the import relative to its base file, and returns
+     * @c true and the contents of the file if it knows about that file, or
+     * @c false otherwise.  Files may be read concurrently, so the loader must
+     * be safe to call from several threads at once.  By default, files are
+     * read from local disk (see @ref fileLoader).  If the given @p loader is
+     * empty, e.g. an @ref archiveLoader for an archive that could not be
+     * read, then an issue is raised and the current loader is kept.
+     *
+     * @sa fileLoader, memoryLoader, archiveLoader
+     *
+     * @param loader The @c ImportLoader to use.
+     */
+    void setLoader(const ImportLoader &loader);
+
+    /**
+     * @brief Set the directory where parsed imported models are cached.
+     *
+     * Set the existing directory where the models parsed when resolving
+     * imports are cached, in a form that is faster to load than CellML.  A
+     * cached model is used instead of parsing a file whenever it was created
+     * from a file with the same contents, which means that files still get
+     * read but only need parsing when they have changed.  Caching is disabled
+     * by default, or if the given @p directory is empty.
+     *
+     * @param directory The @c std::string location on local disk of the cache directory.
+     */
+    void setCacheDirectory(const std::string &directory);
+
+    /**
+     * @brief Get the directory where parsed imported models are cached.
+     *
+     * Get the directory where parsed imported models are cached, or an empty
+     * string if caching is disabled.
+     *
+     * @sa setCacheDirectory
+     *
+     * @return The @c std::string location on local disk of the cache directory.
+     */
+    std::string cacheDirectory() const;
+
+    /**
+     * @brief Create a loader reading files from local disk.
+     *
+     * Create a loader reading files from local disk, i.e. the default
+     * behaviour of the importer.
+     *
+     * @return The @c ImportLoader.
+     */
+    static ImportLoader fileLoader();
+
+    /**
+     * @brief Create a loader serving files from memory.
+     *
+     * Create a loader serving the given @p files, a map from resolved URLs to
+     * the contents of the corresponding files.
+     *
+     * @param files The @c std::map of files to serve.
+     *
+     * @return The @c ImportLoader.
+     */
+    static ImportLoader memoryLoader(const std::map<std::string, std::string> &files);
+
+    /**
+     * @brief Create a loader serving files from a tar archive.
+     *
+     * Create a loader serving the files of the (uncompressed) tar archive at
+     * the given @p archive location on local disk.  The archive is read once,
+     * when the loader is created, and its files are then served from memory
+     * using their path within the archive as their URL.  ustar, GNU (including
+     * base-256 sizes for large files) and pax archives are supported.
+     *
+     * @param archive The @c std::string location on local disk of the archive.
+     *
+     * @return The @c ImportLoader, or an empty @c ImportLoader if the archive
+     * cannot be read, is truncated, or is not a tar archive.
+     */
+    static ImportLoader archiveLoader(const std::string &archive);
+
+    /**
+     * @brief Get the keys of the models that the model at the given @p key imports from.
+     *
+     * Get the keys of the models in the library that the model stored in the
+     * library under the given @p key directly imports from, as resolved by
+     * this importer.
+     *
+     * @sa dependants
+     *
+     * @param key The key of the model.
+     *
+     * @return The keys of the models that the model directly imports from.
+     */
+    std::vector<std::string> dependencies(const std::string &key) const;
+
+    /**
+     * @brief Get the keys of the models that import from the model at the given @p key.
+     *
+     * Get the keys of the models in the library that directly import from the
+     * model stored in the library under the given @p key, as resolved by this
+     * importer.
+     *
+     * @sa dependencies
+     *
+     * @param key The key of the model.
+     *
+     * @return The keys of the models that directly import from the model.
+     */
+    std::vector<std::string> dependants(const std::string &key) const;
+
+    /**
+     * @brief Reload the model at the given @p key.
+     *
+     * Read and parse again the file for the model stored in the library under
+     * the given @p key, e.g. because it has changed, and resolve its imports.
+     * The import sources that were resolved by this importer using the old
+     * model are updated to use the new one, so that the models that depend on
+     * it don't need to be resolved again. Unless imports are resolved lazily,
+     * the entities that those import sources import are fetched again, so
+     * that an issue is raised if the new model doesn't provide them anymore
+     * or if it introduces a cyclic dependency.
+     *
+     * @param key The key of the model to reload.
+     *
+     * @return @c true if the model was reloaded, its imports resolved and the
+     * entities imported from it fetched successfully, @c false otherwise.
+     */
+    bool invalidate(const std::string &key);
+
+    /**
+     * @brief Set whether statistics are recorded for the imported models.
+     *
+     * Set whether this importer records, for each of the models in its
+     * library, statistics about resolving and flattening imports, e.g. to
+     * find out which imported models are slow to read, parse, or flatten.
+     * Statistics are not recorded by default.
+     *
+     * @sa statistics
+     *
+     * @param enabled Whether statistics are to be recorded.
+     */
+    void setStatisticsEnabled(bool enabled);
+
+    /**
+     * @brief Get whether statistics are recorded for the imported models.
+     *
+     * Get whether this importer records statistics for the imported models.
+     *
+     * @sa setStatisticsEnabled
+     *
+     * @return @c true if statistics are recorded, @c false otherwise.
+     */
+    bool statisticsEnabled() const;
+
+    /**
+     * @brief Get the number of models that statistics have been recorded for.
+     *
+     * Get the number of models that statistics have been recorded for.
+     *
+     * @return The number of models.
+     */
+    size_t statisticsCount() const;
+
+    /**
+     * @brief Get the statistics recorded for the model at the given @p key.
+     *
+     * Get the statistics recorded for the model stored in the library under
+     * the given @p key.
+     *
+     * @param key The key of the model.
+     *
+     * @return The @c ImportStatistics of the model, or @c nullptr if none
+     * have been recorded.
+     */
+    ImportStatisticsPtr statistics(const std::string &key) const;
+
+    /**
+     * @brief Get the statistics recorded for the model at the given @p index.
+     *
+     * Get the statistics recorded for the model at the given @p index, the
+     * models being sorted by key.
+     *
+     * @param index The index of the model.
+     *
+     * @return The @c ImportStatistics of the model, or @c nullptr if the
+     * @p index is not valid.
+     */
+    ImportStatisticsPtr statistics(size_t index) const;
+
+    /**
+     * @brief Remove all the recorded statistics.
+     *
+     * Remove the statistics recorded for all the models.
+     */
+    void removeAllStatistics();
+
     /**
      * @brief Clear the links with other models from all import sources.
      *
@@ -65,7 +65,7 @@ public:
      *
      * @return The URL of the source @c Model if set otherwise the emtpy string.
      */
-    std::string url() const;
+    const std::string &url() const;
 
     /**
      * @brief Set the source @c Model's URL.
@@ -80,7 +80,10 @@ public:
      * @brief Get the @c Model that resolves the import.
      *
      * Get the @c Model which has been assigned to resolve this @c ImportSource. If no @c Model
-     * has been assigned then return the @c nullptr.
+     * has been assigned then return the @c nullptr.  If this @c ImportSource
+     * is to be resolved lazily, i.e. through @ref Importer::resolveImports
+     * with lazy resolution enabled, then its @c Model gets loaded the first
+     * time that it is needed.
      *
      * @return The @c Model used to resolve this @c ImportSource.
      */
@@ -110,6 +113,10 @@ public:
      * been assigned. Returns @c true if the @c ImportSource is resolved otherwise returns
      * @c false.
      *
+     * If this @c ImportSource is to be resolved lazily then its source @c Model
+     * is not loaded by this method, i.e. @c false is returned until its source
+     * @c Model has been loaded through @ref model.
+     *
      * @return @c true if the @c ImportSource has been resolved, @c false otherwise.
      */
     bool hasModel() const;
@@ -279,10 +286,12 @@ public:
      */
     UnitsPtr units(size_t index) const;
 
+protected:
+    struct ImportSourceImpl; /**< Forward declaration for pImpl idiom. */
+
 private:
     ImportSource(); /**< Constructor. */
 
-    struct ImportSourceImpl; /**< Forward declaration for pImpl idiom. */
     ImportSourceImpl *mPimpl; /**< Private member to implementation pointer. */
 };
 
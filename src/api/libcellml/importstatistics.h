@@ -0,0 +1,136 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ImportStatistics class.
+ *
+ * The ImportStatistics class is for representing what an @c Importer has
+ * recorded about one of the models in its library, i.e. the cost of reading
+ * and parsing it, how often it was needed, how many components and units
+ * were imported from it, and how long it took to flatten them.
+ *
+ * @sa Importer::setStatisticsEnabled
+ */
+class LIBCELLML_EXPORT ImportStatistics
+{
+    friend class Importer;
+
+public:
+    ~ImportStatistics(); /**< Destructor. */
+    ImportStatistics(const ImportStatistics &rhs) = delete; /**< Copy constructor. */
+    ImportStatistics(ImportStatistics &&rhs) noexcept = delete; /**< Move constructor. */
+    ImportStatistics &operator=(ImportStatistics rhs) = delete; /**< Assignment operator. */
+
+    /**
+     * @brief Get the key of the model for this @c ImportStatistics.
+     *
+     * Return the key, in the library of the @c Importer, of the model for
+     * this @c ImportStatistics, i.e. the resolved URL of the model.
+     *
+     * @return The key of the model.
+     */
+    std::string key() const;
+
+    /**
+     * @brief Get the number of bytes read for this @c ImportStatistics.
+     *
+     * Return the number of bytes read to get the model for this
+     * @c ImportStatistics.
+     *
+     * @return The number of bytes read.
+     */
+    size_t bytesRead() const;
+
+    /**
+     * @brief Get the parse time for this @c ImportStatistics.
+     *
+     * Return the time, in seconds, spent turning the contents read for this
+     * @c ImportStatistics into a model, whether by parsing them or by reading
+     * them from the cache directory of the @c Importer.
+     *
+     * @return The parse time, in seconds.
+     */
+    double parseTime() const;
+
+    /**
+     * @brief Get the number of cache hits for this @c ImportStatistics.
+     *
+     * Return the number of times that the model for this @c ImportStatistics
+     * was needed and found in the library of the @c Importer.
+     *
+     * @return The number of cache hits.
+     */
+    size_t cacheHitCount() const;
+
+    /**
+     * @brief Get the number of cache misses for this @c ImportStatistics.
+     *
+     * Return the number of times that the model for this @c ImportStatistics
+     * was needed and had to be read, because it was not in the library of the
+     * @c Importer.
+     *
+     * @return The number of cache misses.
+     */
+    size_t cacheMissCount() const;
+
+    /**
+     * @brief Get the number of components imported for this @c ImportStatistics.
+     *
+     * Return the number of components that resolving imports imported from
+     * the model for this @c ImportStatistics.
+     *
+     * @return The number of components imported.
+     */
+    size_t componentCount() const;
+
+    /**
+     * @brief Get the number of units imported for this @c ImportStatistics.
+     *
+     * Return the number of units that resolving imports imported from the
+     * model for this @c ImportStatistics.
+     *
+     * @return The number of units imported.
+     */
+    size_t unitsCount() const;
+
+    /**
+     * @brief Get the flatten time for this @c ImportStatistics.
+     *
+     * Return the time, in seconds, spent by @ref Importer::flattenModel
+     * instantiating the components imported from the model for this
+     * @c ImportStatistics.
+     *
+     * @return The flatten time, in seconds.
+     */
+    double flattenTime() const;
+
+private:
+    ImportStatistics(); /**< Constructor. */
+
+    struct ImportStatisticsImpl;
+    ImportStatisticsImpl *mPimpl;
+};
+
+} // namespace libcellml
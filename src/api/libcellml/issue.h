@@ -233,6 +233,9 @@ public:
         ANALYSER_EXTERNAL_VARIABLE_VOI,
         ANALYSER_EXTERNAL_VARIABLE_USE_PRIMARY_VARIABLE,
 
+        // Generator issues:
+        GENERATOR_EXTERNAL_VARIABLE_NOT_SUPPORTED,
+
         // Placeholder for further references:
         UNSPECIFIED
     };
@@ -641,69 +644,6 @@ public:
 private:
     Issue(); /**< Constructor. */
 
-    /**
-     * @brief Constructs an Issue for the component.
-     *
-     * Convenience constructor for creating an issue for the component.
-     *
-     * @param component The component the issue references.
-     */
-    explicit Issue(const ComponentPtr &component);
-
-    /**
-     * @brief Constructs an Issue for the import source.
-     *
-     * Convenience constructor for creating an issue for the import source.
-     *
-     * @param importSource The import source the issue references.
-     */
-    explicit Issue(const ImportSourcePtr &importSource);
-
-    /**
-     * @brief Constructs an Issue for the model.
-     *
-     * Convenience constructor for creating an issue for the model.
-     *
-     * @param model The model the issue references.
-     */
-    explicit Issue(const ModelPtr &model);
-
-    /**
-     * @brief Constructs an Issue for the reset.
-     *
-     * Convenience constructor for creating an issue for the reset.
-     *
-     * @param reset The reset the issue references.
-     */
-    explicit Issue(const ResetPtr &reset);
-
-    /**
-     * @brief Constructs an Issue for the units.
-     *
-     * Convenience constructor for creating an issue for the units.
-     *
-     * @param units The units the issue references.
-     */
-    explicit Issue(const UnitsPtr &units);
-
-    /**
-     * @brief Constructs an Issue for the variable.
-     *
-     * Convenience constructor for creating an issue for the variable.
-     *
-     * @param variable The variable the issue references.
-     */
-    explicit Issue(const VariablePtr &variable);
-
-    /**
-     * @brief Constructs an Issue for the unit.
-     *
-     * Convenience constructor for creating an issue for the unit.
-     *
-     * @param unit The unit the issue references.
-     */
-    explicit Issue(const UnitPtr &unit);
-
     struct IssueImpl; /**< Forward declaration for pImpl idiom. */
     IssueImpl *mPimpl; /**< Private member to implementation pointer. */
 };
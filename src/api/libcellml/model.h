@@ -30,7 +30,9 @@ namespace libcellml {
 /**
  * @brief The Model class.
  *
- * The Model class is for representing a CellML Model.
+ * The Model class is for representing a CellML Model. A model can safely be
+ * read from several threads at the same time, as long as none of them
+ * modifies it.
  */
 class LIBCELLML_EXPORT Model: public ComponentEntity
 #ifndef SWIG
@@ -318,6 +320,43 @@ public:
      */
     bool hasUnresolvedImports() const;
 
+    /**
+     * @brief Get the component with the given @p path.
+     *
+     * Returns the component with the given @p path, i.e. the name of the
+     * component preceded by the name of its ancestors, all separated by a
+     * forward slash (e.g. "component/subcomponent"). If several components
+     * have the same path, the first one found in the encapsulation hierarchy
+     * is returned.
+     *
+     * The paths are indexed the first time they are needed and the index is
+     * automatically rebuilt once a component or a variable has been added,
+     * removed or renamed.
+     *
+     * @sa variableByPath
+     *
+     * @param path The path of the component to return.
+     *
+     * @return The component with the given @p path on success, @c nullptr otherwise.
+     */
+    ComponentPtr componentByPath(const std::string &path) const;
+
+    /**
+     * @brief Get the variable with the given @p path.
+     *
+     * Returns the variable with the given @p path, i.e. the name of the
+     * variable preceded by the path of its component (e.g.
+     * "component/subcomponent/variable"). If several variables have the same
+     * path, the first one found in the encapsulation hierarchy is returned.
+     *
+     * @sa componentByPath
+     *
+     * @param path The path of the variable to return.
+     *
+     * @return The variable with the given @p path on success, @c nullptr otherwise.
+     */
+    VariablePtr variableByPath(const std::string &path) const;
+
     /**
      * @brief Create a clone of this model.
      *
@@ -47,6 +47,18 @@ public:
      */
     void setName(const std::string &name);
 
+    /**
+     * @overload
+     *
+     * @brief Set the name for the Entity.
+     *
+     * This method sets the name parameter of the Entity, moving @p name rather
+     * than copying it.  It does not check the validity of the name.
+     *
+     * @param name A string to represent the name.
+     */
+    void setName(std::string &&name);
+
     /**
      * @brief Get the name of the Entity.
      *
@@ -54,13 +66,14 @@ public:
      *
      * @return @c std::string representation of the Entity name.
      */
-    std::string name() const;
+    const std::string &name() const;
 
 protected:
     NamedEntity(); /**< Constructor. */
 
-private:
     struct NamedEntityImpl; /**< Forward declaration for pImpl idiom. */
+
+private:
     NamedEntityImpl *mPimpl; /**< Private member to implementation pointer. */
 };
 
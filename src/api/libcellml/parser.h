@@ -62,6 +62,21 @@ public:
      */
     ModelPtr parseModel(const std::string &input);
 
+    /**
+     * @brief Create and populate a new model from a binary @c std::string.
+     *
+     * Creates and populates a new model pointer from the @p input binary
+     * representation, as produced by @ref Printer::printBinaryModel. An issue
+     * is raised if @p input is not a valid binary representation of a model.
+     *
+     * @sa Printer::printBinaryModel
+     *
+     * @param input The binary representation of a model.
+     *
+     * @return The new @c ModelPtr deserialised from the input string.
+     */
+    ModelPtr parseBinaryModel(const std::string &input);
+
 private:
     Parser(); /**< Constructor. */
 
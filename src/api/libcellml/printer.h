@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "libcellml/exportdefinitions.h"
@@ -55,10 +56,51 @@ public:
      *
      * @param model The @c Model to serialise.
      *
-     * @return The @c std::string representation of the @c Model.
+     * @return The @c std::string representation of the @c Model, or the empty
+     * string if the @c Model could not be serialised, e.g. because some of its
+     * MathML is not well formed.
      */
     std::string printModel(const ModelPtr &model, bool autoIds = false) const;
 
+    /**
+     * @brief Serialise the @c Model to a @c std::ostream.
+     *
+     * Serialise the given @p model to @p output. The result is the same as
+     * that of @ref printModel(const ModelPtr &, bool) const, but each element
+     * is written to @p output as it is serialised, so no copy of the whole
+     * document is ever held in memory. Only @p model itself needs to be, e.g.
+     * when writing out a flattened model::
+     *
+     *   std::ofstream output("flat.cellml");
+     *   printer->printModel(importer->flattenModel(model), output);
+     *
+     * @param model The @c Model to serialise.
+     * @param output The @c std::ostream to write to.
+     * @param autoIds Whether to automatically generate missing identifiers.
+     *
+     * @return @c true if the @c Model could be written to @p output,
+     * @c false otherwise, e.g. because some of its MathML is not well formed,
+     * in which case only part of the @c Model may have been written.
+     */
+    bool printModel(const ModelPtr &model, std::ostream &output, bool autoIds = false) const;
+
+    /**
+     * @brief Serialise the @c Model to a binary @c std::string.
+     *
+     * Serialise the given @p model to a compact binary representation, which
+     * can be turned back into a model using @ref Parser::parseBinaryModel
+     * much faster than parsing CellML. The binary representation holds
+     * everything that @ref printModel would print, but not the models that
+     * were imported when resolving imports.
+     *
+     * @sa Parser::parseBinaryModel
+     *
+     * @param model The @c Model to serialise.
+     *
+     * @return The binary representation of the @c Model.
+     */
+    std::string printBinaryModel(const ModelPtr &model) const;
+
 private:
     Printer(); /**< Constructor. */
 
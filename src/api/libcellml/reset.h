@@ -144,7 +144,7 @@ public:
      *
      * @return @c std::string test value for this reset.
      */
-    std::string testValue() const;
+    const std::string &testValue() const;
 
     /**
      * @brief Set the test value string for this reset.
@@ -156,6 +156,19 @@ public:
      */
     void setTestValue(const std::string &math);
 
+    /**
+     * @overload
+     *
+     * @brief Set the test value string for this reset.
+     *
+     * Set the test value string for this reset, moving @p math rather than
+     * copying it. If @p math is an empty string, the test value will
+     * effectively be removed from the reset.
+     *
+     * @param math The @c std::string to move for this reset.
+     */
+    void setTestValue(std::string &&math);
+
     /**
      * @brief Clears the test value math for this reset.
      *
@@ -191,7 +204,7 @@ public:
      *
      * @return @c std::string The identifier of the test value for this reset.
      */
-    std::string testValueId() const;
+    const std::string &testValueId() const;
 
     /**
      * @brief Append the argument to the reset value for this reset.
@@ -210,7 +223,7 @@ public:
      *
      * @return @c std::string reset value for this reset.
      */
-    std::string resetValue() const;
+    const std::string &resetValue() const;
 
     /**
      * @brief Set the reset value math for this reset.
@@ -222,6 +235,19 @@ public:
      */
     void setResetValue(const std::string &math);
 
+    /**
+     * @overload
+     *
+     * @brief Set the reset value math for this reset.
+     *
+     * Set the math to the reset value for this reset, moving @p math rather
+     * than copying it. If @p math is an empty string, reset value will
+     * effectively be removed from the reset.
+     *
+     * @param math The @c std::string to move for this reset.
+     */
+    void setResetValue(std::string &&math);
+
     /**
      * @brief Clears the reset value math for this reset.
      *
@@ -256,7 +282,7 @@ public:
      *
      * @return @c std::string The identifier of the reset value for this reset.
      */
-    std::string resetValueId() const;
+    const std::string &resetValueId() const;
 
     /**
      * @brief Create a clone of this reset.
@@ -17,8 +17,10 @@ limitations under the License.
 #pragma once
 
 #include <any>
+#include <functional>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "libcellml/enums.h"
@@ -47,6 +49,9 @@ class GeneratorProfile; /**< Forward declaration of GeneratorProfile class. */
 using GeneratorProfilePtr = std::shared_ptr<GeneratorProfile>; /**< Type definition for shared generator variable pointer. */
 class Importer; /**< Forward declaration of Importer class. */
 using ImporterPtr = std::shared_ptr<Importer>; /**< Type definition for shared importer pointer. */
+using ImportLoader = std::function<bool(const std::string &, std::string &)>; /**< Type definition for a function loading the contents of an imported file. */
+class ImportStatistics; /**< Forward declaration of ImportStatistics class. */
+using ImportStatisticsPtr = std::shared_ptr<ImportStatistics>; /**< Type definition for shared import statistics pointer. */
 class Issue; /**< Forward declaration of Issue class. */
 using IssuePtr = std::shared_ptr<Issue>; /**< Type definition for shared issue pointer. */
 class Logger; /**< Forward declaration of Parser class. */
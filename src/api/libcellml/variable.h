@@ -329,6 +329,20 @@ public:
      */
     void setInitialValue(const std::string &initialValue);
 
+    /**
+     * @overload
+     *
+     * @brief Set the initial value for this variable using a string.
+     *
+     * Set the initial value for this variable using a string, moving
+     * @p initialValue rather than copying it.
+     *
+     * @sa initialValue
+     *
+     * @param initialValue The initial value to move.
+     */
+    void setInitialValue(std::string &&initialValue);
+
     /**
      * @overload
      *
@@ -366,7 +380,7 @@ public:
      *
      * @return the initial value as a @c std::string.
      */
-    std::string initialValue() const;
+    const std::string &initialValue() const;
 
     /**
      * @brief Clear the initial value for this variable.
@@ -409,7 +423,7 @@ public:
      *
      * @return the interface type as a @c std::string.
      */
-    std::string interfaceType() const;
+    const std::string &interfaceType() const;
 
     /**
      * @brief Clear the interface type for this variable.
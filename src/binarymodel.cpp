@@ -0,0 +1,783 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "binarymodel.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/reset.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
+namespace libcellml {
+
+/**
+ * The binary model format starts with a signature, followed by the version of
+ * the format. All integers are stored as LEB128 variable-length integers,
+ * doubles are stored as their IEEE 754 bits in little-endian order, and
+ * strings are stored as their length followed by their bytes.
+ *
+ * The model is then stored as:
+ *  - its name, id and encapsulation id;
+ *  - its import sources (url and id);
+ *  - its units (name, id, import reference and unit definitions);
+ *  - its components, recursively (name, id, encapsulation id, import
+ *    reference, variables, resets, math and child components);
+ *  - the entities imported from each import source; and
+ *  - its variable equivalences (variables, mapping id and connection id).
+ *
+ * Variables, components and units are referenced by their position in the
+ * order in which they are stored, offset by one so that zero means none.
+ */
+static const std::string BINARY_MODEL_SIGNATURE = "\x89"
+                                                  "CellML\r\n";
+static const uint64_t BINARY_MODEL_VERSION = 1;
+
+static const uint64_t IMPORTED_COMPONENT = 0;
+static const uint64_t IMPORTED_UNITS = 1;
+
+/**
+ * Components are read recursively, so limit how deeply they can be nested to
+ * prevent a malformed input from exhausting the stack.
+ */
+static const size_t MAX_ENCAPSULATION_DEPTH = 1000;
+
+/**
+ * @brief The BinaryModelWriter struct.
+ *
+ * The writer of the binary model format.
+ */
+struct BinaryModelWriter
+{
+    std::string mOutput;
+
+    std::vector<ImportSourcePtr> mImportSources;
+    std::unordered_map<const ImportSource *, uint64_t> mImportSourceIndexes;
+    std::unordered_map<const Units *, uint64_t> mUnitsIndexes;
+    std::unordered_map<const Component *, uint64_t> mComponentIndexes;
+    std::unordered_map<const Variable *, uint64_t> mVariableIndexes;
+    std::vector<VariablePtr> mVariables;
+
+    void writeInteger(uint64_t value);
+    void writeSignedInteger(int64_t value);
+    void writeDouble(double value);
+    void writeString(const std::string &value);
+
+    void indexComponent(const ComponentPtr &component);
+    void indexImportSource(const ImportSourcePtr &importSource);
+
+    void writeUnits(const UnitsPtr &units);
+    void writeVariable(const VariablePtr &variable);
+    void writeReset(const ResetPtr &reset);
+    void writeComponent(const ComponentPtr &component);
+    void writeImportSourceEntities(const ImportSourcePtr &importSource);
+    void writeEquivalences();
+
+    void write(const ModelPtr &model);
+};
+
+void BinaryModelWriter::writeInteger(uint64_t value)
+{
+    while (value >= 0x80) {
+        mOutput += char((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+
+    mOutput += char(value);
+}
+
+void BinaryModelWriter::writeSignedInteger(int64_t value)
+{
+    // Zigzag encode the value so that small negative values remain small.
+
+    writeInteger((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void BinaryModelWriter::writeDouble(double value)
+{
+    uint64_t bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    for (size_t i = 0; i < sizeof(bits); ++i) {
+        mOutput += char((bits >> (8 * i)) & 0xff);
+    }
+}
+
+void BinaryModelWriter::writeString(const std::string &value)
+{
+    writeInteger(value.size());
+
+    mOutput += value;
+}
+
+void BinaryModelWriter::indexComponent(const ComponentPtr &component)
+{
+    mComponentIndexes.emplace(component.get(), mComponentIndexes.size() + 1);
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+
+        mVariableIndexes.emplace(variable.get(), mVariables.size() + 1);
+        mVariables.push_back(variable);
+    }
+
+    if (component->isImport()) {
+        indexImportSource(component->importSource());
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        indexComponent(component->component(i));
+    }
+}
+
+void BinaryModelWriter::indexImportSource(const ImportSourcePtr &importSource)
+{
+    if ((importSource != nullptr)
+        && mImportSourceIndexes.emplace(importSource.get(), mImportSources.size() + 1).second) {
+        mImportSources.push_back(importSource);
+    }
+}
+
+void BinaryModelWriter::writeUnits(const UnitsPtr &units)
+{
+    writeString(units->name());
+    writeString(units->id());
+    writeString(units->importReference());
+    writeInteger(units->unitCount());
+
+    std::string reference;
+    std::string prefix;
+    std::string id;
+    double exponent;
+    double multiplier;
+
+    for (size_t i = 0; i < units->unitCount(); ++i) {
+        units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+
+        writeString(reference);
+        writeString(prefix);
+        writeDouble(exponent);
+        writeDouble(multiplier);
+        writeString(id);
+    }
+}
+
+void BinaryModelWriter::writeVariable(const VariablePtr &variable)
+{
+    writeString(variable->name());
+    writeString(variable->id());
+
+    // Units that are part of the model are referenced by position, while other
+    // units are referenced by name, just like the parser would do.
+
+    auto units = variable->units();
+
+    if (units == nullptr) {
+        writeInteger(0);
+    } else {
+        auto unitsIndex = mUnitsIndexes.find(units.get());
+
+        if (unitsIndex != mUnitsIndexes.end()) {
+            writeInteger(unitsIndex->second + 1);
+        } else {
+            writeInteger(1);
+            writeString(units->name());
+        }
+    }
+
+    writeString(variable->initialValue());
+    writeString(variable->interfaceType());
+}
+
+void BinaryModelWriter::writeReset(const ResetPtr &reset)
+{
+    writeString(reset->id());
+
+    if (reset->isOrderSet()) {
+        writeInteger(1);
+        writeSignedInteger(reset->order());
+    } else {
+        writeInteger(0);
+    }
+
+    auto variableIndex = mVariableIndexes.find(reset->variable().get());
+    auto testVariableIndex = mVariableIndexes.find(reset->testVariable().get());
+
+    writeInteger((variableIndex != mVariableIndexes.end()) ? variableIndex->second : 0);
+    writeInteger((testVariableIndex != mVariableIndexes.end()) ? testVariableIndex->second : 0);
+    writeString(reset->testValue());
+    writeString(reset->testValueId());
+    writeString(reset->resetValue());
+    writeString(reset->resetValueId());
+}
+
+void BinaryModelWriter::writeComponent(const ComponentPtr &component)
+{
+    writeString(component->name());
+    writeString(component->id());
+    writeString(component->encapsulationId());
+    writeString(component->importReference());
+    writeInteger(component->variableCount());
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        writeVariable(component->variable(i));
+    }
+
+    writeInteger(component->resetCount());
+
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        writeReset(component->reset(i));
+    }
+
+    writeString(component->math());
+    writeInteger(component->componentCount());
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        writeComponent(component->component(i));
+    }
+}
+
+void BinaryModelWriter::writeImportSourceEntities(const ImportSourcePtr &importSource)
+{
+    // Keep track of the order in which entities were imported, since it is the
+    // order in which they get printed. Entities that are not part of the model
+    // are skipped.
+
+    std::vector<std::pair<uint64_t, uint64_t>> entities;
+
+    for (size_t i = 0; i < importSource->componentCount(); ++i) {
+        auto componentIndex = mComponentIndexes.find(importSource->component(i).get());
+
+        if (componentIndex != mComponentIndexes.end()) {
+            entities.emplace_back(IMPORTED_COMPONENT, componentIndex->second);
+        }
+    }
+
+    for (size_t i = 0; i < importSource->unitsCount(); ++i) {
+        auto unitsIndex = mUnitsIndexes.find(importSource->units(i).get());
+
+        if (unitsIndex != mUnitsIndexes.end()) {
+            entities.emplace_back(IMPORTED_UNITS, unitsIndex->second);
+        }
+    }
+
+    writeInteger(entities.size());
+
+    for (const auto &entity : entities) {
+        writeInteger(entity.first);
+        writeInteger(entity.second);
+    }
+}
+
+void BinaryModelWriter::writeEquivalences()
+{
+    // Store each equivalence once, when we come across it for the first time,
+    // i.e. in the same order as the printer, so that restoring equivalences in
+    // that order results in the same model being printed.
+
+    std::vector<std::pair<VariablePtr, VariablePtr>> equivalences;
+
+    for (const auto &variable : mVariables) {
+        auto variableIndex = mVariableIndexes[variable.get()];
+
+        for (size_t i = 0; i < variable->equivalentVariableCount(); ++i) {
+            auto equivalentVariable = variable->equivalentVariable(i);
+            auto equivalentVariableIndex = mVariableIndexes.find(equivalentVariable.get());
+
+            if ((equivalentVariableIndex != mVariableIndexes.end())
+                && (equivalentVariableIndex->second > variableIndex)
+                && equivalentVariable->hasEquivalentVariable(variable)) {
+                equivalences.emplace_back(variable, equivalentVariable);
+            }
+        }
+    }
+
+    writeInteger(equivalences.size());
+
+    for (const auto &equivalence : equivalences) {
+        writeInteger(mVariableIndexes[equivalence.first.get()]);
+        writeInteger(mVariableIndexes[equivalence.second.get()]);
+        writeString(Variable::equivalenceMappingId(equivalence.first, equivalence.second));
+        writeString(Variable::equivalenceConnectionId(equivalence.first, equivalence.second));
+    }
+}
+
+void BinaryModelWriter::write(const ModelPtr &model)
+{
+    // Index the import sources, units, components and variables of the model.
+
+    for (size_t i = 0; i < model->importSourceCount(); ++i) {
+        indexImportSource(model->importSource(i));
+    }
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto units = model->units(i);
+
+        mUnitsIndexes.emplace(units.get(), i + 1);
+
+        if (units->isImport()) {
+            indexImportSource(units->importSource());
+        }
+    }
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        indexComponent(model->component(i));
+    }
+
+    // Write the model.
+
+    mOutput += BINARY_MODEL_SIGNATURE;
+
+    writeInteger(BINARY_MODEL_VERSION);
+    writeString(model->name());
+    writeString(model->id());
+    writeString(model->encapsulationId());
+    writeInteger(model->importSourceCount());
+    writeInteger(mImportSources.size());
+
+    for (const auto &importSource : mImportSources) {
+        writeString(importSource->url());
+        writeString(importSource->id());
+    }
+
+    writeInteger(model->unitsCount());
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        writeUnits(model->units(i));
+    }
+
+    writeInteger(model->componentCount());
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        writeComponent(model->component(i));
+    }
+
+    for (const auto &importSource : mImportSources) {
+        writeImportSourceEntities(importSource);
+    }
+
+    writeEquivalences();
+}
+
+/**
+ * @brief The BinaryModelReader struct.
+ *
+ * The reader of the binary model format. Reading past the end of the input or
+ * reading an inconsistent value marks the input as invalid, after which all
+ * reads return default values.
+ */
+struct BinaryModelReader
+{
+    const std::string &mInput;
+    size_t mPosition = 0;
+    std::string mError;
+
+    std::vector<ImportSourcePtr> mImportSources;
+    std::vector<UnitsPtr> mUnits;
+    std::vector<ComponentPtr> mComponents;
+    std::vector<VariablePtr> mVariables;
+
+    /**
+     * @brief A reset whose variables are to be set once all the variables
+     * have been read.
+     */
+    struct PendingReset
+    {
+        ResetPtr mReset;
+        uint64_t mVariableIndex;
+        uint64_t mTestVariableIndex;
+    };
+
+    std::vector<PendingReset> mPendingResets;
+
+    explicit BinaryModelReader(const std::string &input);
+
+    bool isValid() const;
+    void invalidate(const std::string &error);
+
+    uint64_t readInteger();
+    uint64_t readCount();
+    int64_t readSignedInteger();
+    double readDouble();
+    std::string readString();
+
+    template<typename T>
+    T entity(const std::vector<T> &entities, uint64_t index);
+
+    UnitsPtr readUnits();
+    VariablePtr readVariable();
+    ResetPtr readReset();
+    ComponentPtr readComponent(size_t depth);
+    void readImportSourceEntities(const ImportSourcePtr &importSource);
+    void readEquivalences();
+
+    void read(const ModelPtr &model);
+};
+
+BinaryModelReader::BinaryModelReader(const std::string &input)
+    : mInput(input)
+{
+}
+
+bool BinaryModelReader::isValid() const
+{
+    return mError.empty();
+}
+
+void BinaryModelReader::invalidate(const std::string &error)
+{
+    if (isValid()) {
+        mError = error;
+    }
+
+    mPosition = mInput.size();
+}
+
+uint64_t BinaryModelReader::readInteger()
+{
+    uint64_t res = 0;
+
+    for (size_t shift = 0; shift < 64; shift += 7) {
+        if (mPosition >= mInput.size()) {
+            invalidate("Binary model is truncated.");
+
+            return 0;
+        }
+
+        auto byte = uint64_t(static_cast<unsigned char>(mInput[mPosition++]));
+
+        res |= (byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0) {
+            return res;
+        }
+    }
+
+    invalidate("Binary model contains an invalid integer.");
+
+    return 0;
+}
+
+uint64_t BinaryModelReader::readCount()
+{
+    // A count of items can never exceed the number of remaining bytes since
+    // every item takes at least one byte. Checking this prevents us from
+    // trying to reserve huge amounts of memory for corrupted input.
+
+    auto res = readInteger();
+
+    if (res > mInput.size() - mPosition) {
+        invalidate("Binary model contains an invalid count.");
+
+        return 0;
+    }
+
+    return res;
+}
+
+int64_t BinaryModelReader::readSignedInteger()
+{
+    auto value = readInteger();
+
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+double BinaryModelReader::readDouble()
+{
+    uint64_t bits = 0;
+
+    if (mInput.size() - mPosition < sizeof(bits)) {
+        invalidate("Binary model is truncated.");
+
+        return 0.0;
+    }
+
+    for (size_t i = 0; i < sizeof(bits); ++i) {
+        bits |= uint64_t(static_cast<unsigned char>(mInput[mPosition++])) << (8 * i);
+    }
+
+    double res;
+
+    std::memcpy(&res, &bits, sizeof(res));
+
+    return res;
+}
+
+std::string BinaryModelReader::readString()
+{
+    auto size = readInteger();
+
+    if (size > mInput.size() - mPosition) {
+        invalidate("Binary model is truncated.");
+
+        return "";
+    }
+
+    auto res = mInput.substr(mPosition, size);
+
+    mPosition += size;
+
+    return res;
+}
+
+template<typename T>
+T BinaryModelReader::entity(const std::vector<T> &entities, uint64_t index)
+{
+    if ((index == 0) || (index > entities.size())) {
+        invalidate("Binary model contains an invalid reference.");
+
+        return nullptr;
+    }
+
+    return entities[index - 1];
+}
+
+UnitsPtr BinaryModelReader::readUnits()
+{
+    auto units = Units::create(readString());
+
+    units->setId(readString());
+    units->setImportReference(readString());
+
+    for (auto count = readCount(); count > 0; --count) {
+        auto reference = readString();
+        auto prefix = readString();
+        auto exponent = readDouble();
+        auto multiplier = readDouble();
+        auto id = readString();
+
+        units->addUnit(reference, prefix, exponent, multiplier, id);
+    }
+
+    return units;
+}
+
+VariablePtr BinaryModelReader::readVariable()
+{
+    auto variable = Variable::create(readString());
+
+    variable->setId(readString());
+
+    auto unitsIndex = readInteger();
+
+    if (unitsIndex == 1) {
+        variable->setUnits(readString());
+    } else if (unitsIndex > 1) {
+        variable->setUnits(entity(mUnits, unitsIndex - 1));
+    }
+
+    variable->setInitialValue(readString());
+    variable->setInterfaceType(readString());
+
+    mVariables.push_back(variable);
+
+    return variable;
+}
+
+ResetPtr BinaryModelReader::readReset()
+{
+    auto reset = Reset::create();
+
+    reset->setId(readString());
+
+    if (readInteger() != 0) {
+        reset->setOrder(int(readSignedInteger()));
+    }
+
+    auto variableIndex = readInteger();
+    auto testVariableIndex = readInteger();
+
+    mPendingResets.push_back({reset, variableIndex, testVariableIndex});
+
+    reset->setTestValue(readString());
+    reset->setTestValueId(readString());
+    reset->setResetValue(readString());
+    reset->setResetValueId(readString());
+
+    return reset;
+}
+
+ComponentPtr BinaryModelReader::readComponent(size_t depth)
+{
+    if (depth > MAX_ENCAPSULATION_DEPTH) {
+        invalidate("Binary model has components nested more than " + std::to_string(MAX_ENCAPSULATION_DEPTH) + " levels deep.");
+    }
+
+    auto component = Component::create(readString());
+
+    mComponents.push_back(component);
+
+    component->setId(readString());
+    component->setEncapsulationId(readString());
+    component->setImportReference(readString());
+
+    std::vector<VariablePtr> variables(readCount());
+
+    for (auto &variable : variables) {
+        variable = readVariable();
+    }
+
+    component->addVariables(variables);
+
+    for (auto count = readCount(); count > 0; --count) {
+        component->addReset(readReset());
+    }
+
+    component->setMath(readString());
+
+    for (auto count = readCount(); count > 0; --count) {
+        component->addComponent(readComponent(depth + 1));
+    }
+
+    return component;
+}
+
+void BinaryModelReader::readImportSourceEntities(const ImportSourcePtr &importSource)
+{
+    for (auto count = readCount(); count > 0; --count) {
+        auto kind = readInteger();
+        auto index = readInteger();
+
+        if (kind == IMPORTED_COMPONENT) {
+            auto component = entity(mComponents, index);
+
+            if (component != nullptr) {
+                component->setImportSource(importSource);
+            }
+        } else if (kind == IMPORTED_UNITS) {
+            auto units = entity(mUnits, index);
+
+            if (units != nullptr) {
+                units->setImportSource(importSource);
+            }
+        } else {
+            invalidate("Binary model contains an invalid imported entity.");
+        }
+    }
+}
+
+void BinaryModelReader::readEquivalences()
+{
+    for (auto count = readCount(); count > 0; --count) {
+        auto variable1 = entity(mVariables, readInteger());
+        auto variable2 = entity(mVariables, readInteger());
+        auto mappingId = readString();
+        auto connectionId = readString();
+
+        if ((variable1 != nullptr) && (variable2 != nullptr)) {
+            Variable::addEquivalence(variable1, variable2, mappingId, connectionId);
+        }
+    }
+}
+
+void BinaryModelReader::read(const ModelPtr &model)
+{
+    if (mInput.compare(0, BINARY_MODEL_SIGNATURE.size(), BINARY_MODEL_SIGNATURE) != 0) {
+        invalidate("Input is not a binary model.");
+
+        return;
+    }
+
+    mPosition = BINARY_MODEL_SIGNATURE.size();
+
+    auto version = readInteger();
+
+    if (isValid() && (version != BINARY_MODEL_VERSION)) {
+        invalidate("Binary model version " + std::to_string(version) + " is not supported.");
+
+        return;
+    }
+
+    model->setName(readString());
+    model->setId(readString());
+    model->setEncapsulationId(readString());
+
+    auto modelImportSourceCount = readCount();
+
+    for (auto count = readCount(); count > 0; --count) {
+        auto importSource = ImportSource::create();
+
+        importSource->setUrl(readString());
+        importSource->setId(readString());
+
+        if (mImportSources.size() < modelImportSourceCount) {
+            model->addImportSource(importSource);
+        }
+
+        mImportSources.push_back(importSource);
+    }
+
+    for (auto count = readCount(); count > 0; --count) {
+        auto units = readUnits();
+
+        model->addUnits(units);
+
+        mUnits.push_back(units);
+    }
+
+    for (auto count = readCount(); count > 0; --count) {
+        model->addComponent(readComponent(1));
+    }
+
+    for (const auto &importSource : mImportSources) {
+        readImportSourceEntities(importSource);
+    }
+
+    for (const auto &pendingReset : mPendingResets) {
+        if (pendingReset.mVariableIndex != 0) {
+            pendingReset.mReset->setVariable(entity(mVariables, pendingReset.mVariableIndex));
+        }
+
+        if (pendingReset.mTestVariableIndex != 0) {
+            pendingReset.mReset->setTestVariable(entity(mVariables, pendingReset.mTestVariableIndex));
+        }
+    }
+
+    readEquivalences();
+
+    if (isValid() && (mPosition != mInput.size())) {
+        invalidate("Binary model has unexpected trailing data.");
+    }
+}
+
+std::string writeBinaryModel(const ModelPtr &model)
+{
+    BinaryModelWriter writer;
+
+    writer.write(model);
+
+    return writer.mOutput;
+}
+
+bool readBinaryModel(const ModelPtr &model, const std::string &input, std::string &error)
+{
+    BinaryModelReader reader(input);
+
+    reader.read(model);
+
+    error = reader.mError;
+
+    return reader.isValid();
+}
+
+} // namespace libcellml
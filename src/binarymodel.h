@@ -0,0 +1,53 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief Serialise a model to the binary model format.
+ *
+ * Serialise the given @p model to the binary model format, a compact and
+ * versioned representation of everything that would be printed by
+ * @ref Printer::printModel. Imported models, i.e. the result of resolving
+ * imports, are not serialised.
+ *
+ * @param model The model to serialise.
+ *
+ * @return The binary representation of the model.
+ */
+std::string writeBinaryModel(const ModelPtr &model);
+
+/**
+ * @brief Populate a model from its binary representation.
+ *
+ * Populate the given, empty, @p model from the given binary representation,
+ * as produced by @ref writeBinaryModel.
+ *
+ * @param model The model to populate.
+ * @param input The binary representation of the model.
+ * @param error The reason why @p input could not be read, if it could not.
+ *
+ * @return @c true if @p input could be read, @c false otherwise.
+ */
+bool readBinaryModel(const ModelPtr &model, const std::string &input, std::string &error);
+
+} // namespace libcellml
@@ -3,6 +3,7 @@
 #define LIBCELLML_EXPORT
 
 %include <std_shared_ptr.i>
+%include <std_vector.i>
 
 %import "componententity.i"
 %import "createconstructor.i"
@@ -33,6 +34,16 @@ If `math` is an empty string, math will be removed from the component.";
 %feature("docstring") libcellml::Component::addVariable
 "Adds variable `variable` to this component.";
 
+%feature("docstring") libcellml::Component::addVariables
+"Adds the given variables to this component.
+
+Variables that are `None` or already in this component are skipped.
+
+Returns `True` if all the variables were added.";
+
+%feature("docstring") libcellml::Component::reserveVariables
+"Reserves space for the given number of variables in this component.";
+
 %feature("docstring") libcellml::Component::variable
 "Returns a Variable from this component, specified by name or index.
 
@@ -127,7 +138,11 @@ otherwise @c false.";
 # libCellML generated wrapper code starts here.
 %}
 
+%template(VariableVector) std::vector<libcellml::VariablePtr>;
+
 %create_constructor(Component)
 %create_name_constructor(Component)
 
+%ignore libcellml::Component::setMath(std::string &&);
+
 %include "libcellml/component.h"
@@ -43,6 +43,7 @@ unset).";
 %}
 
 %ignore libcellml::Entity::Entity();
+%ignore libcellml::Entity::setId(std::string &&);
 
 %typemap(out) libcellml::EntityPtr parent {
     auto isAModel = std::dynamic_pointer_cast<libcellml::Model>($1);
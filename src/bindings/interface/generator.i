@@ -7,6 +7,7 @@
 %import "analysermodel.i"
 %import "createconstructor.i"
 %import "generatorprofile.i"
+%import "logger.i"
 
 %feature("docstring") libcellml::Generator
 "Creates a :class:`Generator` object.";
@@ -29,6 +30,9 @@
 %feature("docstring") libcellml::Generator::implementationCode
 "Returns the implementation code.";
 
+%ignore libcellml::Generator::writeInterface;
+%ignore libcellml::Generator::writeImplementation;
+
 %{
 #include "libcellml/generator.h"
 %}
@@ -16,6 +16,13 @@
 %feature("docstring") libcellml::GeneratorProfile::setProfile
 "Sets the :enum:`GeneratorProfile::Profile` for this :class:`GeneratorProfile`.";
 
+%feature("docstring") libcellml::GeneratorProfile::precision
+"Returns the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`.";
+
+%feature("docstring") libcellml::GeneratorProfile::setPrecision
+"Sets the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`. Returns `False` if the profile
+does not support that precision, i.e. if it is not the C profile.";
+
 %feature("docstring") libcellml::GeneratorProfile::hasInterface
 "Tests if this :class:`GeneratorProfile` requires an interface.";
 
@@ -424,6 +431,18 @@
 %feature("docstring") libcellml::GeneratorProfile::setHasConditionalOperator
 "Sets whether this :class:`GeneratorProfile` has a \"conditional\" operator.";
 
+%feature("docstring") libcellml::GeneratorProfile::branchlessPiecewiseString
+"Returns the string representing the MathML \"piecewise\" statement in its branchless form.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBranchlessPiecewiseString
+"Sets the string representing the MathML \"piecewise\" statement in its branchless form.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasBranchlessPiecewise
+"Tests if this :class:`GeneratorProfile` generates \"piecewise\" statements in their branchless form.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasBranchlessPiecewise
+"Sets whether this :class:`GeneratorProfile` generates \"piecewise\" statements in their branchless form.";
+
 %feature("docstring") libcellml::GeneratorProfile::trueString
 "Returns the string representing the MathML \"true\" boolean.";
 
@@ -460,6 +479,18 @@
 %feature("docstring") libcellml::GeneratorProfile::setNanString
 "Sets the string representing the MathML \"not-a-number\" value.";
 
+%feature("docstring") libcellml::GeneratorProfile::realLiteralPrefixString
+"Returns the string for the prefix of a real literal.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRealLiteralPrefixString
+"Sets the string for the prefix of a real literal.";
+
+%feature("docstring") libcellml::GeneratorProfile::realLiteralSuffixString
+"Returns the string for the suffix of a real literal.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRealLiteralSuffixString
+"Sets the string for the suffix of a real literal.";
+
 %feature("docstring") libcellml::GeneratorProfile::eqFunctionString
 "Returns the string for the \"equal to\" function implementation.";
 
@@ -532,6 +563,12 @@
 %feature("docstring") libcellml::GeneratorProfile::setMaxFunctionString
 "Sets the string for the \"maximum\" function implementation.";
 
+%feature("docstring") libcellml::GeneratorProfile::blendFunctionString
+"Returns the string for the \"blend\" function implementation.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBlendFunctionString
+"Sets the string for the \"blend\" function implementation.";
+
 %feature("docstring") libcellml::GeneratorProfile::secFunctionString
 "Returns the string for the \"secant\" function implementation.";
 
@@ -637,6 +674,12 @@ used respectively.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationHeaderString
 "Sets the string for an implementation header.";
 
+%feature("docstring") libcellml::GeneratorProfile::implementationFooterString
+"Returns the string for an implementation footer.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationFooterString
+"Sets the string for an implementation footer.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceVersionString
 "Returns the string for the interface of the version constant.";
 
@@ -4,6 +4,7 @@
 
 %include <std_pair.i>
 %include <std_string.i>
+%include <std_vector.i>
 
 %import "createconstructor.i"
 %import "logger.i"
@@ -46,11 +47,59 @@ and False if the URL key does not exist."
 "Returns a string corresponding to the key at which a model is stored in the 
 library by index, or an empty string if the index is out of range."
 
+%feature("docstring") libcellml::Importer::setLazyResolution
+"Sets whether imports are to be resolved lazily, i.e. whether the model of an
+import source is only to be loaded the first time that it is needed."
+
+%feature("docstring") libcellml::Importer::lazyResolution
+"Returns whether imports are to be resolved lazily."
+
+%feature("docstring") libcellml::Importer::setCacheDirectory
+"Sets the existing directory where the models parsed when resolving imports
+are cached. A cached model is used instead of parsing a file with the same
+contents. An empty directory disables caching, which is the default."
+
+%feature("docstring") libcellml::Importer::cacheDirectory
+"Returns the directory where parsed imported models are cached, or an empty
+string if caching is disabled."
+
+%feature("docstring") libcellml::Importer::dependencies
+"Returns the keys of the models in the library that the model at the given key
+directly imports from."
+
+%feature("docstring") libcellml::Importer::dependants
+"Returns the keys of the models in the library that directly import from the
+model at the given key."
+
+%feature("docstring") libcellml::Importer::invalidate
+"Reads and parses again the model at the given key, resolves its imports,
+updates the import sources that used the old model to use the new one, and
+fetches again the entities that they import. Returns True if successful, and
+False otherwise."
+
+%feature("docstring") libcellml::Importer::setStatisticsEnabled
+"Sets whether statistics are recorded for the models in the library."
+
+%feature("docstring") libcellml::Importer::statisticsEnabled
+"Returns True if statistics are recorded for the models in the library, and
+False otherwise."
+
+%feature("docstring") libcellml::Importer::statisticsCount
+"Returns the number of models that statistics have been recorded for."
+
+%feature("docstring") libcellml::Importer::statistics
+"Returns the :class:`ImportStatistics` recorded for the model at the given key
+or index, or None if there are none."
+
+%feature("docstring") libcellml::Importer::removeAllStatistics
+"Removes all the recorded statistics."
+
 %{
 #include "libcellml/importer.h"
 %}
 
 %template(StringPair) std::pair<std::string, std::string>;
+%template() std::vector<std::string>;
 
 %pythoncode %{
 # libCellML generated wrapper code starts here.
@@ -58,5 +107,10 @@ library by index, or an empty string if the index is out of range."
 
 %create_constructor(Importer)
 
+%ignore libcellml::Importer::setLoader;
+%ignore libcellml::Importer::fileLoader;
+%ignore libcellml::Importer::memoryLoader;
+%ignore libcellml::Importer::archiveLoader;
+
 %include "libcellml/types.h"
 %include "libcellml/importer.h"
@@ -0,0 +1,48 @@
+%module(package="libcellml") importstatistics
+
+#define LIBCELLML_EXPORT
+
+%include <std_shared_ptr.i>
+%include <std_string.i>
+
+%import "types.i"
+
+%feature("docstring") libcellml::ImportStatistics
+"Statistics recorded by an :class:`Importer` for one of the models in its library.";
+
+%feature("docstring") libcellml::ImportStatistics::key
+"Returns the key of the model in the library of the importer.";
+
+%feature("docstring") libcellml::ImportStatistics::bytesRead
+"Returns the number of bytes read to get the model.";
+
+%feature("docstring") libcellml::ImportStatistics::parseTime
+"Returns the time, in seconds, spent parsing the model.";
+
+%feature("docstring") libcellml::ImportStatistics::cacheHitCount
+"Returns the number of times that the model was needed and found in the library.";
+
+%feature("docstring") libcellml::ImportStatistics::cacheMissCount
+"Returns the number of times that the model was needed and had to be read.";
+
+%feature("docstring") libcellml::ImportStatistics::componentCount
+"Returns the number of components imported from the model.";
+
+%feature("docstring") libcellml::ImportStatistics::unitsCount
+"Returns the number of units imported from the model.";
+
+%feature("docstring") libcellml::ImportStatistics::flattenTime
+"Returns the time, in seconds, spent flattening the components imported from the model.";
+
+%{
+#include "libcellml/importstatistics.h"
+%}
+
+%pythoncode %{
+# libCellML generated wrapper code starts here.
+%}
+
+%shared_ptr(libcellml::ImportStatistics);
+
+%include "libcellml/types.h"
+%include "libcellml/importstatistics.h"
@@ -51,6 +51,12 @@ Only the first matching Units is removed and returned.";
 %feature("docstring") libcellml::Model::hasUnresolvedImports
 "Tests if this model has unresolved imports.";
 
+%feature("docstring") libcellml::Model::componentByPath
+"Returns the component with the given path, e.g. \"component/subcomponent\" (or `None` if not found).";
+
+%feature("docstring") libcellml::Model::variableByPath
+"Returns the variable with the given path, e.g. \"component/subcomponent/variable\" (or `None` if not found).";
+
 %feature("docstring") libcellml::Model::clone
 "Create a copy of this model.";
 
@@ -23,5 +23,6 @@
 %}
 
 %ignore libcellml::NamedEntity::NamedEntity();
+%ignore libcellml::NamedEntity::setName(std::string &&);
 
 %include "libcellml/namedentity.h"
@@ -24,5 +24,7 @@
 
 %create_constructor(Parser)
 
+%ignore libcellml::Parser::parseBinaryModel;
+
 %include "libcellml/types.h"
 %include "libcellml/parser.h"
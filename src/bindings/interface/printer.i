@@ -23,4 +23,8 @@
 
 %create_constructor(Printer)
 
+%ignore libcellml::Printer::printBinaryModel;
+%ignore libcellml::Printer::printModel(const ModelPtr &, std::ostream &, bool) const;
+%ignore libcellml::Printer::printModel(const ModelPtr &, std::ostream &) const;
+
 %include "libcellml/printer.h"
@@ -94,5 +94,8 @@
 
 %create_constructor(Reset)
 
+%ignore libcellml::Reset::setTestValue(std::string &&);
+%ignore libcellml::Reset::setResetValue(std::string &&);
+
 %include "libcellml/types.h"
 %include "libcellml/reset.h"
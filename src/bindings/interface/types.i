@@ -25,6 +25,7 @@ Provides support for shared pointers declared in types.h.
 %shared_ptr(libcellml::GeneratorProfile)
 %shared_ptr(libcellml::Importer)
 %shared_ptr(libcellml::ImportSource)
+%shared_ptr(libcellml::ImportStatistics)
 %shared_ptr(libcellml::ImportedEntity)
 %shared_ptr(libcellml::Issue)
 %shared_ptr(libcellml::Logger)
@@ -98,7 +99,19 @@ Provides support for shared pointers declared in types.h.
   if (!SWIG_IsOK(ecode)) {
     %argument_fail(ecode, "$type", $symname, $argnum);
   } else {
-    if (val < %static_cast($type::C, int) || %static_cast($type::PYTHON, int) < val) {
+    if (val < %static_cast($type::C, int) || %static_cast($type::CXX, int) < val) {
+      %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
+    }
+    $1 = %static_cast(val, $basetype);
+  }
+}
+
+%typemap(in) libcellml::GeneratorProfile::Precision (int val, int ecode) {
+  ecode = SWIG_AsVal(int)($input, &val);
+  if (!SWIG_IsOK(ecode)) {
+    %argument_fail(ecode, "$type", $symname, $argnum);
+  } else {
+    if (val < %static_cast($type::DOUBLE, int) || %static_cast($type::MIXED, int) < val) {
       %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
     }
     $1 = %static_cast(val, $basetype);
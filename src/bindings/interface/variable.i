@@ -120,5 +120,7 @@ not equivalent the connection id is not set.";
 %create_constructor(Variable)
 %create_name_constructor(Variable)
 
+%ignore libcellml::Variable::setInitialValue(std::string &&);
+
 %include "libcellml/types.h"
 %include "libcellml/variable.h"
@@ -22,6 +22,7 @@ from libcellml.generator import Generator
 from libcellml.generatorprofile import GeneratorProfile
 from libcellml.importer import Importer
 from libcellml.importsource import ImportSource
+from libcellml.importstatistics import ImportStatistics
 from libcellml.issue import Issue
 from libcellml.model import Model
 from libcellml.parser import Parser
@@ -170,6 +171,13 @@ convert(AnalyserVariable, 'Type', [
 convert(GeneratorProfile, 'Profile', [
     'C',
     'PYTHON',
+    'C_SIMD',
+    'CXX',
+])
+convert(GeneratorProfile, 'Precision', [
+    'DOUBLE',
+    'SINGLE',
+    'MIXED',
 ])
 convert(Issue, 'Cause', [
     'COMPONENT',
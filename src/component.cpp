@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "libcellml/importsource.h"
@@ -26,6 +27,7 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
+#include "namedentity_p.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -39,9 +41,10 @@ namespace libcellml {
  */
 struct Component::ComponentImpl
 {
-    std::string mMath;
+    SharedString mMath;
     std::vector<ResetPtr> mResets;
     std::vector<VariablePtr> mVariables;
+    NameIndex mVariableNameIndex;
 
     std::vector<ResetPtr>::iterator findReset(const ResetPtr &reset);
     std::vector<VariablePtr>::iterator findVariable(const std::string &name);
@@ -50,8 +53,7 @@ struct Component::ComponentImpl
 
 std::vector<VariablePtr>::iterator Component::ComponentImpl::findVariable(const std::string &name)
 {
-    return std::find_if(mVariables.begin(), mVariables.end(),
-                        [=](const VariablePtr &v) -> bool { return v->name() == name; });
+    return mVariableNameIndex.find(mVariables, name);
 }
 
 std::vector<VariablePtr>::iterator Component::ComponentImpl::findVariable(const VariablePtr &variable)
@@ -69,11 +71,13 @@ std::vector<ResetPtr>::iterator Component::ComponentImpl::findReset(const ResetP
 Component::Component()
     : mPimpl(new ComponentImpl())
 {
+    mPimpl->mVariableNameIndex.mOwnerNameRevision = &childNameRevision(this);
 }
 
 Component::Component(const std::string &name)
     : mPimpl(new ComponentImpl())
 {
+    mPimpl->mVariableNameIndex.mOwnerNameRevision = &childNameRevision(this);
     setName(name);
 }
 
@@ -89,12 +93,27 @@ Component::~Component()
 
 ComponentPtr Component::create() noexcept
 {
-    return std::shared_ptr<Component> {new Component {}};
+    // A local class can call our private constructor, so std::make_shared()
+    // can allocate it together with its control block.
+
+    struct ComponentInstance: public Component
+    {
+    };
+
+    return std::make_shared<ComponentInstance>();
 }
 
 ComponentPtr Component::create(const std::string &name) noexcept
 {
-    return std::shared_ptr<Component> {new Component {name}};
+    struct ComponentInstance: public Component
+    {
+        explicit ComponentInstance(const std::string &name)
+            : Component(name)
+        {
+        }
+    };
+
+    return std::make_shared<ComponentInstance>(name);
 }
 
 bool Component::doAddComponent(const ComponentPtr &component)
@@ -155,14 +174,19 @@ void Component::appendMath(const std::string &math)
     mPimpl->mMath.append(math);
 }
 
-std::string Component::math() const
+const std::string &Component::math() const
 {
-    return mPimpl->mMath;
+    return mPimpl->mMath.value();
 }
 
 void Component::setMath(const std::string &math)
 {
-    mPimpl->mMath = math;
+    mPimpl->mMath.set(math);
+}
+
+void Component::setMath(std::string &&math)
+{
+    mPimpl->mMath.set(std::move(math));
 }
 
 void Component::removeMath()
@@ -189,15 +213,64 @@ bool Component::addVariable(const VariablePtr &variable)
     }
 
     mPimpl->mVariables.push_back(variable);
+    mPimpl->mVariableNameIndex.add(variable->name(), mPimpl->mVariables.size() - 1);
+    updateStructureRevision(this);
     variable->setParent(shared_from_this());
     return true;
 }
 
+bool Component::addVariables(const std::vector<VariablePtr> &variables)
+{
+    // Check for variables that are already in this component only once, rather
+    // than once per variable as addVariable() would do.
+
+    std::unordered_set<const Variable *> existingVariables;
+
+    existingVariables.reserve(mPimpl->mVariables.size() + variables.size());
+
+    for (const auto &variable : mPimpl->mVariables) {
+        existingVariables.insert(variable.get());
+    }
+
+    mPimpl->mVariables.reserve(mPimpl->mVariables.size() + variables.size());
+
+    bool status = true;
+    auto thisComponent = shared_from_this();
+
+    for (const auto &variable : variables) {
+        if ((variable == nullptr) || !existingVariables.insert(variable.get()).second) {
+            status = false;
+            continue;
+        }
+
+        // Prevent adding to multiple components.
+        if (variable->hasParent()) {
+            auto otherParent = std::dynamic_pointer_cast<Component>(variable->parent());
+            otherParent->removeVariable(variable);
+        }
+
+        mPimpl->mVariables.push_back(variable);
+        mPimpl->mVariableNameIndex.add(variable->name(), mPimpl->mVariables.size() - 1);
+        variable->setParent(thisComponent);
+    }
+
+    updateStructureRevision(this);
+
+    return status;
+}
+
+void Component::reserveVariables(size_t count)
+{
+    mPimpl->mVariables.reserve(count);
+}
+
 bool Component::removeVariable(size_t index)
 {
     if (index < mPimpl->mVariables.size()) {
         auto variable = mPimpl->mVariables[index];
         mPimpl->mVariables.erase(mPimpl->mVariables.begin() + int64_t(index));
+        mPimpl->mVariableNameIndex.invalidate();
+        updateStructureRevision(this);
         variable->removeParent();
         return true;
     }
@@ -211,6 +284,8 @@ bool Component::removeVariable(const std::string &name)
     if (result != mPimpl->mVariables.end()) {
         (*result)->removeParent();
         mPimpl->mVariables.erase(result);
+        mPimpl->mVariableNameIndex.invalidate();
+        updateStructureRevision(this);
         return true;
     }
 
@@ -222,6 +297,8 @@ bool Component::removeVariable(const VariablePtr &variable)
     auto result = mPimpl->findVariable(variable);
     if (result != mPimpl->mVariables.end()) {
         mPimpl->mVariables.erase(result);
+        mPimpl->mVariableNameIndex.invalidate();
+        updateStructureRevision(this);
         variable->removeParent();
         return true;
     }
@@ -235,6 +312,8 @@ void Component::removeAllVariables()
         variable->removeParent();
     }
     mPimpl->mVariables.clear();
+    mPimpl->mVariableNameIndex.invalidate();
+    updateStructureRevision(this);
 }
 
 VariablePtr Component::variable(size_t index) const
@@ -394,7 +473,7 @@ ComponentPtr Component::clone() const
 
     c->setId(id());
     c->setName(name());
-    c->setMath(math());
+    c->mPimpl->mMath = mPimpl->mMath;
 
     if (isImport()) {
         auto imp = importSource()->clone();
@@ -23,6 +23,9 @@ limitations under the License.
 #include "libcellml/component.h"
 #include "libcellml/units.h"
 
+#include "namedentity_p.h"
+#include "utilities.h"
+
 namespace libcellml {
 
 /**
@@ -35,6 +38,7 @@ namespace libcellml {
 struct ComponentEntity::ComponentEntityImpl
 {
     std::vector<ComponentPtr> mComponents;
+    NameIndex mComponentNameIndex;
     std::string mEncapsulationId;
 
     std::vector<ComponentPtr>::iterator findComponent(const std::string &name);
@@ -43,8 +47,7 @@ struct ComponentEntity::ComponentEntityImpl
 
 std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findComponent(const std::string &name)
 {
-    return std::find_if(mComponents.begin(), mComponents.end(),
-                        [=](const ComponentPtr &c) -> bool { return c->name() == name; });
+    return mComponentNameIndex.find(mComponents, name);
 }
 
 std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findComponent(const ComponentPtr &component)
@@ -57,6 +60,7 @@ std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findCo
 ComponentEntity::ComponentEntity()
     : mPimpl(new ComponentEntityImpl())
 {
+    mPimpl->mComponentNameIndex.mOwnerNameRevision = &childNameRevision(this);
 }
 
 ComponentEntity::~ComponentEntity()
@@ -75,6 +79,8 @@ bool ComponentEntity::addComponent(const ComponentPtr &component)
 bool ComponentEntity::doAddComponent(const ComponentPtr &component)
 {
     mPimpl->mComponents.push_back(component);
+    mPimpl->mComponentNameIndex.add(component->name(), mPimpl->mComponents.size() - 1);
+    updateStructureRevision(this);
     return true;
 }
 
@@ -85,6 +91,8 @@ bool ComponentEntity::removeComponent(const std::string &name, bool searchEncaps
     if (result != mPimpl->mComponents.end()) {
         (*result)->removeParent();
         mPimpl->mComponents.erase(result);
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -101,6 +109,8 @@ bool ComponentEntity::removeComponent(size_t index)
     if (index < mPimpl->mComponents.size()) {
         auto component = mPimpl->mComponents[index];
         mPimpl->mComponents.erase(mPimpl->mComponents.begin() + int64_t(index));
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         component->removeParent();
         status = true;
     }
@@ -115,6 +125,8 @@ bool ComponentEntity::removeComponent(const ComponentPtr &component, bool search
     if (result != mPimpl->mComponents.end()) {
         (*result)->removeParent();
         mPimpl->mComponents.erase(result);
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -131,6 +143,8 @@ void ComponentEntity::removeAllComponents()
         component->removeParent();
     }
     mPimpl->mComponents.clear();
+    mPimpl->mComponentNameIndex.invalidate();
+    updateStructureRevision(this);
 }
 
 size_t ComponentEntity::componentCount() const
@@ -199,6 +213,8 @@ ComponentPtr ComponentEntity::takeComponent(size_t index)
     if (index < mPimpl->mComponents.size()) {
         component = mPimpl->mComponents.at(index);
         mPimpl->mComponents.erase(mPimpl->mComponents.begin() + int64_t(index));
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         component->removeParent();
     }
 
@@ -212,6 +228,8 @@ ComponentPtr ComponentEntity::takeComponent(const std::string &name, bool search
     if (result != mPimpl->mComponents.end()) {
         foundComponent = *result;
         mPimpl->mComponents.erase(result);
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         foundComponent->removeParent();
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
@@ -232,6 +250,8 @@ bool ComponentEntity::replaceComponent(size_t index, const ComponentPtr &compone
     }
     if (removeComponent(index)) {
         mPimpl->mComponents.insert(mPimpl->mComponents.begin() + int64_t(index), component);
+        mPimpl->mComponentNameIndex.invalidate();
+        updateStructureRevision(this);
         component->setParent(parent);
         status = true;
     }
@@ -50,7 +50,12 @@ void Entity::setId(const std::string &id)
     mPimpl->mId = id;
 }
 
-std::string Entity::id() const
+void Entity::setId(std::string &&id)
+{
+    mPimpl->mId = std::move(id);
+}
+
+const std::string &Entity::id() const
 {
     return mPimpl->mId;
 }
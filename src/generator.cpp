@@ -16,6 +16,9 @@ limitations under the License.
 
 #include "libcellml/generator.h"
 
+#include <algorithm>
+#include <functional>
+#include <ostream>
 #include <regex>
 #include <sstream>
 
@@ -25,7 +28,9 @@ limitations under the License.
 #include "libcellml/analyservariable.h"
 #include "libcellml/component.h"
 #include "libcellml/generatorprofile.h"
+#include "libcellml/issue.h"
 #include "libcellml/units.h"
+#include "libcellml/variable.h"
 #include "libcellml/version.h"
 
 #include "analyserequationast_p.h"
@@ -40,6 +45,196 @@ namespace libcellml {
 using AnalyserModelWeakPtr = std::weak_ptr<AnalyserModel>; /**< Type definition for weak analyser model pointer. */
 using GeneratorProfileWeakPtr = std::weak_ptr<GeneratorProfile>; /**< Type definition for weak generator profile pointer. */
 
+struct GeneratorCode
+{
+    std::ostream *mStream = nullptr;
+    size_t mSize = 0;
+
+    void reset(std::ostream &stream);
+
+    bool empty() const;
+    size_t size() const;
+
+    GeneratorCode &operator+=(const std::string &code);
+};
+
+void GeneratorCode::reset(std::ostream &stream)
+{
+    mStream = &stream;
+    mSize = 0;
+}
+
+bool GeneratorCode::empty() const
+{
+    return mSize == 0;
+}
+
+size_t GeneratorCode::size() const
+{
+    return mSize;
+}
+
+GeneratorCode &GeneratorCode::operator+=(const std::string &code)
+{
+    *mStream << code;
+
+    mSize += code.size();
+
+    return *this;
+}
+
+struct GeneratorTemplate
+{
+    std::vector<std::string> mChunks = {""};
+    std::vector<size_t> mPlaceholders;
+
+    GeneratorTemplate() = default;
+    explicit GeneratorTemplate(const std::string &string,
+                               const std::vector<std::string> &placeholders);
+
+    void write(GeneratorCode &code,
+               const std::function<void(size_t)> &writePlaceholder) const;
+    void write(GeneratorCode &code,
+               const std::vector<std::string> &values) const;
+
+    std::string generate(const std::vector<std::string> &values) const;
+};
+
+GeneratorTemplate::GeneratorTemplate(const std::string &string,
+                                     const std::vector<std::string> &placeholders)
+{
+    // Split the given string, once and for all, around the first occurrence of
+    // each of the given placeholders. A placeholder that cannot be found is
+    // simply never written.
+
+    std::vector<std::pair<size_t, size_t>> positions;
+
+    for (size_t i = 0; i < placeholders.size(); ++i) {
+        auto position = string.find(placeholders[i]);
+
+        if (position != std::string::npos) {
+            positions.emplace_back(position, i);
+        }
+    }
+
+    std::sort(positions.begin(), positions.end());
+
+    size_t start = 0;
+
+    mChunks.clear();
+
+    for (const auto &position : positions) {
+        if (position.first >= start) {
+            mChunks.push_back(string.substr(start, position.first - start));
+            mPlaceholders.push_back(position.second);
+
+            start = position.first + placeholders[position.second].size();
+        }
+    }
+
+    mChunks.push_back(string.substr(start));
+}
+
+void GeneratorTemplate::write(GeneratorCode &code,
+                              const std::function<void(size_t)> &writePlaceholder) const
+{
+    for (size_t i = 0; i < mPlaceholders.size(); ++i) {
+        code += mChunks[i];
+
+        writePlaceholder(mPlaceholders[i]);
+    }
+
+    code += mChunks.back();
+}
+
+void GeneratorTemplate::write(GeneratorCode &code,
+                              const std::vector<std::string> &values) const
+{
+    write(code, [&](size_t placeholder) {
+        code += values[placeholder];
+    });
+}
+
+std::string GeneratorTemplate::generate(const std::vector<std::string> &values) const
+{
+    std::string res;
+
+    for (size_t i = 0; i < mPlaceholders.size(); ++i) {
+        res += mChunks[i];
+        res += values[mPlaceholders[i]];
+    }
+
+    return res + mChunks.back();
+}
+
+struct GeneratorTemplates
+{
+    GeneratorTemplate mComment;
+    GeneratorTemplate mOriginComment;
+    GeneratorTemplate mImplementationHeader;
+    GeneratorTemplate mImplementationLibcellmlVersion;
+    GeneratorTemplate mImplementationStateCount;
+    GeneratorTemplate mImplementationVariableCount;
+    GeneratorTemplate mVariableTypeObject;
+    GeneratorTemplate mVariableInfoObject;
+    GeneratorTemplate mVariableInfoWithTypeObject;
+    GeneratorTemplate mImplementationVoiInfo;
+    GeneratorTemplate mImplementationStateInfo;
+    GeneratorTemplate mImplementationVariableInfo;
+    GeneratorTemplate mVariableInfoEntry;
+    GeneratorTemplate mVariableInfoWithTypeEntry;
+    GeneratorTemplate mPiecewiseIf;
+    GeneratorTemplate mPiecewiseElse;
+    GeneratorTemplate mBranchlessPiecewise;
+    GeneratorTemplate mExternalVariableMethodCall;
+    GeneratorTemplate mInterfaceComputeRatesMethod;
+    GeneratorTemplate mInterfaceComputeVariablesMethod;
+    GeneratorTemplate mImplementationInitialiseStatesAndConstantsMethod;
+    GeneratorTemplate mImplementationComputeComputedConstantsMethod;
+    GeneratorTemplate mImplementationComputeRatesMethod;
+    GeneratorTemplate mImplementationComputeVariablesMethod;
+
+    void load(const GeneratorProfilePtr &profile);
+};
+
+void GeneratorTemplates::load(const GeneratorProfilePtr &profile)
+{
+    // Split, once and for all, the profile strings that have placeholders.
+
+    static const std::vector<std::string> VARIABLE_INFO_OBJECT_PLACEHOLDERS = {"<COMPONENT_SIZE>", "<NAME_SIZE>", "<UNITS_SIZE>"};
+
+    mComment = GeneratorTemplate(profile->commentString(), {"<CODE>"});
+    mOriginComment = GeneratorTemplate(profile->originCommentString(), {"<PROFILE_INFORMATION>", "<LIBCELLML_VERSION>"});
+    mImplementationHeader = GeneratorTemplate(profile->implementationHeaderString(), {"<INTERFACE_FILE_NAME>"});
+    mImplementationLibcellmlVersion = GeneratorTemplate(profile->implementationLibcellmlVersionString(), {"<LIBCELLML_VERSION>"});
+    mImplementationStateCount = GeneratorTemplate(profile->implementationStateCountString(), {"<STATE_COUNT>"});
+    mImplementationVariableCount = GeneratorTemplate(profile->implementationVariableCountString(), {"<VARIABLE_COUNT>"});
+    mVariableTypeObject = GeneratorTemplate(profile->variableTypeObjectString(), {"<OPTIONAL_TYPE>"});
+    mVariableInfoObject = GeneratorTemplate(profile->variableInfoObjectString(), VARIABLE_INFO_OBJECT_PLACEHOLDERS);
+    mVariableInfoWithTypeObject = GeneratorTemplate(profile->variableInfoWithTypeObjectString(), VARIABLE_INFO_OBJECT_PLACEHOLDERS);
+    mImplementationVoiInfo = GeneratorTemplate(profile->implementationVoiInfoString(), {"<CODE>"});
+    mImplementationStateInfo = GeneratorTemplate(profile->implementationStateInfoString(), {"<CODE>"});
+    mImplementationVariableInfo = GeneratorTemplate(profile->implementationVariableInfoString(), {"<CODE>"});
+    mVariableInfoEntry = GeneratorTemplate(profile->variableInfoEntryString(), {"<NAME>", "<UNITS>", "<COMPONENT>"});
+    mVariableInfoWithTypeEntry = GeneratorTemplate(profile->variableInfoWithTypeEntryString(), {"<NAME>", "<UNITS>", "<COMPONENT>", "<TYPE>"});
+    mPiecewiseIf = GeneratorTemplate(profile->hasConditionalOperator() ?
+                                         profile->conditionalOperatorIfString() :
+                                         profile->piecewiseIfString(),
+                                     {"<CONDITION>", "<IF_STATEMENT>"});
+    mPiecewiseElse = GeneratorTemplate(profile->hasConditionalOperator() ?
+                                           profile->conditionalOperatorElseString() :
+                                           profile->piecewiseElseString(),
+                                       {"<ELSE_STATEMENT>"});
+    mBranchlessPiecewise = GeneratorTemplate(profile->branchlessPiecewiseString(), {"<CONDITION>", "<IF_STATEMENT>", "<ELSE_STATEMENT>"});
+    mExternalVariableMethodCall = GeneratorTemplate(profile->externalVariableMethodCallString(), {"<INDEX>"});
+    mInterfaceComputeRatesMethod = GeneratorTemplate(profile->interfaceComputeRatesMethodString(), {"<OPTIONAL_PARAMETER>"});
+    mInterfaceComputeVariablesMethod = GeneratorTemplate(profile->interfaceComputeVariablesMethodString(), {"<OPTIONAL_PARAMETER>"});
+    mImplementationInitialiseStatesAndConstantsMethod = GeneratorTemplate(profile->implementationInitialiseStatesAndConstantsMethodString(), {"<CODE>"});
+    mImplementationComputeComputedConstantsMethod = GeneratorTemplate(profile->implementationComputeComputedConstantsMethodString(), {"<CODE>"});
+    mImplementationComputeRatesMethod = GeneratorTemplate(profile->implementationComputeRatesMethodString(), {"<OPTIONAL_PARAMETER>", "<CODE>"});
+    mImplementationComputeVariablesMethod = GeneratorTemplate(profile->implementationComputeVariablesMethodString(), {"<OPTIONAL_PARAMETER>", "<CODE>"});
+}
+
 /**
  * @brief The Generator::GeneratorImpl struct.
  *
@@ -52,11 +247,16 @@ struct Generator::GeneratorImpl
     AnalyserModelWeakPtr mModel;
     AnalyserModelPtr mLockedModel;
 
-    std::string mCode;
+    GeneratorCode mCode;
 
     GeneratorProfilePtr mOwnedProfile = libcellml::GeneratorProfile::create();
     GeneratorProfileWeakPtr mProfile;
     GeneratorProfilePtr mLockedProfile;
+    GeneratorTemplates mTemplates;
+
+    bool mNeedMinFunction = false;
+    bool mNeedMaxFunction = false;
+    bool mNeedBlendFunction = false;
 
     bool retrieveLockedModelAndProfile();
     void resetLockedModelAndProfile();
@@ -78,6 +278,12 @@ struct Generator::GeneratorImpl
     bool isRootOperator(const AnalyserEquationAstPtr &ast) const;
     bool isPiecewiseStatement(const AnalyserEquationAstPtr &ast) const;
 
+    bool areEquivalentAsts(const AnalyserEquationAstPtr &ast1,
+                           const AnalyserEquationAstPtr &ast2) const;
+    AnalyserEquationAst::Type branchlessPiecewiseType(const AnalyserEquationAstPtr &ast) const;
+    void updateBranchlessPiecewiseFunctionNeeds(const AnalyserEquationAstPtr &ast);
+    void updateBranchlessPiecewiseFunctionNeeds();
+
     void updateVariableInfoSizes(size_t &componentSize, size_t &nameSize,
                                  size_t &unitsSize,
                                  const AnalyserVariablePtr &variable) const;
@@ -88,6 +294,7 @@ struct Generator::GeneratorImpl
 
     void addInterfaceHeaderCode();
     void addImplementationHeaderCode();
+    void addImplementationFooterCode();
 
     void addVersionAndLibcellmlVersionCode(bool interface = false);
 
@@ -95,15 +302,11 @@ struct Generator::GeneratorImpl
 
     void addVariableTypeObjectCode();
 
-    std::string generateVariableInfoObjectCode(const std::string &objectString) const;
+    std::string generateVariableInfoObjectCode(const GeneratorTemplate &objectTemplate) const;
 
     void addVariableInfoObjectCode();
     void addVariableInfoWithTypeObjectCode();
 
-    std::string generateVariableInfoEntryCode(const std::string &name,
-                                              const std::string &units,
-                                              const std::string &component) const;
-
     void addInterfaceVoiStateAndVariableInfoCode();
     void addImplementationVoiInfoCode();
     void addImplementationStateInfoCode();
@@ -118,7 +321,7 @@ struct Generator::GeneratorImpl
     void addImplementationCreateVariablesArrayMethodCode();
     void addImplementationDeleteArrayMethodCode();
 
-    std::string generateMethodBodyCode(const std::string &methodBody) const;
+    void addEmptyMethodBodyCode(size_t methodBodyStart);
 
     std::string generateDoubleCode(const std::string &value) const;
     std::string generateDoubleOrConstantVariableNameCode(const VariablePtr &variable) const;
@@ -135,18 +338,24 @@ struct Generator::GeneratorImpl
     std::string generatePiecewiseIfCode(const std::string &condition,
                                         const std::string &value) const;
     std::string generatePiecewiseElseCode(const std::string &value) const;
+    std::string generateBranchlessPiecewiseCode(const AnalyserEquationAstPtr &ast) const;
     std::string generateCode(const AnalyserEquationAstPtr &ast) const;
 
     std::string generateInitializationCode(const AnalyserVariablePtr &variable) const;
-    std::string generateEquationCode(const AnalyserEquationPtr &equation,
-                                     std::vector<AnalyserEquationPtr> &remainingEquations,
-                                     bool onlyStateRateBasedEquations = false) const;
+    void addEquationCode(const AnalyserEquationPtr &equation,
+                         std::vector<AnalyserEquationPtr> &remainingEquations,
+                         bool onlyStateRateBasedEquations = false);
 
     void addInterfaceComputeModelMethodsCode();
     void addImplementationInitialiseStatesAndConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
     void addImplementationComputeComputedConstantsMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
     void addImplementationComputeRatesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
     void addImplementationComputeVariablesMethodCode(std::vector<AnalyserEquationPtr> &remainingEquations);
+
+    void addExternalVariableIssues();
+
+    void writeInterface(std::ostream &stream);
+    void writeImplementation(std::ostream &stream);
 };
 
 bool Generator::GeneratorImpl::retrieveLockedModelAndProfile()
@@ -154,7 +363,13 @@ bool Generator::GeneratorImpl::retrieveLockedModelAndProfile()
     mLockedModel = mGenerator->model();
     mLockedProfile = mGenerator->profile();
 
-    return (mLockedModel != nullptr) && (mLockedProfile != nullptr);
+    if ((mLockedModel == nullptr) || (mLockedProfile == nullptr)) {
+        return false;
+    }
+
+    mTemplates.load(mLockedProfile);
+
+    return true;
 }
 
 void Generator::GeneratorImpl::resetLockedModelAndProfile()
@@ -280,8 +495,133 @@ bool Generator::GeneratorImpl::isRootOperator(const AnalyserEquationAstPtr &ast)
 
 bool Generator::GeneratorImpl::isPiecewiseStatement(const AnalyserEquationAstPtr &ast) const
 {
+    // Note: the branchless form of a piecewise statement is a function call,
+    //       so it never needs to be put between parentheses.
+
     return (ast->type() == AnalyserEquationAst::Type::PIECEWISE)
-           && mLockedProfile->hasConditionalOperator();
+           && mLockedProfile->hasConditionalOperator()
+           && !mLockedProfile->hasBranchlessPiecewise();
+}
+
+bool Generator::GeneratorImpl::areEquivalentAsts(const AnalyserEquationAstPtr &ast1,
+                                                 const AnalyserEquationAstPtr &ast2) const
+{
+    // Check whether the two given ASTs are structurally the same, i.e. whether
+    // they would result in the same code being generated.
+
+    if ((ast1 == nullptr) || (ast2 == nullptr)) {
+        return ast1 == ast2;
+    }
+
+    if ((ast1->type() != ast2->type())
+        || (ast1->value() != ast2->value())) {
+        return false;
+    }
+
+    if (ast1->type() == AnalyserEquationAst::Type::CI) {
+        if (!mLockedModel->areEquivalentVariables(ast1->variable(), ast2->variable())
+            || ((ast1->parent()->type() == AnalyserEquationAst::Type::DIFF)
+                != (ast2->parent()->type() == AnalyserEquationAst::Type::DIFF))) {
+            return false;
+        }
+    }
+
+    return areEquivalentAsts(ast1->leftChild(), ast2->leftChild())
+           && areEquivalentAsts(ast1->rightChild(), ast2->rightChild());
+}
+
+AnalyserEquationAst::Type Generator::GeneratorImpl::branchlessPiecewiseType(const AnalyserEquationAstPtr &ast) const
+{
+    // Determine whether the given piecewise statement selects the minimum or
+    // the maximum of two values, i.e. whether it is of the form:
+    //     x if x < y (or x <= y, y > x, y >= x) otherwise y
+    // or:
+    //     x if x > y (or x >= y, y < x, y <= x) otherwise y
+    // If so, then it can be generated using the "min" or "max" function with x
+    // and y as parameters, and this with the same semantics as our piecewise
+    // statement, including when x and/or y is NaN. Otherwise, it needs to be
+    // generated using the branchless "piecewise" string.
+
+    auto piece = ast->leftChild();
+    auto otherwise = ast->rightChild();
+
+    if ((otherwise == nullptr)
+        || (otherwise->type() != AnalyserEquationAst::Type::OTHERWISE)) {
+        return AnalyserEquationAst::Type::PIECEWISE;
+    }
+
+    auto condition = piece->rightChild();
+    auto conditionType = condition->type();
+    bool lowerThan = (conditionType == AnalyserEquationAst::Type::LT)
+                     || (conditionType == AnalyserEquationAst::Type::LEQ);
+    bool greaterThan = (conditionType == AnalyserEquationAst::Type::GT)
+                       || (conditionType == AnalyserEquationAst::Type::GEQ);
+
+    if (!lowerThan && !greaterThan) {
+        return AnalyserEquationAst::Type::PIECEWISE;
+    }
+
+    auto ifValue = piece->leftChild();
+    auto elseValue = otherwise->leftChild();
+
+    if (areEquivalentAsts(ifValue, condition->leftChild())
+        && areEquivalentAsts(elseValue, condition->rightChild())) {
+        return lowerThan ?
+                   AnalyserEquationAst::Type::MIN :
+                   AnalyserEquationAst::Type::MAX;
+    }
+
+    if (areEquivalentAsts(ifValue, condition->rightChild())
+        && areEquivalentAsts(elseValue, condition->leftChild())) {
+        return lowerThan ?
+                   AnalyserEquationAst::Type::MAX :
+                   AnalyserEquationAst::Type::MIN;
+    }
+
+    return AnalyserEquationAst::Type::PIECEWISE;
+}
+
+void Generator::GeneratorImpl::updateBranchlessPiecewiseFunctionNeeds(const AnalyserEquationAstPtr &ast)
+{
+    if (ast == nullptr) {
+        return;
+    }
+
+    if (ast->type() == AnalyserEquationAst::Type::PIECEWISE) {
+        switch (branchlessPiecewiseType(ast)) {
+        case AnalyserEquationAst::Type::MIN:
+            mNeedMinFunction = true;
+
+            break;
+        case AnalyserEquationAst::Type::MAX:
+            mNeedMaxFunction = true;
+
+            break;
+        default:
+            mNeedBlendFunction = true;
+
+            break;
+        }
+    }
+
+    updateBranchlessPiecewiseFunctionNeeds(ast->leftChild());
+    updateBranchlessPiecewiseFunctionNeeds(ast->rightChild());
+}
+
+void Generator::GeneratorImpl::updateBranchlessPiecewiseFunctionNeeds()
+{
+    // Determine which functions are needed by the branchless form of our
+    // piecewise statements, if any.
+
+    mNeedMinFunction = false;
+    mNeedMaxFunction = false;
+    mNeedBlendFunction = false;
+
+    if (mLockedProfile->hasBranchlessPiecewise()) {
+        for (const auto &equation : mLockedModel->equations()) {
+            updateBranchlessPiecewiseFunctionNeeds(equation->ast());
+        }
+    }
 }
 
 void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
@@ -419,6 +759,12 @@ bool Generator::GeneratorImpl::modifiedProfile() const
                            TRUE_VALUE :
                            FALSE_VALUE;
 
+    profileContents += mLockedProfile->branchlessPiecewiseString();
+
+    profileContents += mLockedProfile->hasBranchlessPiecewise() ?
+                           TRUE_VALUE :
+                           FALSE_VALUE;
+
     // Constants.
 
     profileContents += mLockedProfile->trueString()
@@ -426,7 +772,9 @@ bool Generator::GeneratorImpl::modifiedProfile() const
                        + mLockedProfile->eString()
                        + mLockedProfile->piString()
                        + mLockedProfile->infString()
-                       + mLockedProfile->nanString();
+                       + mLockedProfile->nanString()
+                       + mLockedProfile->realLiteralPrefixString()
+                       + mLockedProfile->realLiteralSuffixString();
 
     // Arithmetic functions.
 
@@ -441,7 +789,8 @@ bool Generator::GeneratorImpl::modifiedProfile() const
                        + mLockedProfile->xorFunctionString()
                        + mLockedProfile->notFunctionString()
                        + mLockedProfile->minFunctionString()
-                       + mLockedProfile->maxFunctionString();
+                       + mLockedProfile->maxFunctionString()
+                       + mLockedProfile->blendFunctionString();
 
     // Trigonometric functions.
 
@@ -467,7 +816,8 @@ bool Generator::GeneratorImpl::modifiedProfile() const
                        + mLockedProfile->originCommentString();
 
     profileContents += mLockedProfile->interfaceHeaderString()
-                       + mLockedProfile->implementationHeaderString();
+                       + mLockedProfile->implementationHeaderString()
+                       + mLockedProfile->implementationFooterString();
 
     profileContents += mLockedProfile->interfaceVersionString()
                        + mLockedProfile->implementationVersionString();
@@ -558,11 +908,32 @@ bool Generator::GeneratorImpl::modifiedProfile() const
 
     switch (mLockedProfile->profile()) {
     case GeneratorProfile::Profile::C:
-        res = profileContentsSha1 != "60d16843c0cb0180f147a4a562aa7a434634e929";
+        switch (mLockedProfile->precision()) {
+        case GeneratorProfile::Precision::DOUBLE:
+            res = profileContentsSha1 != "d9e03238d78b03f2e121ac9965ace0269d606420";
+
+            break;
+        case GeneratorProfile::Precision::SINGLE:
+            res = profileContentsSha1 != "dc1598a9901c8eb8daabcb7fa7442ca10dbf9f72";
+
+            break;
+        case GeneratorProfile::Precision::MIXED:
+            res = profileContentsSha1 != "c5ad33e5de0b468f0ef1fd83b863a36e8c9877d3";
+
+            break;
+        }
 
         break;
     case GeneratorProfile::Profile::PYTHON:
-        res = profileContentsSha1 != "1532797cc47546dd18bbe4d30fd69a046cf011ea";
+        res = profileContentsSha1 != "419531c72202fc69ec5cec9eceb23169f4e94e1c";
+
+        break;
+    case GeneratorProfile::Profile::C_SIMD:
+        res = profileContentsSha1 != "6436ead92db926e52696e3ccbb290c90a0641758";
+
+        break;
+    case GeneratorProfile::Profile::CXX:
+        res = profileContentsSha1 != "9ee5bc46b06f82d43fc45fa36dfbbc2ec7daa8cb";
 
         break;
     }
@@ -586,13 +957,22 @@ void Generator::GeneratorImpl::addOriginCommentCode()
         case GeneratorProfile::Profile::PYTHON:
             profileInformation += "Python";
 
+            break;
+        case GeneratorProfile::Profile::C_SIMD:
+            profileInformation += "C SIMD";
+
+            break;
+        case GeneratorProfile::Profile::CXX:
+            profileInformation += "C++";
+
             break;
         }
 
         profileInformation += " profile of";
 
-        mCode += replace(mLockedProfile->commentString(),
-                         "<CODE>", replace(replace(mLockedProfile->originCommentString(), "<PROFILE_INFORMATION>", profileInformation), "<LIBCELLML_VERSION>", versionString()));
+        mTemplates.mComment.write(mCode, [&](size_t) {
+            mTemplates.mOriginComment.write(mCode, {profileInformation, versionString()});
+        });
     }
 }
 
@@ -614,11 +994,15 @@ void Generator::GeneratorImpl::addImplementationHeaderCode()
             mCode += "\n";
         }
 
-        mCode += replace(mLockedProfile->implementationHeaderString(),
-                         "<INTERFACE_FILE_NAME>", mLockedProfile->interfaceFileNameString());
+        mTemplates.mImplementationHeader.write(mCode, {mLockedProfile->interfaceFileNameString()});
     }
 }
 
+void Generator::GeneratorImpl::addImplementationFooterCode()
+{
+    mCode += mLockedProfile->implementationFooterString();
+}
+
 void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(bool interface)
 {
     std::string versionAndLibcellmlCode;
@@ -642,8 +1026,7 @@ void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(bool interface)
         || (!interface && !mLockedProfile->implementationLibcellmlVersionString().empty())) {
         versionAndLibcellmlCode += interface ?
                                        mLockedProfile->interfaceLibcellmlVersionString() :
-                                       replace(mLockedProfile->implementationLibcellmlVersionString(),
-                                               "<LIBCELLML_VERSION>", versionString());
+                                       mTemplates.mImplementationLibcellmlVersion.generate({versionString()});
     }
 
     if (!versionAndLibcellmlCode.empty()) {
@@ -661,16 +1044,14 @@ void Generator::GeneratorImpl::addStateAndVariableCountCode(bool interface)
         || (!interface && !mLockedProfile->implementationStateCountString().empty())) {
         stateAndVariableCountCode += interface ?
                                          mLockedProfile->interfaceStateCountString() :
-                                         replace(mLockedProfile->implementationStateCountString(),
-                                                 "<STATE_COUNT>", std::to_string(mLockedModel->stateCount()));
+                                         mTemplates.mImplementationStateCount.generate({std::to_string(mLockedModel->stateCount())});
     }
 
     if ((interface && !mLockedProfile->interfaceVariableCountString().empty())
         || (!interface && !mLockedProfile->implementationVariableCountString().empty())) {
         stateAndVariableCountCode += interface ?
                                          mLockedProfile->interfaceVariableCountString() :
-                                         replace(mLockedProfile->implementationVariableCountString(),
-                                                 "<VARIABLE_COUNT>", std::to_string(mLockedModel->variableCount()));
+                                         mTemplates.mImplementationVariableCount.generate({std::to_string(mLockedModel->variableCount())});
     }
 
     if (!stateAndVariableCountCode.empty()) {
@@ -689,12 +1070,11 @@ void Generator::GeneratorImpl::addVariableTypeObjectCode()
             mCode += "\n";
         }
 
-        mCode += replace(mLockedProfile->variableTypeObjectString(),
-                         "<OPTIONAL_TYPE>", mLockedModel->hasExternalVariables() ? mLockedProfile->variableTypeObjectExternalTypeString() : "");
+        mTemplates.mVariableTypeObject.write(mCode, {mLockedModel->hasExternalVariables() ? mLockedProfile->variableTypeObjectExternalTypeString() : ""});
     }
 }
 
-std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::string &objectString) const
+std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const GeneratorTemplate &objectTemplate) const
 {
     size_t componentSize = 0;
     size_t nameSize = 0;
@@ -712,10 +1092,9 @@ std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::
         updateVariableInfoSizes(componentSize, nameSize, unitsSize, variable);
     }
 
-    return replace(replace(replace(objectString,
-                                   "<COMPONENT_SIZE>", std::to_string(componentSize)),
-                           "<NAME_SIZE>", std::to_string(nameSize)),
-                   "<UNITS_SIZE>", std::to_string(unitsSize));
+    return objectTemplate.generate({std::to_string(componentSize),
+                                    std::to_string(nameSize),
+                                    std::to_string(unitsSize)});
 }
 
 void Generator::GeneratorImpl::addVariableInfoObjectCode()
@@ -725,7 +1104,7 @@ void Generator::GeneratorImpl::addVariableInfoObjectCode()
             mCode += "\n";
         }
 
-        mCode += generateVariableInfoObjectCode(mLockedProfile->variableInfoObjectString());
+        mCode += generateVariableInfoObjectCode(mTemplates.mVariableInfoObject);
     }
 }
 
@@ -736,20 +1115,10 @@ void Generator::GeneratorImpl::addVariableInfoWithTypeObjectCode()
             mCode += "\n";
         }
 
-        mCode += generateVariableInfoObjectCode(mLockedProfile->variableInfoWithTypeObjectString());
+        mCode += generateVariableInfoObjectCode(mTemplates.mVariableInfoWithTypeObject);
     }
 }
 
-std::string Generator::GeneratorImpl::generateVariableInfoEntryCode(const std::string &name,
-                                                                    const std::string &units,
-                                                                    const std::string &component) const
-{
-    return replace(replace(replace(mLockedProfile->variableInfoEntryString(),
-                                   "<NAME>", name),
-                           "<UNITS>", units),
-                   "<COMPONENT>", component);
-}
-
 void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode()
 {
     std::string interfaceVoiStateAndVariableInfoCode;
@@ -785,8 +1154,9 @@ void Generator::GeneratorImpl::addImplementationVoiInfoCode()
         auto units = (mLockedModel->voi() != nullptr) ? mLockedModel->voi()->variable()->units()->name() : "";
         auto component = (mLockedModel->voi() != nullptr) ? owningComponent(mLockedModel->voi()->variable())->name() : "";
 
-        mCode += replace(mLockedProfile->implementationVoiInfoString(),
-                         "<CODE>", generateVariableInfoEntryCode(name, units, component));
+        mTemplates.mImplementationVoiInfo.write(mCode, [&](size_t) {
+            mTemplates.mVariableInfoEntry.write(mCode, {name, units, component});
+        });
     }
 }
 
@@ -799,25 +1169,25 @@ void Generator::GeneratorImpl::addImplementationStateInfoCode()
             mCode += "\n";
         }
 
-        std::string infoElementsCode;
+        mTemplates.mImplementationStateInfo.write(mCode, [&](size_t) {
+            auto states = mLockedModel->states();
 
-        for (const auto &state : mLockedModel->states()) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mLockedProfile->arrayElementSeparatorString() + "\n";
-            }
+            for (size_t i = 0; i < states.size(); ++i) {
+                if (i != 0) {
+                    mCode += mLockedProfile->arrayElementSeparatorString() + "\n";
+                }
 
-            infoElementsCode += mLockedProfile->indentString()
-                                + generateVariableInfoEntryCode(state->variable()->name(),
-                                                                state->variable()->units()->name(),
-                                                                owningComponent(state->variable())->name());
-        }
+                mCode += mLockedProfile->indentString();
 
-        if (!infoElementsCode.empty()) {
-            infoElementsCode += "\n";
-        }
+                mTemplates.mVariableInfoEntry.write(mCode, {states[i]->variable()->name(),
+                                                            states[i]->variable()->units()->name(),
+                                                            owningComponent(states[i]->variable())->name()});
+            }
 
-        mCode += replace(mLockedProfile->implementationStateInfoString(),
-                         "<CODE>", infoElementsCode);
+            if (!states.empty()) {
+                mCode += "\n";
+            }
+        });
     }
 }
 
@@ -834,39 +1204,39 @@ void Generator::GeneratorImpl::addImplementationVariableInfoCode()
             mCode += "\n";
         }
 
-        std::string infoElementsCode;
+        mTemplates.mImplementationVariableInfo.write(mCode, [&](size_t) {
+            auto variables = mLockedModel->variables();
 
-        for (const auto &variable : mLockedModel->variables()) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mLockedProfile->arrayElementSeparatorString() + "\n";
-            }
-
-            std::string variableType;
+            for (size_t i = 0; i < variables.size(); ++i) {
+                if (i != 0) {
+                    mCode += mLockedProfile->arrayElementSeparatorString() + "\n";
+                }
 
-            if (variable->type() == AnalyserVariable::Type::CONSTANT) {
-                variableType = mLockedProfile->constantVariableTypeString();
-            } else if (variable->type() == AnalyserVariable::Type::COMPUTED_CONSTANT) {
-                variableType = mLockedProfile->computedConstantVariableTypeString();
-            } else if (variable->type() == AnalyserVariable::Type::ALGEBRAIC) {
-                variableType = mLockedProfile->algebraicVariableTypeString();
-            } else if (variable->type() == AnalyserVariable::Type::EXTERNAL) {
-                variableType = mLockedProfile->externalVariableTypeString();
-            }
+                auto variable = variables[i];
+                std::string variableType;
+
+                if (variable->type() == AnalyserVariable::Type::CONSTANT) {
+                    variableType = mLockedProfile->constantVariableTypeString();
+                } else if (variable->type() == AnalyserVariable::Type::COMPUTED_CONSTANT) {
+                    variableType = mLockedProfile->computedConstantVariableTypeString();
+                } else if (variable->type() == AnalyserVariable::Type::ALGEBRAIC) {
+                    variableType = mLockedProfile->algebraicVariableTypeString();
+                } else if (variable->type() == AnalyserVariable::Type::EXTERNAL) {
+                    variableType = mLockedProfile->externalVariableTypeString();
+                }
 
-            infoElementsCode += mLockedProfile->indentString()
-                                + replace(replace(replace(replace(mLockedProfile->variableInfoWithTypeEntryString(),
-                                                                  "<NAME>", variable->variable()->name()),
-                                                          "<UNITS>", variable->variable()->units()->name()),
-                                                  "<COMPONENT>", owningComponent(variable->variable())->name()),
-                                          "<TYPE>", variableType);
-        }
+                mCode += mLockedProfile->indentString();
 
-        if (!infoElementsCode.empty()) {
-            infoElementsCode += "\n";
-        }
+                mTemplates.mVariableInfoWithTypeEntry.write(mCode, {variable->variable()->name(),
+                                                                    variable->variable()->units()->name(),
+                                                                    owningComponent(variable->variable())->name(),
+                                                                    variableType});
+            }
 
-        mCode += replace(mLockedProfile->implementationVariableInfoString(),
-                         "<CODE>", infoElementsCode);
+            if (!variables.empty()) {
+                mCode += "\n";
+            }
+        });
     }
 }
 
@@ -962,7 +1332,7 @@ void Generator::GeneratorImpl::addArithmeticFunctionsCode()
         mCode += mLockedProfile->notFunctionString();
     }
 
-    if (mLockedModel->needMinFunction()
+    if ((mLockedModel->needMinFunction() || mNeedMinFunction)
         && !mLockedProfile->minFunctionString().empty()) {
         if (!mCode.empty()) {
             mCode += "\n";
@@ -971,7 +1341,7 @@ void Generator::GeneratorImpl::addArithmeticFunctionsCode()
         mCode += mLockedProfile->minFunctionString();
     }
 
-    if (mLockedModel->needMaxFunction()
+    if ((mLockedModel->needMaxFunction() || mNeedMaxFunction)
         && !mLockedProfile->maxFunctionString().empty()) {
         if (!mCode.empty()) {
             mCode += "\n";
@@ -979,6 +1349,15 @@ void Generator::GeneratorImpl::addArithmeticFunctionsCode()
 
         mCode += mLockedProfile->maxFunctionString();
     }
+
+    if (mNeedBlendFunction
+        && !mLockedProfile->blendFunctionString().empty()) {
+        if (!mCode.empty()) {
+            mCode += "\n";
+        }
+
+        mCode += mLockedProfile->blendFunctionString();
+    }
 }
 
 void Generator::GeneratorImpl::addTrigonometricFunctionsCode()
@@ -1165,28 +1544,30 @@ void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode()
     }
 }
 
-std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &methodBody) const
+void Generator::GeneratorImpl::addEmptyMethodBodyCode(size_t methodBodyStart)
 {
-    return methodBody.empty() ?
-               mLockedProfile->emptyMethodString().empty() ?
-               "" :
-               mLockedProfile->indentString() + mLockedProfile->emptyMethodString() :
-               methodBody;
+    // Add the profile's empty method code, if any, should nothing have been
+    // written since the start of our method body.
+
+    if ((mCode.size() == methodBodyStart)
+        && !mLockedProfile->emptyMethodString().empty()) {
+        mCode += mLockedProfile->indentString() + mLockedProfile->emptyMethodString();
+    }
 }
 
 std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value) const
 {
     if (value.find('.') != std::string::npos) {
-        return value;
+        return mLockedProfile->realLiteralPrefixString() + value + mLockedProfile->realLiteralSuffixString();
     }
 
     auto ePos = value.find('e');
 
     if (ePos == std::string::npos) {
-        return value + ".0";
+        return mLockedProfile->realLiteralPrefixString() + value + ".0" + mLockedProfile->realLiteralSuffixString();
     }
 
-    return value.substr(0, ePos) + ".0" + value.substr(ePos);
+    return mLockedProfile->realLiteralPrefixString() + value.substr(0, ePos) + ".0" + value.substr(ePos) + mLockedProfile->realLiteralSuffixString();
 }
 
 std::string Generator::GeneratorImpl::generateDoubleOrConstantVariableNameCode(const VariablePtr &variable) const
@@ -1497,7 +1878,7 @@ std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op
             }
         }
 
-        return rightChild + op + "(1.0/" + leftChild + ")";
+        return rightChild + op + "(" + generateDoubleCode("1.0") + "/" + leftChild + ")";
     }
 
     return leftChild + op + rightChild;
@@ -1537,19 +1918,46 @@ std::string Generator::GeneratorImpl::generateTwoParameterFunctionCode(const std
 std::string Generator::GeneratorImpl::generatePiecewiseIfCode(const std::string &condition,
                                                               const std::string &value) const
 {
-    return replace(replace(mLockedProfile->hasConditionalOperator() ?
-                               mLockedProfile->conditionalOperatorIfString() :
-                               mLockedProfile->piecewiseIfString(),
-                           "<CONDITION>", condition),
-                   "<IF_STATEMENT>", value);
+    return mTemplates.mPiecewiseIf.generate({condition, value});
 }
 
 std::string Generator::GeneratorImpl::generatePiecewiseElseCode(const std::string &value) const
 {
-    return replace(mLockedProfile->hasConditionalOperator() ?
-                       mLockedProfile->conditionalOperatorElseString() :
-                       mLockedProfile->piecewiseElseString(),
-                   "<ELSE_STATEMENT>", value);
+    return mTemplates.mPiecewiseElse.generate({value});
+}
+
+std::string Generator::GeneratorImpl::generateBranchlessPiecewiseCode(const AnalyserEquationAstPtr &ast) const
+{
+    // Generate the code for the given piecewise statement, using the "min" or
+    // "max" function if possible, or the branchless "piecewise" string
+    // otherwise, i.e. code that evaluates all the pieces and then selects one
+    // of them, so that it can be vectorised.
+
+    auto piece = ast->leftChild();
+    auto type = branchlessPiecewiseType(ast);
+
+    if (type != AnalyserEquationAst::Type::PIECEWISE) {
+        return ((type == AnalyserEquationAst::Type::MIN) ?
+                    mLockedProfile->minString() :
+                    mLockedProfile->maxString())
+               + "(" + generateCode(piece->leftChild()) + ", " + generateCode(ast->rightChild()->leftChild()) + ")";
+    }
+
+    std::string elseCode;
+
+    if (ast->rightChild() == nullptr) {
+        elseCode = mLockedProfile->nanString();
+    } else if (ast->rightChild()->type() == AnalyserEquationAst::Type::PIECE) {
+        elseCode = mTemplates.mBranchlessPiecewise.generate({generateCode(ast->rightChild()->rightChild()),
+                                                             generateCode(ast->rightChild()->leftChild()),
+                                                             mLockedProfile->nanString()});
+    } else {
+        elseCode = generateCode(ast->rightChild());
+    }
+
+    return mTemplates.mBranchlessPiecewise.generate({generateCode(piece->rightChild()),
+                                                     generateCode(piece->leftChild()),
+                                                     elseCode});
 }
 
 std::string Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr &ast) const
@@ -1889,7 +2297,9 @@ std::string Generator::GeneratorImpl::generateCode(const AnalyserEquationAstPtr
         // Piecewise statement.
 
     case AnalyserEquationAst::Type::PIECEWISE:
-        if (ast->rightChild() != nullptr) {
+        if (mLockedProfile->hasBranchlessPiecewise()) {
+            code = generateBranchlessPiecewiseCode(ast);
+        } else if (ast->rightChild() != nullptr) {
             if (ast->rightChild()->type() == AnalyserEquationAst::Type::PIECE) {
                 code = generateCode(ast->leftChild()) + generatePiecewiseElseCode(generateCode(ast->rightChild()) + generatePiecewiseElseCode(mLockedProfile->nanString()));
             } else {
@@ -1974,12 +2384,10 @@ std::string Generator::GeneratorImpl::generateInitializationCode(const AnalyserV
            + mLockedProfile->commandSeparatorString() + "\n";
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquationPtr &equation,
-                                                           std::vector<AnalyserEquationPtr> &remainingEquations,
-                                                           bool onlyStateRateBasedEquations) const
+void Generator::GeneratorImpl::addEquationCode(const AnalyserEquationPtr &equation,
+                                               std::vector<AnalyserEquationPtr> &remainingEquations,
+                                               bool onlyStateRateBasedEquations)
 {
-    std::string res;
-
     if (std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end()) {
         if ((equation->type() == AnalyserEquation::Type::RATE)
             || (equation->type() == AnalyserEquation::Type::ALGEBRAIC)
@@ -1990,7 +2398,7 @@ std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquatio
                         || (((dependency->type() == AnalyserEquation::Type::ALGEBRAIC)
                              || (dependency->type() == AnalyserEquation::Type::EXTERNAL))
                             && dependency->isStateRateBased()))) {
-                    res += generateEquationCode(dependency, remainingEquations, onlyStateRateBasedEquations);
+                    addEquationCode(dependency, remainingEquations, onlyStateRateBasedEquations);
                 }
             }
         }
@@ -2000,18 +2408,15 @@ std::string Generator::GeneratorImpl::generateEquationCode(const AnalyserEquatio
 
             index << equation->variable()->index();
 
-            res += mLockedProfile->indentString() + generateVariableNameCode(equation->variable()->variable()) + " = "
-                   + replace(mLockedProfile->externalVariableMethodCallString(),
-                             "<INDEX>", index.str())
-                   + mLockedProfile->commandSeparatorString() + "\n";
+            mCode += mLockedProfile->indentString() + generateVariableNameCode(equation->variable()->variable()) + " = "
+                     + mTemplates.mExternalVariableMethodCall.generate({index.str()})
+                     + mLockedProfile->commandSeparatorString() + "\n";
         } else {
-            res += mLockedProfile->indentString() + generateCode(equation->ast()) + mLockedProfile->commandSeparatorString() + "\n";
+            mCode += mLockedProfile->indentString() + generateCode(equation->ast()) + mLockedProfile->commandSeparatorString() + "\n";
         }
 
         remainingEquations.erase(std::find(remainingEquations.begin(), remainingEquations.end(), equation));
     }
-
-    return res;
 }
 
 void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
@@ -2029,15 +2434,13 @@ void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode()
     if (!mLockedProfile->interfaceComputeRatesMethodString().empty()
         && ((mLockedModel->hasExternalVariables() && !mLockedProfile->externalVariableMethodParameterString().empty())
             || !mLockedModel->hasExternalVariables())) {
-        interfaceComputeModelMethodsCode += replace(mLockedProfile->interfaceComputeRatesMethodString(),
-                                                    "<OPTIONAL_PARAMETER>", mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : "");
+        interfaceComputeModelMethodsCode += mTemplates.mInterfaceComputeRatesMethod.generate({mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : ""});
     }
 
     if (!mLockedProfile->interfaceComputeVariablesMethodString().empty()
         && ((mLockedModel->hasExternalVariables() && !mLockedProfile->externalVariableMethodParameterString().empty())
             || !mLockedModel->hasExternalVariables())) {
-        interfaceComputeModelMethodsCode += replace(mLockedProfile->interfaceComputeVariablesMethodString(),
-                                                    "<OPTIONAL_PARAMETER>", mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : "");
+        interfaceComputeModelMethodsCode += mTemplates.mInterfaceComputeVariablesMethod.generate({mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : ""});
     }
 
     if (!interfaceComputeModelMethodsCode.empty()) {
@@ -2054,26 +2457,27 @@ void Generator::GeneratorImpl::addImplementationInitialiseStatesAndConstantsMeth
             mCode += "\n";
         }
 
-        std::string methodBody;
+        mTemplates.mImplementationInitialiseStatesAndConstantsMethod.write(mCode, [&](size_t) {
+            auto methodBodyStart = mCode.size();
 
-        for (const auto &variable : mLockedModel->variables()) {
-            if (variable->type() == AnalyserVariable::Type::CONSTANT) {
-                methodBody += generateInitializationCode(variable);
+            for (const auto &variable : mLockedModel->variables()) {
+                if (variable->type() == AnalyserVariable::Type::CONSTANT) {
+                    mCode += generateInitializationCode(variable);
+                }
             }
-        }
 
-        for (const auto &equation : mLockedModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
+            for (const auto &equation : mLockedModel->equations()) {
+                if (equation->type() == AnalyserEquation::Type::TRUE_CONSTANT) {
+                    addEquationCode(equation, remainingEquations);
+                }
             }
-        }
 
-        for (const auto &state : mLockedModel->states()) {
-            methodBody += generateInitializationCode(state);
-        }
+            for (const auto &state : mLockedModel->states()) {
+                mCode += generateInitializationCode(state);
+            }
 
-        mCode += replace(mLockedProfile->implementationInitialiseStatesAndConstantsMethodString(),
-                         "<CODE>", generateMethodBodyCode(methodBody));
+            addEmptyMethodBodyCode(methodBodyStart);
+        });
     }
 }
 
@@ -2084,16 +2488,17 @@ void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCo
             mCode += "\n";
         }
 
-        std::string methodBody;
+        mTemplates.mImplementationComputeComputedConstantsMethod.write(mCode, [&](size_t) {
+            auto methodBodyStart = mCode.size();
 
-        for (const auto &equation : mLockedModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
+            for (const auto &equation : mLockedModel->equations()) {
+                if (equation->type() == AnalyserEquation::Type::VARIABLE_BASED_CONSTANT) {
+                    addEquationCode(equation, remainingEquations);
+                }
             }
-        }
 
-        mCode += replace(mLockedProfile->implementationComputeComputedConstantsMethodString(),
-                         "<CODE>", generateMethodBodyCode(methodBody));
+            addEmptyMethodBodyCode(methodBodyStart);
+        });
     }
 }
 
@@ -2106,17 +2511,23 @@ void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::vect
             mCode += "\n";
         }
 
-        std::string methodBody;
+        mTemplates.mImplementationComputeRatesMethod.write(mCode, [&](size_t placeholder) {
+            if (placeholder == 0) {
+                mCode += mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : "";
 
-        for (const auto &equation : mLockedModel->equations()) {
-            if (equation->type() == AnalyserEquation::Type::RATE) {
-                methodBody += generateEquationCode(equation, remainingEquations);
+                return;
+            }
+
+            auto methodBodyStart = mCode.size();
+
+            for (const auto &equation : mLockedModel->equations()) {
+                if (equation->type() == AnalyserEquation::Type::RATE) {
+                    addEquationCode(equation, remainingEquations);
+                }
             }
-        }
 
-        mCode += replace(replace(mLockedProfile->implementationComputeRatesMethodString(),
-                                 "<OPTIONAL_PARAMETER>", mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : ""),
-                         "<CODE>", generateMethodBodyCode(methodBody));
+            addEmptyMethodBodyCode(methodBodyStart);
+        });
     }
 }
 
@@ -2129,193 +2540,190 @@ void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::
             mCode += "\n";
         }
 
-        std::string methodBody;
-        auto equations = mLockedModel->equations();
-        std::vector<AnalyserEquationPtr> newRemainingEquations {std::begin(equations), std::end(equations)};
+        mTemplates.mImplementationComputeVariablesMethod.write(mCode, [&](size_t placeholder) {
+            if (placeholder == 0) {
+                mCode += mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : "";
 
-        for (const auto &equation : equations) {
-            if ((std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end())
-                || (((equation->type() == AnalyserEquation::Type::ALGEBRAIC)
-                     || (equation->type() == AnalyserEquation::Type::EXTERNAL))
-                    && equation->isStateRateBased())) {
-                methodBody += generateEquationCode(equation, newRemainingEquations, true);
+                return;
             }
-        }
 
-        mCode += replace(replace(mLockedProfile->implementationComputeVariablesMethodString(),
-                                 "<OPTIONAL_PARAMETER>", mLockedModel->hasExternalVariables() ? mLockedProfile->externalVariableMethodParameterString() : ""),
-                         "<CODE>", generateMethodBodyCode(methodBody));
-    }
-}
+            auto methodBodyStart = mCode.size();
+            auto equations = mLockedModel->equations();
+            std::vector<AnalyserEquationPtr> newRemainingEquations {std::begin(equations), std::end(equations)};
 
-Generator::Generator()
-    : mPimpl(new GeneratorImpl())
-{
-    mPimpl->mGenerator = this;
-}
+            for (const auto &equation : equations) {
+                if ((std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end())
+                    || (((equation->type() == AnalyserEquation::Type::ALGEBRAIC)
+                         || (equation->type() == AnalyserEquation::Type::EXTERNAL))
+                        && equation->isStateRateBased())) {
+                    addEquationCode(equation, newRemainingEquations, true);
+                }
+            }
 
-Generator::~Generator()
-{
-    delete mPimpl;
+            addEmptyMethodBodyCode(methodBodyStart);
+        });
+    }
 }
 
-GeneratorPtr Generator::create() noexcept
+void Generator::GeneratorImpl::addExternalVariableIssues()
 {
-    return std::shared_ptr<Generator> {new Generator {}};
-}
+    // Our methods to compute rates and variables are not generated if our
+    // model has external variables and our profile has no way to pass an
+    // external variable method to them (see the C SIMD profile, for instance),
+    // so let the user know about it.
 
-GeneratorProfilePtr Generator::profile()
-{
-    if (mPimpl->mOwnedProfile != nullptr) {
-        return mPimpl->mOwnedProfile;
+    if (!mLockedModel->hasExternalVariables()
+        || !mLockedProfile->externalVariableMethodParameterString().empty()) {
+        return;
     }
 
-    return mPimpl->mProfile.lock();
-}
-
-void Generator::setProfile(const GeneratorProfilePtr &profile)
-{
-    mPimpl->mOwnedProfile = nullptr;
-    mPimpl->mProfile = profile;
-}
+    for (const auto &variable : mLockedModel->variables()) {
+        if (variable->type() == AnalyserVariable::Type::EXTERNAL) {
+            auto issue = Issue::create();
 
-AnalyserModelPtr Generator::model()
-{
-    return mPimpl->mModel.lock();
-}
+            issue->setDescription("Variable '" + variable->variable()->name()
+                                  + "' in component '" + owningComponent(variable->variable())->name()
+                                  + "' is external, but the profile cannot generate code for external variables, so the methods to compute the rates and variables of the model are not generated.");
+            issue->setReferenceRule(Issue::ReferenceRule::GENERATOR_EXTERNAL_VARIABLE_NOT_SUPPORTED);
+            issue->setVariable(variable->variable());
 
-void Generator::setModel(const AnalyserModelPtr &model)
-{
-    mPimpl->mModel = model;
+            mGenerator->addIssue(issue);
+        }
+    }
 }
 
-std::string Generator::interfaceCode() const
+void Generator::GeneratorImpl::writeInterface(std::ostream &stream)
 {
-    mPimpl->retrieveLockedModelAndProfile();
+    mGenerator->removeAllIssues();
 
-    if (!mPimpl->retrieveLockedModelAndProfile()
-        || !mPimpl->mLockedModel->isValid()
-        || !mPimpl->mLockedProfile->hasInterface()) {
-        mPimpl->resetLockedModelAndProfile();
+    if (!retrieveLockedModelAndProfile()
+        || !mLockedModel->isValid()
+        || !mLockedProfile->hasInterface()) {
+        resetLockedModelAndProfile();
 
-        return {};
+        return;
     }
 
+    addExternalVariableIssues();
+
     // Add code for the origin comment.
 
-    mPimpl->mCode = {};
+    mCode.reset(stream);
 
-    mPimpl->addOriginCommentCode();
+    addOriginCommentCode();
 
     // Add code for the header.
 
-    mPimpl->addInterfaceHeaderCode();
+    addInterfaceHeaderCode();
 
     // Add code for the interface of the version of the profile and libCellML.
 
-    mPimpl->addVersionAndLibcellmlVersionCode(true);
+    addVersionAndLibcellmlVersionCode(true);
 
     // Add code for the interface of the number of states and variables.
 
-    mPimpl->addStateAndVariableCountCode(true);
+    addStateAndVariableCountCode(true);
 
     // Add code for the variable information related objects.
 
-    mPimpl->addVariableTypeObjectCode();
-    mPimpl->addVariableInfoObjectCode();
-    mPimpl->addVariableInfoWithTypeObjectCode();
+    addVariableTypeObjectCode();
+    addVariableInfoObjectCode();
+    addVariableInfoWithTypeObjectCode();
 
     // Add code for the interface of the information about the variable of
     // integration, states and (other) variables.
 
-    mPimpl->addInterfaceVoiStateAndVariableInfoCode();
+    addInterfaceVoiStateAndVariableInfoCode();
 
     // Add code for the interface to create and delete arrays.
 
-    mPimpl->addInterfaceCreateDeleteArrayMethodsCode();
+    addInterfaceCreateDeleteArrayMethodsCode();
 
     // Add code for the external variable method type definition.
 
-    mPimpl->addExternalVariableMethodTypeDefinitionCode();
+    addExternalVariableMethodTypeDefinitionCode();
 
     // Add code for the interface to compute the model.
 
-    mPimpl->addInterfaceComputeModelMethodsCode();
-
-    mPimpl->resetLockedModelAndProfile();
+    addInterfaceComputeModelMethodsCode();
 
-    return mPimpl->mCode;
+    resetLockedModelAndProfile();
 }
 
-std::string Generator::implementationCode() const
+void Generator::GeneratorImpl::writeImplementation(std::ostream &stream)
 {
-    if (!mPimpl->retrieveLockedModelAndProfile()
-        || !mPimpl->mLockedModel->isValid()) {
-        mPimpl->resetLockedModelAndProfile();
+    mGenerator->removeAllIssues();
 
-        return {};
+    if (!retrieveLockedModelAndProfile()
+        || !mLockedModel->isValid()) {
+        resetLockedModelAndProfile();
+
+        return;
     }
 
+    addExternalVariableIssues();
+
     // Add code for the origin comment.
 
-    mPimpl->mCode = {};
+    mCode.reset(stream);
 
-    mPimpl->addOriginCommentCode();
+    addOriginCommentCode();
 
     // Add code for the header.
 
-    mPimpl->addImplementationHeaderCode();
+    addImplementationHeaderCode();
 
     // Add code for the implementation of the version of the profile and
     // libCellML.
 
-    mPimpl->addVersionAndLibcellmlVersionCode();
+    addVersionAndLibcellmlVersionCode();
 
     // Add code for the implementation of the number of states and variables.
 
-    mPimpl->addStateAndVariableCountCode();
+    addStateAndVariableCountCode();
 
     // Add code for the variable information related objects.
 
-    if (!mPimpl->mLockedProfile->hasInterface()) {
-        mPimpl->addVariableTypeObjectCode();
-        mPimpl->addVariableInfoObjectCode();
-        mPimpl->addVariableInfoWithTypeObjectCode();
+    if (!mLockedProfile->hasInterface()) {
+        addVariableTypeObjectCode();
+        addVariableInfoObjectCode();
+        addVariableInfoWithTypeObjectCode();
     }
 
     // Add code for the implementation of the information about the variable of
     // integration, states and (other) variables.
 
-    mPimpl->addImplementationVoiInfoCode();
-    mPimpl->addImplementationStateInfoCode();
-    mPimpl->addImplementationVariableInfoCode();
+    addImplementationVoiInfoCode();
+    addImplementationStateInfoCode();
+    addImplementationVariableInfoCode();
 
     // Add code for the arithmetic and trigonometric functions.
 
-    mPimpl->addArithmeticFunctionsCode();
-    mPimpl->addTrigonometricFunctionsCode();
+    updateBranchlessPiecewiseFunctionNeeds();
+    addArithmeticFunctionsCode();
+    addTrigonometricFunctionsCode();
 
     // Add code for the implementation to create and delete arrays.
 
-    mPimpl->addImplementationCreateStatesArrayMethodCode();
-    mPimpl->addImplementationCreateVariablesArrayMethodCode();
-    mPimpl->addImplementationDeleteArrayMethodCode();
+    addImplementationCreateStatesArrayMethodCode();
+    addImplementationCreateVariablesArrayMethodCode();
+    addImplementationDeleteArrayMethodCode();
 
     // Add code for the implementation to initialise our states and constants.
 
-    auto equations = mPimpl->mLockedModel->equations();
+    auto equations = mLockedModel->equations();
     std::vector<AnalyserEquationPtr> remainingEquations {std::begin(equations), std::end(equations)};
 
-    mPimpl->addImplementationInitialiseStatesAndConstantsMethodCode(remainingEquations);
+    addImplementationInitialiseStatesAndConstantsMethodCode(remainingEquations);
 
     // Add code for the implementation to compute our computed constants.
 
-    mPimpl->addImplementationComputeComputedConstantsMethodCode(remainingEquations);
+    addImplementationComputeComputedConstantsMethodCode(remainingEquations);
 
     // Add code for the implementation to compute our rates (and any variables
     // on which they depend).
 
-    mPimpl->addImplementationComputeRatesMethodCode(remainingEquations);
+    addImplementationComputeRatesMethodCode(remainingEquations);
 
     // Add code for the implementation to compute our variables.
     // Note: this method computes the remaining variables, i.e. the ones not
@@ -2325,11 +2733,82 @@ std::string Generator::implementationCode() const
     //       variables that rely on the value of some states/rates are up to
     //       date.
 
-    mPimpl->addImplementationComputeVariablesMethodCode(remainingEquations);
+    addImplementationComputeVariablesMethodCode(remainingEquations);
+
+    // Add code for the footer.
+
+    addImplementationFooterCode();
+
+    resetLockedModelAndProfile();
+}
+
+Generator::Generator()
+    : mPimpl(new GeneratorImpl())
+{
+    mPimpl->mGenerator = this;
+}
 
-    mPimpl->resetLockedModelAndProfile();
+Generator::~Generator()
+{
+    delete mPimpl;
+}
 
-    return mPimpl->mCode;
+GeneratorPtr Generator::create() noexcept
+{
+    return std::shared_ptr<Generator> {new Generator {}};
+}
+
+GeneratorProfilePtr Generator::profile()
+{
+    if (mPimpl->mOwnedProfile != nullptr) {
+        return mPimpl->mOwnedProfile;
+    }
+
+    return mPimpl->mProfile.lock();
+}
+
+void Generator::setProfile(const GeneratorProfilePtr &profile)
+{
+    mPimpl->mOwnedProfile = nullptr;
+    mPimpl->mProfile = profile;
+}
+
+AnalyserModelPtr Generator::model()
+{
+    return mPimpl->mModel.lock();
+}
+
+void Generator::setModel(const AnalyserModelPtr &model)
+{
+    mPimpl->mModel = model;
+}
+
+std::string Generator::interfaceCode() const
+{
+    std::ostringstream code;
+
+    mPimpl->writeInterface(code);
+
+    return code.str();
+}
+
+std::string Generator::implementationCode() const
+{
+    std::ostringstream code;
+
+    mPimpl->writeImplementation(code);
+
+    return code.str();
+}
+
+void Generator::writeInterface(std::ostream &stream) const
+{
+    mPimpl->writeInterface(stream);
+}
+
+void Generator::writeImplementation(std::ostream &stream) const
+{
+    mPimpl->writeImplementation(stream);
 }
 
 } // namespace libcellml
@@ -36,6 +36,7 @@ struct GeneratorProfile::GeneratorProfileImpl
     // Whether the profile is official.
 
     GeneratorProfile::Profile mProfile = Profile::C;
+    GeneratorProfile::Precision mPrecision = Precision::DOUBLE;
 
     // Whether the profile requires an interface to be generated.
 
@@ -126,6 +127,10 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     bool mHasConditionalOperator = true;
 
+    std::string mBranchlessPiecewiseString;
+
+    bool mHasBranchlessPiecewise = false;
+
     // Constants.
 
     std::string mTrueString;
@@ -134,6 +139,8 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mPiString;
     std::string mInfString;
     std::string mNanString;
+    std::string mRealLiteralPrefixString;
+    std::string mRealLiteralSuffixString;
 
     // Arithmetic functions.
 
@@ -149,6 +156,7 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mNotFunctionString;
     std::string mMinFunctionString;
     std::string mMaxFunctionString;
+    std::string mBlendFunctionString;
 
     // Trigonometric functions.
 
@@ -174,6 +182,7 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     std::string mInterfaceHeaderString;
     std::string mImplementationHeaderString;
+    std::string mImplementationFooterString;
 
     std::string mInterfaceVersionString;
     std::string mImplementationVersionString;
@@ -258,12 +267,19 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mCommandSeparatorString;
 
     void loadProfile(GeneratorProfile::Profile profile);
+    void loadPrecision();
 };
 
 void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
 {
     mProfile = profile;
 
+    // Only the C profile supports a precision other than double precision.
+
+    if (profile != GeneratorProfile::Profile::C) {
+        mPrecision = GeneratorProfile::Precision::DOUBLE;
+    }
+
     if (profile == GeneratorProfile::Profile::C) {
         // Whether the profile requires an interface to be generated.
 
@@ -352,6 +368,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mHasConditionalOperator = true;
 
+        mBranchlessPiecewiseString = "blend(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)";
+
+        mHasBranchlessPiecewise = false;
+
         // Constants.
 
         mTrueString = "1.0";
@@ -360,6 +380,8 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mPiString = convertToString(M_PI);
         mInfString = "INFINITY";
         mNanString = "NAN";
+        mRealLiteralPrefixString = "";
+        mRealLiteralSuffixString = "";
 
         // Arithmetic functions.
 
@@ -384,6 +406,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                              "{\n"
                              "    return (x > y)?x:y;\n"
                              "}\n";
+        mBlendFunctionString = "double blend(double condition, double x, double y)\n"
+                               "{\n"
+                               "    return (condition != 0.0)?x:y;\n"
+                               "}\n";
 
         // Trigonometric functions.
 
@@ -456,6 +482,7 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                       "\n"
                                       "#include <math.h>\n"
                                       "#include <stdlib.h>\n";
+        mImplementationFooterString = "";
 
         mInterfaceVersionString = "extern const char VERSION[];\n";
         mImplementationVersionString = "const char VERSION[] = \"0.2.0\";\n";
@@ -663,6 +690,10 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mHasConditionalOperator = true;
 
+        mBranchlessPiecewiseString = "blend_func(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)";
+
+        mHasBranchlessPiecewise = false;
+
         // Constants.
 
         mTrueString = "1.0";
@@ -671,6 +702,8 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mPiString = convertToString(M_PI);
         mInfString = "inf";
         mNanString = "nan";
+        mRealLiteralPrefixString = "";
+        mRealLiteralSuffixString = "";
 
         // Arithmetic functions.
 
@@ -710,107 +743,851 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mMaxFunctionString = "\n"
                              "def max(x, y):\n"
                              "    return x if x > y else y\n";
+        mBlendFunctionString = "\n"
+                               "def blend_func(condition, x, y):\n"
+                               "    return x if bool(condition) else y\n";
+
+        // Trigonometric functions.
+
+        mSecFunctionString = "\n"
+                             "def sec(x):\n"
+                             "    return 1.0/cos(x)\n";
+        mCscFunctionString = "\n"
+                             "def csc(x):\n"
+                             "    return 1.0/sin(x)\n";
+        mCotFunctionString = "\n"
+                             "def cot(x):\n"
+                             "    return 1.0/tan(x)\n";
+        mSechFunctionString = "\n"
+                              "def sech(x):\n"
+                              "    return 1.0/cosh(x)\n";
+        mCschFunctionString = "\n"
+                              "def csch(x):\n"
+                              "    return 1.0/sinh(x)\n";
+        mCothFunctionString = "\n"
+                              "def coth(x):\n"
+                              "    return 1.0/tanh(x)\n";
+        mAsecFunctionString = "\n"
+                              "def asec(x):\n"
+                              "    return acos(1.0/x)\n";
+        mAcscFunctionString = "\n"
+                              "def acsc(x):\n"
+                              "    return asin(1.0/x)\n";
+        mAcotFunctionString = "\n"
+                              "def acot(x):\n"
+                              "    return atan(1.0/x)\n";
+        mAsechFunctionString = "\n"
+                               "def asech(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return log(one_over_x+sqrt(one_over_x*one_over_x-1.0))\n";
+        mAcschFunctionString = "\n"
+                               "def acsch(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return log(one_over_x+sqrt(one_over_x*one_over_x+1.0))\n";
+        mAcothFunctionString = "\n"
+                               "def acoth(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return 0.5*log((1.0+one_over_x)/(1.0-one_over_x))\n";
+
+        // Miscellaneous.
+
+        mCommentString = "# <CODE>\n";
+        mOriginCommentString = "The content of this file was generated using <PROFILE_INFORMATION> libCellML <LIBCELLML_VERSION>.";
+
+        mInterfaceFileNameString = "";
+
+        mInterfaceHeaderString = "";
+        mImplementationHeaderString = "from enum import Enum\n"
+                                      "from math import *\n"
+                                      "\n";
+        mImplementationFooterString = "";
+
+        mInterfaceVersionString = "";
+        mImplementationVersionString = "__version__ = \"0.2.0\"\n";
+
+        mInterfaceLibcellmlVersionString = "";
+        mImplementationLibcellmlVersionString = "LIBCELLML_VERSION = \"<LIBCELLML_VERSION>\"\n";
+
+        mInterfaceStateCountString = "";
+        mImplementationStateCountString = "STATE_COUNT = <STATE_COUNT>\n";
+
+        mInterfaceVariableCountString = "";
+        mImplementationVariableCountString = "VARIABLE_COUNT = <VARIABLE_COUNT>\n";
+
+        mVariableTypeObjectString = "\n"
+                                    "class VariableType(Enum):\n"
+                                    "    CONSTANT = 1\n"
+                                    "    COMPUTED_CONSTANT = 2\n"
+                                    "    ALGEBRAIC = 3<OPTIONAL_TYPE>\n"
+                                    "\n";
+        mVariableTypeObjectExternalTypeString = "\n    EXTERNAL = 4";
+
+        mConstantVariableTypeString = "VariableType.CONSTANT";
+        mComputedConstantVariableTypeString = "VariableType.COMPUTED_CONSTANT";
+        mAlgebraicVariableTypeString = "VariableType.ALGEBRAIC";
+        mExternalVariableTypeString = "VariableType.EXTERNAL";
+
+        mVariableInfoObjectString = "";
+        mVariableInfoWithTypeObjectString = "";
+
+        mInterfaceVoiInfoString = "";
+        mImplementationVoiInfoString = "VOI_INFO = <CODE>\n";
+
+        mInterfaceStateInfoString = "";
+        mImplementationStateInfoString = "STATE_INFO = [\n"
+                                         "<CODE>"
+                                         "]\n";
+
+        mInterfaceVariableInfoString = "";
+        mImplementationVariableInfoString = "VARIABLE_INFO = [\n"
+                                            "<CODE>"
+                                            "]\n";
+
+        mVariableInfoEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\"}";
+        mVariableInfoWithTypeEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\", \"type\": <TYPE>}";
+
+        mVoiString = "voi";
+
+        mStatesArrayString = "states";
+        mRatesArrayString = "rates";
+        mVariablesArrayString = "variables";
+
+        mExternalVariableMethodTypeDefinitionString = "";
+        mExternalVariableMethodParameterString = ", external_variable";
+        mExternalVariableMethodCallString = "external_variable(voi, states, rates, variables, <INDEX>)";
+
+        mInterfaceCreateStatesArrayMethodString = "";
+        mImplementationCreateStatesArrayMethodString = "\n"
+                                                       "def create_states_array():\n"
+                                                       "    return [nan]*STATE_COUNT\n";
+
+        mInterfaceCreateVariablesArrayMethodString = "";
+        mImplementationCreateVariablesArrayMethodString = "\n"
+                                                          "def create_variables_array():\n"
+                                                          "    return [nan]*VARIABLE_COUNT\n";
+
+        mInterfaceDeleteArrayMethodString = "";
+        mImplementationDeleteArrayMethodString = "";
+
+        mInterfaceInitialiseStatesAndConstantsMethodString = "";
+        mImplementationInitialiseStatesAndConstantsMethodString = "\n"
+                                                                  "def initialise_states_and_constants(states, variables):\n"
+                                                                  "<CODE>";
+
+        mInterfaceComputeComputedConstantsMethodString = "";
+        mImplementationComputeComputedConstantsMethodString = "\n"
+                                                              "def compute_computed_constants(variables):\n"
+                                                              "<CODE>";
+
+        mInterfaceComputeRatesMethodString = "";
+        mImplementationComputeRatesMethodString = "\n"
+                                                  "def compute_rates(voi, states, rates, variables<OPTIONAL_PARAMETER>):\n"
+                                                  "<CODE>";
+
+        mInterfaceComputeVariablesMethodString = "";
+        mImplementationComputeVariablesMethodString = "\n"
+                                                      "def compute_variables(voi, states, rates, variables<OPTIONAL_PARAMETER>):\n"
+                                                      "<CODE>";
+
+        mEmptyMethodString = "pass\n";
+
+        mIndentString = "    ";
+
+        mOpenArrayInitialiserString = "[";
+        mCloseArrayInitialiserString = "]";
+
+        mOpenArrayString = "[";
+        mCloseArrayString = "]";
+
+        mArrayElementSeparatorString = ",";
+
+        mStringDelimiterString = "\"";
+
+        mCommandSeparatorString = "";
+    } else if (profile == GeneratorProfile::Profile::C_SIMD) {
+        // Whether the profile requires an interface to be generated.
+
+        mHasInterface = true;
+
+        // Assignment.
+
+        mAssignmentString = " = ";
+
+        // Relational and logical operators.
+
+        mEqString = " == ";
+        mNeqString = " != ";
+        mLtString = " < ";
+        mLeqString = " <= ";
+        mGtString = " > ";
+        mGeqString = " >= ";
+        mAndString = " && ";
+        mOrString = " || ";
+        mXorString = "xor";
+        mNotString = "!";
+
+        mHasEqOperator = true;
+        mHasNeqOperator = true;
+        mHasLtOperator = true;
+        mHasLeqOperator = true;
+        mHasGtOperator = true;
+        mHasGeqOperator = true;
+        mHasAndOperator = true;
+        mHasOrOperator = true;
+        mHasXorOperator = false;
+        mHasNotOperator = true;
+
+        // Arithmetic operators.
+
+        mPlusString = "+";
+        mMinusString = "-";
+        mTimesString = "*";
+        mDivideString = "/";
+        mPowerString = "pow";
+        mSquareRootString = "sqrt";
+        mSquareString = "";
+        mAbsoluteValueString = "fabs";
+        mExponentialString = "exp";
+        mNaturalLogarithmString = "log";
+        mCommonLogarithmString = "log10";
+        mCeilingString = "ceil";
+        mFloorString = "floor";
+        mMinString = "min";
+        mMaxString = "max";
+        mRemString = "fmod";
+
+        mHasPowerOperator = false;
+
+        // Trigonometric operators.
+
+        mSinString = "sin";
+        mCosString = "cos";
+        mTanString = "tan";
+        mSecString = "sec";
+        mCscString = "csc";
+        mCotString = "cot";
+        mSinhString = "sinh";
+        mCoshString = "cosh";
+        mTanhString = "tanh";
+        mSechString = "sech";
+        mCschString = "csch";
+        mCothString = "coth";
+        mAsinString = "asin";
+        mAcosString = "acos";
+        mAtanString = "atan";
+        mAsecString = "asec";
+        mAcscString = "acsc";
+        mAcotString = "acot";
+        mAsinhString = "asinh";
+        mAcoshString = "acosh";
+        mAtanhString = "atanh";
+        mAsechString = "asech";
+        mAcschString = "acsch";
+        mAcothString = "acoth";
+
+        // Piecewise statement.
+
+        mConditionalOperatorIfString = "(<CONDITION>)?<IF_STATEMENT>";
+        mConditionalOperatorElseString = ":<ELSE_STATEMENT>";
+
+        mHasConditionalOperator = true;
+
+        mBranchlessPiecewiseString = "blend(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)";
+
+        mHasBranchlessPiecewise = true;
+
+        // Constants.
+
+        mTrueString = "1.0";
+        mFalseString = "0.0";
+        mEString = convertToString(exp(1.0));
+        mPiString = convertToString(M_PI);
+        mInfString = "INFINITY";
+        mNanString = "NAN";
+        mRealLiteralPrefixString = "";
+        mRealLiteralSuffixString = "";
+
+        // Arithmetic functions.
+
+        mEqFunctionString = "";
+        mNeqFunctionString = "";
+        mLtFunctionString = "";
+        mLeqFunctionString = "";
+        mGtFunctionString = "";
+        mGeqFunctionString = "";
+        mAndFunctionString = "";
+        mOrFunctionString = "";
+        mXorFunctionString = "#pragma omp declare simd\n"
+                             "double xor(double x, double y)\n"
+                             "{\n"
+                             "    return (x != 0.0) ^ (y != 0.0);\n"
+                             "}\n";
+        mNotFunctionString = "";
+        mMinFunctionString = "#pragma omp declare simd\n"
+                             "double min(double x, double y)\n"
+                             "{\n"
+                             "    return (x < y)?x:y;\n"
+                             "}\n";
+        mMaxFunctionString = "#pragma omp declare simd\n"
+                             "double max(double x, double y)\n"
+                             "{\n"
+                             "    return (x > y)?x:y;\n"
+                             "}\n";
+        mBlendFunctionString = "#pragma omp declare simd\n"
+                               "double blend(double condition, double x, double y)\n"
+                               "{\n"
+                               "    return (condition != 0.0)?x:y;\n"
+                               "}\n";
+
+        // Trigonometric functions.
+
+        mSecFunctionString = "#pragma omp declare simd\n"
+                             "double sec(double x)\n"
+                             "{\n"
+                             "    return 1.0/cos(x);\n"
+                             "}\n";
+        mCscFunctionString = "#pragma omp declare simd\n"
+                             "double csc(double x)\n"
+                             "{\n"
+                             "    return 1.0/sin(x);\n"
+                             "}\n";
+        mCotFunctionString = "#pragma omp declare simd\n"
+                             "double cot(double x)\n"
+                             "{\n"
+                             "    return 1.0/tan(x);\n"
+                             "}\n";
+        mSechFunctionString = "#pragma omp declare simd\n"
+                              "double sech(double x)\n"
+                              "{\n"
+                              "    return 1.0/cosh(x);\n"
+                              "}\n";
+        mCschFunctionString = "#pragma omp declare simd\n"
+                              "double csch(double x)\n"
+                              "{\n"
+                              "    return 1.0/sinh(x);\n"
+                              "}\n";
+        mCothFunctionString = "#pragma omp declare simd\n"
+                              "double coth(double x)\n"
+                              "{\n"
+                              "    return 1.0/tanh(x);\n"
+                              "}\n";
+        mAsecFunctionString = "#pragma omp declare simd\n"
+                              "double asec(double x)\n"
+                              "{\n"
+                              "    return acos(1.0/x);\n"
+                              "}\n";
+        mAcscFunctionString = "#pragma omp declare simd\n"
+                              "double acsc(double x)\n"
+                              "{\n"
+                              "    return asin(1.0/x);\n"
+                              "}\n";
+        mAcotFunctionString = "#pragma omp declare simd\n"
+                              "double acot(double x)\n"
+                              "{\n"
+                              "    return atan(1.0/x);\n"
+                              "}\n";
+        mAsechFunctionString = "#pragma omp declare simd\n"
+                               "double asech(double x)\n"
+                               "{\n"
+                               "    double oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));\n"
+                               "}\n";
+        mAcschFunctionString = "#pragma omp declare simd\n"
+                               "double acsch(double x)\n"
+                               "{\n"
+                               "    double oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));\n"
+                               "}\n";
+        mAcothFunctionString = "#pragma omp declare simd\n"
+                               "double acoth(double x)\n"
+                               "{\n"
+                               "    double oneOverX = 1.0/x;\n"
+                               "\n"
+                               "    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));\n"
+                               "}\n";
+
+        // Miscellaneous.
+
+        mCommentString = "/* <CODE> */\n";
+        mOriginCommentString = "The content of this file was generated using <PROFILE_INFORMATION> libCellML <LIBCELLML_VERSION>.";
+
+        mInterfaceFileNameString = "model.h";
+
+        mInterfaceHeaderString = "#pragma once\n"
+                                 "\n"
+                                 "#include <stddef.h>\n"
+                                 "\n"
+                                 "#ifndef LANE_COUNT\n"
+                                 "#    define LANE_COUNT 8\n"
+                                 "#endif\n"
+                                 "\n"
+                                 "typedef double Lanes[LANE_COUNT];\n";
+        mImplementationHeaderString = "#include \"<INTERFACE_FILE_NAME>\"\n"
+                                      "\n"
+                                      "#include <math.h>\n"
+                                      "#include <stdlib.h>\n";
+        mImplementationFooterString = "";
+
+        mInterfaceVersionString = "extern const char VERSION[];\n";
+        mImplementationVersionString = "const char VERSION[] = \"0.2.0\";\n";
+
+        mInterfaceLibcellmlVersionString = "extern const char LIBCELLML_VERSION[];\n";
+        mImplementationLibcellmlVersionString = "const char LIBCELLML_VERSION[] = \"<LIBCELLML_VERSION>\";\n";
+
+        mInterfaceStateCountString = "extern const size_t STATE_COUNT;\n";
+        mImplementationStateCountString = "const size_t STATE_COUNT = <STATE_COUNT>;\n";
+
+        mInterfaceVariableCountString = "extern const size_t VARIABLE_COUNT;\n";
+        mImplementationVariableCountString = "const size_t VARIABLE_COUNT = <VARIABLE_COUNT>;\n";
+
+        mVariableTypeObjectString = "typedef enum {\n"
+                                    "    CONSTANT,\n"
+                                    "    COMPUTED_CONSTANT,\n"
+                                    "    ALGEBRAIC<OPTIONAL_TYPE>\n"
+                                    "} VariableType;\n";
+        mVariableTypeObjectExternalTypeString = ",\n    EXTERNAL";
+
+        mConstantVariableTypeString = "CONSTANT";
+        mComputedConstantVariableTypeString = "COMPUTED_CONSTANT";
+        mAlgebraicVariableTypeString = "ALGEBRAIC";
+        mExternalVariableTypeString = "EXTERNAL";
+
+        mVariableInfoObjectString = "typedef struct {\n"
+                                    "    char name[<NAME_SIZE>];\n"
+                                    "    char units[<UNITS_SIZE>];\n"
+                                    "    char component[<COMPONENT_SIZE>];\n"
+                                    "} VariableInfo;\n";
+        mVariableInfoWithTypeObjectString = "typedef struct {\n"
+                                            "    char name[<NAME_SIZE>];\n"
+                                            "    char units[<UNITS_SIZE>];\n"
+                                            "    char component[<COMPONENT_SIZE>];\n"
+                                            "    VariableType type;\n"
+                                            "} VariableInfoWithType;\n";
+
+        mInterfaceVoiInfoString = "extern const VariableInfo VOI_INFO;\n";
+        mImplementationVoiInfoString = "const VariableInfo VOI_INFO = <CODE>;\n";
+
+        mInterfaceStateInfoString = "extern const VariableInfo STATE_INFO[];\n";
+        mImplementationStateInfoString = "const VariableInfo STATE_INFO[] = {\n"
+                                         "<CODE>"
+                                         "};\n";
+
+        mInterfaceVariableInfoString = "extern const VariableInfoWithType VARIABLE_INFO[];\n";
+        mImplementationVariableInfoString = "const VariableInfoWithType VARIABLE_INFO[] = {\n"
+                                            "<CODE>"
+                                            "};\n";
+
+        mVariableInfoEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\"}";
+        mVariableInfoWithTypeEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\", <TYPE>}";
+
+        mVoiString = "voi";
+
+        mStatesArrayString = "states";
+        mRatesArrayString = "rates";
+        mVariablesArrayString = "variables";
+
+        mExternalVariableMethodTypeDefinitionString = "";
+        mExternalVariableMethodParameterString = "";
+        mExternalVariableMethodCallString = "";
+
+        mInterfaceCreateStatesArrayMethodString = "Lanes * createStatesArray();\n";
+        mImplementationCreateStatesArrayMethodString = "Lanes * createStatesArray()\n"
+                                                       "{\n"
+                                                       "    return (Lanes *) malloc(STATE_COUNT*sizeof(Lanes));\n"
+                                                       "}\n";
+
+        mInterfaceCreateVariablesArrayMethodString = "Lanes * createVariablesArray();\n";
+        mImplementationCreateVariablesArrayMethodString = "Lanes * createVariablesArray()\n"
+                                                          "{\n"
+                                                          "    return (Lanes *) malloc(VARIABLE_COUNT*sizeof(Lanes));\n"
+                                                          "}\n";
+
+        mInterfaceDeleteArrayMethodString = "void deleteArray(Lanes *array);\n";
+        mImplementationDeleteArrayMethodString = "void deleteArray(Lanes *array)\n"
+                                                 "{\n"
+                                                 "    free(array);\n"
+                                                 "}\n";
+
+        mInterfaceInitialiseStatesAndConstantsMethodString = "void initialiseStatesAndConstants(Lanes *states, Lanes *variables);\n";
+        mImplementationInitialiseStatesAndConstantsMethodString = "#pragma omp declare simd uniform(states, variables) linear(lane)\n"
+                                                                  "static void initialiseStatesAndConstantsLane(Lanes *states, Lanes *variables, size_t lane)\n"
+                                                                  "{\n"
+                                                                  "<CODE>"
+                                                                  "}\n"
+                                                                  "\n"
+                                                                  "void initialiseStatesAndConstants(Lanes *states, Lanes *variables)\n"
+                                                                  "{\n"
+                                                                  "#pragma omp simd\n"
+                                                                  "    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {\n"
+                                                                  "        initialiseStatesAndConstantsLane(states, variables, lane);\n"
+                                                                  "    }\n"
+                                                                  "}\n";
+
+        mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(Lanes *variables);\n";
+        mImplementationComputeComputedConstantsMethodString = "#pragma omp declare simd uniform(variables) linear(lane)\n"
+                                                              "static void computeComputedConstantsLane(Lanes *variables, size_t lane)\n"
+                                                              "{\n"
+                                                              "<CODE>"
+                                                              "}\n"
+                                                              "\n"
+                                                              "void computeComputedConstants(Lanes *variables)\n"
+                                                              "{\n"
+                                                              "#pragma omp simd\n"
+                                                              "    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {\n"
+                                                              "        computeComputedConstantsLane(variables, lane);\n"
+                                                              "    }\n"
+                                                              "}\n";
+
+        mInterfaceComputeRatesMethodString = "void computeRates(double voi, Lanes *states, Lanes *rates, Lanes *variables);\n";
+        mImplementationComputeRatesMethodString = "#pragma omp declare simd uniform(voi, states, rates, variables) linear(lane)\n"
+                                                  "static void computeRatesLane(double voi, Lanes *states, Lanes *rates, Lanes *variables, size_t lane)\n"
+                                                  "{\n"
+                                                  "<CODE>"
+                                                  "}\n"
+                                                  "\n"
+                                                  "void computeRates(double voi, Lanes *states, Lanes *rates, Lanes *variables)\n"
+                                                  "{\n"
+                                                  "#pragma omp simd\n"
+                                                  "    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {\n"
+                                                  "        computeRatesLane(voi, states, rates, variables, lane);\n"
+                                                  "    }\n"
+                                                  "}\n";
+
+        mInterfaceComputeVariablesMethodString = "void computeVariables(double voi, Lanes *states, Lanes *rates, Lanes *variables);\n";
+        mImplementationComputeVariablesMethodString = "#pragma omp declare simd uniform(voi, states, rates, variables) linear(lane)\n"
+                                                      "static void computeVariablesLane(double voi, Lanes *states, Lanes *rates, Lanes *variables, size_t lane)\n"
+                                                      "{\n"
+                                                      "<CODE>"
+                                                      "}\n"
+                                                      "\n"
+                                                      "void computeVariables(double voi, Lanes *states, Lanes *rates, Lanes *variables)\n"
+                                                      "{\n"
+                                                      "#pragma omp simd\n"
+                                                      "    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {\n"
+                                                      "        computeVariablesLane(voi, states, rates, variables, lane);\n"
+                                                      "    }\n"
+                                                      "}\n";
+
+        mEmptyMethodString = "";
+
+        mIndentString = "    ";
+
+        mOpenArrayInitialiserString = "{";
+        mCloseArrayInitialiserString = "}";
+
+        mOpenArrayString = "[";
+        mCloseArrayString = "][lane]";
+
+        mArrayElementSeparatorString = ",";
+
+        mStringDelimiterString = "\"";
+
+        mCommandSeparatorString = ";";
+    } else if (profile == GeneratorProfile::Profile::CXX) {
+        // Whether the profile requires an interface to be generated.
+
+        mHasInterface = false;
+
+        // Assignment.
+
+        mAssignmentString = " = ";
+
+        // Relational and logical operators.
+
+        mEqString = " == ";
+        mNeqString = " != ";
+        mLtString = " < ";
+        mLeqString = " <= ";
+        mGtString = " > ";
+        mGeqString = " >= ";
+        mAndString = " && ";
+        mOrString = " || ";
+        mXorString = "xorFunc<Real>";
+        mNotString = "!";
+
+        mHasEqOperator = true;
+        mHasNeqOperator = true;
+        mHasLtOperator = true;
+        mHasLeqOperator = true;
+        mHasGtOperator = true;
+        mHasGeqOperator = true;
+        mHasAndOperator = true;
+        mHasOrOperator = true;
+        mHasXorOperator = false;
+        mHasNotOperator = true;
+
+        // Arithmetic operators.
+
+        mPlusString = "+";
+        mMinusString = "-";
+        mTimesString = "*";
+        mDivideString = "/";
+        mPowerString = "pow";
+        mSquareRootString = "sqrt";
+        mSquareString = "";
+        mAbsoluteValueString = "fabs";
+        mExponentialString = "exp";
+        mNaturalLogarithmString = "log";
+        mCommonLogarithmString = "log10";
+        mCeilingString = "ceil";
+        mFloorString = "floor";
+        mMinString = "min<Real>";
+        mMaxString = "max<Real>";
+        mRemString = "fmod";
+
+        mHasPowerOperator = false;
+
+        // Trigonometric operators.
+
+        mSinString = "sin";
+        mCosString = "cos";
+        mTanString = "tan";
+        mSecString = "sec<Real>";
+        mCscString = "csc<Real>";
+        mCotString = "cot<Real>";
+        mSinhString = "sinh";
+        mCoshString = "cosh";
+        mTanhString = "tanh";
+        mSechString = "sech<Real>";
+        mCschString = "csch<Real>";
+        mCothString = "coth<Real>";
+        mAsinString = "asin";
+        mAcosString = "acos";
+        mAtanString = "atan";
+        mAsecString = "asec<Real>";
+        mAcscString = "acsc<Real>";
+        mAcotString = "acot<Real>";
+        mAsinhString = "asinh";
+        mAcoshString = "acosh";
+        mAtanhString = "atanh";
+        mAsechString = "asech<Real>";
+        mAcschString = "acsch<Real>";
+        mAcothString = "acoth<Real>";
+
+        // Piecewise statement.
+
+        mConditionalOperatorIfString = "(<CONDITION>)?<IF_STATEMENT>";
+        mConditionalOperatorElseString = ":<ELSE_STATEMENT>";
+
+        mHasConditionalOperator = true;
+
+        mBranchlessPiecewiseString = "blend<Real>(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)";
+
+        mHasBranchlessPiecewise = false;
+
+        // Constants.
+
+        mTrueString = "Real(1.0)";
+        mFalseString = "Real(0.0)";
+        mEString = "Real(" + convertToString(exp(1.0)) + ")";
+        mPiString = "Real(" + convertToString(M_PI) + ")";
+        mInfString = "Real(INFINITY)";
+        mNanString = "Real(NAN)";
+        mRealLiteralPrefixString = "Real(";
+        mRealLiteralSuffixString = ")";
+
+        // Arithmetic functions.
+
+        mEqFunctionString = "";
+        mNeqFunctionString = "";
+        mLtFunctionString = "";
+        mLeqFunctionString = "";
+        mGtFunctionString = "";
+        mGeqFunctionString = "";
+        mAndFunctionString = "";
+        mOrFunctionString = "";
+        mXorFunctionString = "    template<typename Real>\n"
+                             "    static Real xorFunc(Real x, Real y)\n"
+                             "    {\n"
+                             "        return ((x != Real(0.0)) != (y != Real(0.0)))?Real(1.0):Real(0.0);\n"
+                             "    }\n";
+        mNotFunctionString = "";
+        mMinFunctionString = "    template<typename Real>\n"
+                             "    static Real min(Real x, Real y)\n"
+                             "    {\n"
+                             "        return (x < y)?x:y;\n"
+                             "    }\n";
+        mMaxFunctionString = "    template<typename Real>\n"
+                             "    static Real max(Real x, Real y)\n"
+                             "    {\n"
+                             "        return (x > y)?x:y;\n"
+                             "    }\n";
+        mBlendFunctionString = "    template<typename Real>\n"
+                               "    static Real blend(Real condition, Real x, Real y)\n"
+                               "    {\n"
+                               "        return (condition != Real(0.0))?x:y;\n"
+                               "    }\n";
 
         // Trigonometric functions.
 
-        mSecFunctionString = "\n"
-                             "def sec(x):\n"
-                             "    return 1.0/cos(x)\n";
-        mCscFunctionString = "\n"
-                             "def csc(x):\n"
-                             "    return 1.0/sin(x)\n";
-        mCotFunctionString = "\n"
-                             "def cot(x):\n"
-                             "    return 1.0/tan(x)\n";
-        mSechFunctionString = "\n"
-                              "def sech(x):\n"
-                              "    return 1.0/cosh(x)\n";
-        mCschFunctionString = "\n"
-                              "def csch(x):\n"
-                              "    return 1.0/sinh(x)\n";
-        mCothFunctionString = "\n"
-                              "def coth(x):\n"
-                              "    return 1.0/tanh(x)\n";
-        mAsecFunctionString = "\n"
-                              "def asec(x):\n"
-                              "    return acos(1.0/x)\n";
-        mAcscFunctionString = "\n"
-                              "def acsc(x):\n"
-                              "    return asin(1.0/x)\n";
-        mAcotFunctionString = "\n"
-                              "def acot(x):\n"
-                              "    return atan(1.0/x)\n";
-        mAsechFunctionString = "\n"
-                               "def asech(x):\n"
-                               "    one_over_x = 1.0/x\n"
+        mSecFunctionString = "    template<typename Real>\n"
+                             "    static Real sec(Real x)\n"
+                             "    {\n"
+                             "        using namespace std;\n"
+                             "\n"
+                             "        return Real(1.0)/cos(x);\n"
+                             "    }\n";
+        mCscFunctionString = "    template<typename Real>\n"
+                             "    static Real csc(Real x)\n"
+                             "    {\n"
+                             "        using namespace std;\n"
+                             "\n"
+                             "        return Real(1.0)/sin(x);\n"
+                             "    }\n";
+        mCotFunctionString = "    template<typename Real>\n"
+                             "    static Real cot(Real x)\n"
+                             "    {\n"
+                             "        using namespace std;\n"
+                             "\n"
+                             "        return Real(1.0)/tan(x);\n"
+                             "    }\n";
+        mSechFunctionString = "    template<typename Real>\n"
+                              "    static Real sech(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return Real(1.0)/cosh(x);\n"
+                              "    }\n";
+        mCschFunctionString = "    template<typename Real>\n"
+                              "    static Real csch(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return Real(1.0)/sinh(x);\n"
+                              "    }\n";
+        mCothFunctionString = "    template<typename Real>\n"
+                              "    static Real coth(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return Real(1.0)/tanh(x);\n"
+                              "    }\n";
+        mAsecFunctionString = "    template<typename Real>\n"
+                              "    static Real asec(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return acos(Real(1.0)/x);\n"
+                              "    }\n";
+        mAcscFunctionString = "    template<typename Real>\n"
+                              "    static Real acsc(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return asin(Real(1.0)/x);\n"
+                              "    }\n";
+        mAcotFunctionString = "    template<typename Real>\n"
+                              "    static Real acot(Real x)\n"
+                              "    {\n"
+                              "        using namespace std;\n"
+                              "\n"
+                              "        return atan(Real(1.0)/x);\n"
+                              "    }\n";
+        mAsechFunctionString = "    template<typename Real>\n"
+                               "    static Real asech(Real x)\n"
+                               "    {\n"
+                               "        using namespace std;\n"
                                "\n"
-                               "    return log(one_over_x+sqrt(one_over_x*one_over_x-1.0))\n";
-        mAcschFunctionString = "\n"
-                               "def acsch(x):\n"
-                               "    one_over_x = 1.0/x\n"
+                               "        Real oneOverX = Real(1.0)/x;\n"
                                "\n"
-                               "    return log(one_over_x+sqrt(one_over_x*one_over_x+1.0))\n";
-        mAcothFunctionString = "\n"
-                               "def acoth(x):\n"
-                               "    one_over_x = 1.0/x\n"
+                               "        return log(oneOverX+sqrt(oneOverX*oneOverX-Real(1.0)));\n"
+                               "    }\n";
+        mAcschFunctionString = "    template<typename Real>\n"
+                               "    static Real acsch(Real x)\n"
+                               "    {\n"
+                               "        using namespace std;\n"
                                "\n"
-                               "    return 0.5*log((1.0+one_over_x)/(1.0-one_over_x))\n";
+                               "        Real oneOverX = Real(1.0)/x;\n"
+                               "\n"
+                               "        return log(oneOverX+sqrt(oneOverX*oneOverX+Real(1.0)));\n"
+                               "    }\n";
+        mAcothFunctionString = "    template<typename Real>\n"
+                               "    static Real acoth(Real x)\n"
+                               "    {\n"
+                               "        using namespace std;\n"
+                               "\n"
+                               "        Real oneOverX = Real(1.0)/x;\n"
+                               "\n"
+                               "        return Real(0.5)*log((Real(1.0)+oneOverX)/(Real(1.0)-oneOverX));\n"
+                               "    }\n";
 
         // Miscellaneous.
 
-        mCommentString = "# <CODE>\n";
+        mCommentString = "/* <CODE> */\n";
         mOriginCommentString = "The content of this file was generated using <PROFILE_INFORMATION> libCellML <LIBCELLML_VERSION>.";
 
         mInterfaceFileNameString = "";
 
         mInterfaceHeaderString = "";
-        mImplementationHeaderString = "from enum import Enum\n"
-                                      "from math import *\n"
-                                      "\n";
+        mImplementationHeaderString = "#pragma once\n"
+                                      "\n"
+                                      "#include <array>\n"
+                                      "#include <cmath>\n"
+                                      "#include <cstddef>\n"
+                                      "\n"
+                                      "struct Model\n"
+                                      "{";
+        mImplementationFooterString = "};\n";
 
         mInterfaceVersionString = "";
-        mImplementationVersionString = "__version__ = \"0.2.0\"\n";
+        mImplementationVersionString = "    static constexpr char VERSION[] = \"0.2.0\";\n";
 
         mInterfaceLibcellmlVersionString = "";
-        mImplementationLibcellmlVersionString = "LIBCELLML_VERSION = \"<LIBCELLML_VERSION>\"\n";
+        mImplementationLibcellmlVersionString = "    static constexpr char LIBCELLML_VERSION[] = \"<LIBCELLML_VERSION>\";\n";
 
         mInterfaceStateCountString = "";
-        mImplementationStateCountString = "STATE_COUNT = <STATE_COUNT>\n";
+        mImplementationStateCountString = "    static constexpr size_t STATE_COUNT = <STATE_COUNT>;\n";
 
         mInterfaceVariableCountString = "";
-        mImplementationVariableCountString = "VARIABLE_COUNT = <VARIABLE_COUNT>\n";
-
-        mVariableTypeObjectString = "\n"
-                                    "class VariableType(Enum):\n"
-                                    "    CONSTANT = 1\n"
-                                    "    COMPUTED_CONSTANT = 2\n"
-                                    "    ALGEBRAIC = 3<OPTIONAL_TYPE>\n"
-                                    "\n";
-        mVariableTypeObjectExternalTypeString = "\n    EXTERNAL = 4";
-
-        mConstantVariableTypeString = "VariableType.CONSTANT";
-        mComputedConstantVariableTypeString = "VariableType.COMPUTED_CONSTANT";
-        mAlgebraicVariableTypeString = "VariableType.ALGEBRAIC";
-        mExternalVariableTypeString = "VariableType.EXTERNAL";
-
-        mVariableInfoObjectString = "";
-        mVariableInfoWithTypeObjectString = "";
+        mImplementationVariableCountString = "    static constexpr size_t VARIABLE_COUNT = <VARIABLE_COUNT>;\n";
+
+        mVariableTypeObjectString = "    enum class VariableType\n"
+                                    "    {\n"
+                                    "        CONSTANT,\n"
+                                    "        COMPUTED_CONSTANT,\n"
+                                    "        ALGEBRAIC<OPTIONAL_TYPE>\n"
+                                    "    };\n";
+        mVariableTypeObjectExternalTypeString = ",\n        EXTERNAL";
+
+        mConstantVariableTypeString = "VariableType::CONSTANT";
+        mComputedConstantVariableTypeString = "VariableType::COMPUTED_CONSTANT";
+        mAlgebraicVariableTypeString = "VariableType::ALGEBRAIC";
+        mExternalVariableTypeString = "VariableType::EXTERNAL";
+
+        mVariableInfoObjectString = "    struct VariableInfo\n"
+                                    "    {\n"
+                                    "        char name[<NAME_SIZE>];\n"
+                                    "        char units[<UNITS_SIZE>];\n"
+                                    "        char component[<COMPONENT_SIZE>];\n"
+                                    "    };\n";
+        mVariableInfoWithTypeObjectString = "    struct VariableInfoWithType\n"
+                                            "    {\n"
+                                            "        char name[<NAME_SIZE>];\n"
+                                            "        char units[<UNITS_SIZE>];\n"
+                                            "        char component[<COMPONENT_SIZE>];\n"
+                                            "        VariableType type;\n"
+                                            "    };\n";
 
         mInterfaceVoiInfoString = "";
-        mImplementationVoiInfoString = "VOI_INFO = <CODE>\n";
+        mImplementationVoiInfoString = "    static constexpr VariableInfo VOI_INFO = <CODE>;\n";
 
         mInterfaceStateInfoString = "";
-        mImplementationStateInfoString = "STATE_INFO = [\n"
+        mImplementationStateInfoString = "    static constexpr std::array<VariableInfo, STATE_COUNT> STATE_INFO = {{\n"
                                          "<CODE>"
-                                         "]\n";
+                                         "    }};\n";
 
         mInterfaceVariableInfoString = "";
-        mImplementationVariableInfoString = "VARIABLE_INFO = [\n"
+        mImplementationVariableInfoString = "    static constexpr std::array<VariableInfoWithType, VARIABLE_COUNT> VARIABLE_INFO = {{\n"
                                             "<CODE>"
-                                            "]\n";
+                                            "    }};\n";
 
-        mVariableInfoEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\"}";
-        mVariableInfoWithTypeEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\", \"type\": <TYPE>}";
+        mVariableInfoEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\"}";
+        mVariableInfoWithTypeEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\", <TYPE>}";
 
         mVoiString = "voi";
 
@@ -819,48 +1596,74 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mVariablesArrayString = "variables";
 
         mExternalVariableMethodTypeDefinitionString = "";
-        mExternalVariableMethodParameterString = ", external_variable";
-        mExternalVariableMethodCallString = "external_variable(voi, states, rates, variables, <INDEX>)";
+        mExternalVariableMethodParameterString = "";
+        mExternalVariableMethodCallString = "";
 
         mInterfaceCreateStatesArrayMethodString = "";
-        mImplementationCreateStatesArrayMethodString = "\n"
-                                                       "def create_states_array():\n"
-                                                       "    return [nan]*STATE_COUNT\n";
+        mImplementationCreateStatesArrayMethodString = "    template<typename Real>\n"
+                                                       "    using States = std::array<Real, STATE_COUNT>;\n"
+                                                       "\n"
+                                                       "    template<typename Real>\n"
+                                                       "    static States<Real> createStatesArray()\n"
+                                                       "    {\n"
+                                                       "        return {};\n"
+                                                       "    }\n";
 
         mInterfaceCreateVariablesArrayMethodString = "";
-        mImplementationCreateVariablesArrayMethodString = "\n"
-                                                          "def create_variables_array():\n"
-                                                          "    return [nan]*VARIABLE_COUNT\n";
+        mImplementationCreateVariablesArrayMethodString = "    template<typename Real>\n"
+                                                          "    using Variables = std::array<Real, VARIABLE_COUNT>;\n"
+                                                          "\n"
+                                                          "    template<typename Real>\n"
+                                                          "    static Variables<Real> createVariablesArray()\n"
+                                                          "    {\n"
+                                                          "        return {};\n"
+                                                          "    }\n";
 
         mInterfaceDeleteArrayMethodString = "";
         mImplementationDeleteArrayMethodString = "";
 
         mInterfaceInitialiseStatesAndConstantsMethodString = "";
-        mImplementationInitialiseStatesAndConstantsMethodString = "\n"
-                                                                  "def initialise_states_and_constants(states, variables):\n"
-                                                                  "<CODE>";
+        mImplementationInitialiseStatesAndConstantsMethodString = "    template<typename Real>\n"
+                                                                  "    static void initialiseStatesAndConstants([[maybe_unused]] States<Real> &states, [[maybe_unused]] Variables<Real> &variables)\n"
+                                                                  "    {\n"
+                                                                  "        using namespace std;\n"
+                                                                  "\n"
+                                                                  "<CODE>"
+                                                                  "    }\n";
 
         mInterfaceComputeComputedConstantsMethodString = "";
-        mImplementationComputeComputedConstantsMethodString = "\n"
-                                                              "def compute_computed_constants(variables):\n"
-                                                              "<CODE>";
+        mImplementationComputeComputedConstantsMethodString = "    template<typename Real>\n"
+                                                              "    static void computeComputedConstants([[maybe_unused]] Variables<Real> &variables)\n"
+                                                              "    {\n"
+                                                              "        using namespace std;\n"
+                                                              "\n"
+                                                              "<CODE>"
+                                                              "    }\n";
 
         mInterfaceComputeRatesMethodString = "";
-        mImplementationComputeRatesMethodString = "\n"
-                                                  "def compute_rates(voi, states, rates, variables<OPTIONAL_PARAMETER>):\n"
-                                                  "<CODE>";
+        mImplementationComputeRatesMethodString = "    template<typename Real>\n"
+                                                  "    static void computeRates([[maybe_unused]] Real voi, [[maybe_unused]] const States<Real> &states, [[maybe_unused]] States<Real> &rates, [[maybe_unused]] Variables<Real> &variables)\n"
+                                                  "    {\n"
+                                                  "        using namespace std;\n"
+                                                  "\n"
+                                                  "<CODE>"
+                                                  "    }\n";
 
         mInterfaceComputeVariablesMethodString = "";
-        mImplementationComputeVariablesMethodString = "\n"
-                                                      "def compute_variables(voi, states, rates, variables<OPTIONAL_PARAMETER>):\n"
-                                                      "<CODE>";
+        mImplementationComputeVariablesMethodString = "    template<typename Real>\n"
+                                                      "    static void computeVariables([[maybe_unused]] Real voi, [[maybe_unused]] const States<Real> &states, [[maybe_unused]] const States<Real> &rates, [[maybe_unused]] Variables<Real> &variables)\n"
+                                                      "    {\n"
+                                                      "        using namespace std;\n"
+                                                      "\n"
+                                                      "<CODE>"
+                                                      "    }\n";
 
-        mEmptyMethodString = "pass\n";
+        mEmptyMethodString = "";
 
-        mIndentString = "    ";
+        mIndentString = "        ";
 
-        mOpenArrayInitialiserString = "[";
-        mCloseArrayInitialiserString = "]";
+        mOpenArrayInitialiserString = "{";
+        mCloseArrayInitialiserString = "}";
 
         mOpenArrayString = "[";
         mCloseArrayString = "]";
@@ -869,8 +1672,216 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mStringDelimiterString = "\"";
 
-        mCommandSeparatorString = "";
+        mCommandSeparatorString = ";";
+    }
+
+    loadPrecision();
+}
+
+void GeneratorProfile::GeneratorProfileImpl::loadPrecision()
+{
+    if (mPrecision == GeneratorProfile::Precision::DOUBLE) {
+        return;
+    }
+
+    if (mPrecision == GeneratorProfile::Precision::MIXED) {
+        // Store our states and rates using single precision and keep
+        // everything else in double precision. Since an array of states now
+        // has a different type from an array of variables, arrays get deleted
+        // through a void pointer.
+
+        mExternalVariableMethodTypeDefinitionString = "typedef double (* ExternalVariable)(double voi, float *states, float *rates, double *variables, size_t index);\n";
+
+        mInterfaceCreateStatesArrayMethodString = "float * createStatesArray();\n";
+        mImplementationCreateStatesArrayMethodString = "float * createStatesArray()\n"
+                                                       "{\n"
+                                                       "    return (float *) malloc(STATE_COUNT*sizeof(float));\n"
+                                                       "}\n";
+
+        mInterfaceDeleteArrayMethodString = "void deleteArray(void *array);\n";
+        mImplementationDeleteArrayMethodString = "void deleteArray(void *array)\n"
+                                                 "{\n"
+                                                 "    free(array);\n"
+                                                 "}\n";
+
+        mInterfaceInitialiseStatesAndConstantsMethodString = "void initialiseStatesAndConstants(float *states, double *variables);\n";
+        mImplementationInitialiseStatesAndConstantsMethodString = "void initialiseStatesAndConstants(float *states, double *variables)\n"
+                                                                  "{\n"
+                                                                  "<CODE>"
+                                                                  "}\n";
+
+        mInterfaceComputeRatesMethodString = "void computeRates(double voi, float *states, float *rates, double *variables<OPTIONAL_PARAMETER>);\n";
+        mImplementationComputeRatesMethodString = "void computeRates(double voi, float *states, float *rates, double *variables<OPTIONAL_PARAMETER>)\n{\n"
+                                                  "<CODE>"
+                                                  "}\n";
+
+        mInterfaceComputeVariablesMethodString = "void computeVariables(double voi, float *states, float *rates, double *variables<OPTIONAL_PARAMETER>);\n";
+        mImplementationComputeVariablesMethodString = "void computeVariables(double voi, float *states, float *rates, double *variables<OPTIONAL_PARAMETER>)\n"
+                                                      "{\n"
+                                                      "<CODE>"
+                                                      "}\n";
+
+        return;
     }
+
+    // Use single precision everywhere, i.e. for our types, our literals and
+    // the mathematical functions that we call.
+
+    // Arithmetic operators.
+
+    mPowerString = "powf";
+    mSquareRootString = "sqrtf";
+    mAbsoluteValueString = "fabsf";
+    mExponentialString = "expf";
+    mNaturalLogarithmString = "logf";
+    mCommonLogarithmString = "log10f";
+    mCeilingString = "ceilf";
+    mFloorString = "floorf";
+    mRemString = "fmodf";
+
+    // Trigonometric operators.
+
+    mSinString = "sinf";
+    mCosString = "cosf";
+    mTanString = "tanf";
+    mSinhString = "sinhf";
+    mCoshString = "coshf";
+    mTanhString = "tanhf";
+    mAsinString = "asinf";
+    mAcosString = "acosf";
+    mAtanString = "atanf";
+    mAsinhString = "asinhf";
+    mAcoshString = "acoshf";
+    mAtanhString = "atanhf";
+
+    // Constants.
+
+    mTrueString = "1.0f";
+    mFalseString = "0.0f";
+    mEString = convertToString(exp(1.0)) + "f";
+    mPiString = convertToString(M_PI) + "f";
+    mRealLiteralSuffixString = "f";
+
+    // Arithmetic functions.
+
+    mXorFunctionString = "float xor(float x, float y)\n"
+                         "{\n"
+                         "    return (x != 0.0f) ^ (y != 0.0f);\n"
+                         "}\n";
+    mMinFunctionString = "float min(float x, float y)\n"
+                         "{\n"
+                         "    return (x < y)?x:y;\n"
+                         "}\n";
+    mMaxFunctionString = "float max(float x, float y)\n"
+                         "{\n"
+                         "    return (x > y)?x:y;\n"
+                         "}\n";
+    mBlendFunctionString = "float blend(float condition, float x, float y)\n"
+                           "{\n"
+                           "    return (condition != 0.0f)?x:y;\n"
+                           "}\n";
+
+    // Trigonometric functions.
+
+    mSecFunctionString = "float sec(float x)\n"
+                         "{\n"
+                         "    return 1.0f/cosf(x);\n"
+                         "}\n";
+    mCscFunctionString = "float csc(float x)\n"
+                         "{\n"
+                         "    return 1.0f/sinf(x);\n"
+                         "}\n";
+    mCotFunctionString = "float cot(float x)\n"
+                         "{\n"
+                         "    return 1.0f/tanf(x);\n"
+                         "}\n";
+    mSechFunctionString = "float sech(float x)\n"
+                          "{\n"
+                          "    return 1.0f/coshf(x);\n"
+                          "}\n";
+    mCschFunctionString = "float csch(float x)\n"
+                          "{\n"
+                          "    return 1.0f/sinhf(x);\n"
+                          "}\n";
+    mCothFunctionString = "float coth(float x)\n"
+                          "{\n"
+                          "    return 1.0f/tanhf(x);\n"
+                          "}\n";
+    mAsecFunctionString = "float asec(float x)\n"
+                          "{\n"
+                          "    return acosf(1.0f/x);\n"
+                          "}\n";
+    mAcscFunctionString = "float acsc(float x)\n"
+                          "{\n"
+                          "    return asinf(1.0f/x);\n"
+                          "}\n";
+    mAcotFunctionString = "float acot(float x)\n"
+                          "{\n"
+                          "    return atanf(1.0f/x);\n"
+                          "}\n";
+    mAsechFunctionString = "float asech(float x)\n"
+                           "{\n"
+                           "    float oneOverX = 1.0f/x;\n"
+                           "\n"
+                           "    return logf(oneOverX+sqrtf(oneOverX*oneOverX-1.0f));\n"
+                           "}\n";
+    mAcschFunctionString = "float acsch(float x)\n"
+                           "{\n"
+                           "    float oneOverX = 1.0f/x;\n"
+                           "\n"
+                           "    return logf(oneOverX+sqrtf(oneOverX*oneOverX+1.0f));\n"
+                           "}\n";
+    mAcothFunctionString = "float acoth(float x)\n"
+                           "{\n"
+                           "    float oneOverX = 1.0f/x;\n"
+                           "\n"
+                           "    return 0.5f*logf((1.0f+oneOverX)/(1.0f-oneOverX));\n"
+                           "}\n";
+
+    // Miscellaneous.
+
+    mExternalVariableMethodTypeDefinitionString = "typedef float (* ExternalVariable)(float voi, float *states, float *rates, float *variables, size_t index);\n";
+
+    mInterfaceCreateStatesArrayMethodString = "float * createStatesArray();\n";
+    mImplementationCreateStatesArrayMethodString = "float * createStatesArray()\n"
+                                                   "{\n"
+                                                   "    return (float *) malloc(STATE_COUNT*sizeof(float));\n"
+                                                   "}\n";
+
+    mInterfaceCreateVariablesArrayMethodString = "float * createVariablesArray();\n";
+    mImplementationCreateVariablesArrayMethodString = "float * createVariablesArray()\n"
+                                                      "{\n"
+                                                      "    return (float *) malloc(VARIABLE_COUNT*sizeof(float));\n"
+                                                      "}\n";
+
+    mInterfaceDeleteArrayMethodString = "void deleteArray(float *array);\n";
+    mImplementationDeleteArrayMethodString = "void deleteArray(float *array)\n"
+                                             "{\n"
+                                             "    free(array);\n"
+                                             "}\n";
+
+    mInterfaceInitialiseStatesAndConstantsMethodString = "void initialiseStatesAndConstants(float *states, float *variables);\n";
+    mImplementationInitialiseStatesAndConstantsMethodString = "void initialiseStatesAndConstants(float *states, float *variables)\n"
+                                                              "{\n"
+                                                              "<CODE>"
+                                                              "}\n";
+
+    mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(float *variables);\n";
+    mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants(float *variables)\n"
+                                                          "{\n"
+                                                          "<CODE>"
+                                                          "}\n";
+
+    mInterfaceComputeRatesMethodString = "void computeRates(float voi, float *states, float *rates, float *variables<OPTIONAL_PARAMETER>);\n";
+    mImplementationComputeRatesMethodString = "void computeRates(float voi, float *states, float *rates, float *variables<OPTIONAL_PARAMETER>)\n{\n"
+                                              "<CODE>"
+                                              "}\n";
+
+    mInterfaceComputeVariablesMethodString = "void computeVariables(float voi, float *states, float *rates, float *variables<OPTIONAL_PARAMETER>);\n";
+    mImplementationComputeVariablesMethodString = "void computeVariables(float voi, float *states, float *rates, float *variables<OPTIONAL_PARAMETER>)\n"
+                                                  "{\n"
+                                                  "<CODE>"
+                                                  "}\n";
 }
 
 GeneratorProfile::GeneratorProfile(Profile profile)
@@ -899,6 +1910,25 @@ void GeneratorProfile::setProfile(Profile profile)
     mPimpl->loadProfile(profile);
 }
 
+GeneratorProfile::Precision GeneratorProfile::precision() const
+{
+    return mPimpl->mPrecision;
+}
+
+bool GeneratorProfile::setPrecision(Precision precision)
+{
+    if ((mPimpl->mProfile != Profile::C)
+        && (precision != Precision::DOUBLE)) {
+        return false;
+    }
+
+    mPimpl->mPrecision = precision;
+
+    mPimpl->loadProfile(mPimpl->mProfile);
+
+    return true;
+}
+
 bool GeneratorProfile::hasInterface() const
 {
     return mPimpl->mHasInterface;
@@ -1579,6 +2609,26 @@ void GeneratorProfile::setHasConditionalOperator(bool hasConditionalOperator)
     mPimpl->mHasConditionalOperator = hasConditionalOperator;
 }
 
+std::string GeneratorProfile::branchlessPiecewiseString() const
+{
+    return mPimpl->mBranchlessPiecewiseString;
+}
+
+void GeneratorProfile::setBranchlessPiecewiseString(const std::string &branchlessPiecewiseString)
+{
+    mPimpl->mBranchlessPiecewiseString = branchlessPiecewiseString;
+}
+
+bool GeneratorProfile::hasBranchlessPiecewise() const
+{
+    return mPimpl->mHasBranchlessPiecewise;
+}
+
+void GeneratorProfile::setHasBranchlessPiecewise(bool hasBranchlessPiecewise)
+{
+    mPimpl->mHasBranchlessPiecewise = hasBranchlessPiecewise;
+}
+
 std::string GeneratorProfile::trueString() const
 {
     return mPimpl->mTrueString;
@@ -1639,6 +2689,26 @@ void GeneratorProfile::setNanString(const std::string &nanString)
     mPimpl->mNanString = nanString;
 }
 
+std::string GeneratorProfile::realLiteralPrefixString() const
+{
+    return mPimpl->mRealLiteralPrefixString;
+}
+
+void GeneratorProfile::setRealLiteralPrefixString(const std::string &realLiteralPrefixString)
+{
+    mPimpl->mRealLiteralPrefixString = realLiteralPrefixString;
+}
+
+std::string GeneratorProfile::realLiteralSuffixString() const
+{
+    return mPimpl->mRealLiteralSuffixString;
+}
+
+void GeneratorProfile::setRealLiteralSuffixString(const std::string &realLiteralSuffixString)
+{
+    mPimpl->mRealLiteralSuffixString = realLiteralSuffixString;
+}
+
 std::string GeneratorProfile::eqFunctionString() const
 {
     return mPimpl->mEqFunctionString;
@@ -1759,6 +2829,16 @@ void GeneratorProfile::setMaxFunctionString(const std::string &maxFunctionString
     mPimpl->mMaxFunctionString = maxFunctionString;
 }
 
+std::string GeneratorProfile::blendFunctionString() const
+{
+    return mPimpl->mBlendFunctionString;
+}
+
+void GeneratorProfile::setBlendFunctionString(const std::string &blendFunctionString)
+{
+    mPimpl->mBlendFunctionString = blendFunctionString;
+}
+
 std::string GeneratorProfile::secFunctionString() const
 {
     return mPimpl->mSecFunctionString;
@@ -1929,6 +3009,16 @@ void GeneratorProfile::setImplementationHeaderString(const std::string &implemen
     mPimpl->mImplementationHeaderString = implementationHeaderString;
 }
 
+std::string GeneratorProfile::implementationFooterString() const
+{
+    return mPimpl->mImplementationFooterString;
+}
+
+void GeneratorProfile::setImplementationFooterString(const std::string &implementationFooterString)
+{
+    mPimpl->mImplementationFooterString = implementationFooterString;
+}
+
 std::string GeneratorProfile::interfaceVersionString() const
 {
     return mPimpl->mInterfaceVersionString;
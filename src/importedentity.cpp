@@ -59,7 +59,7 @@ void ImportedEntity::doSetImportSource(const ImportSourcePtr &importSource)
     mPimpl->mImportSource = importSource;
 }
 
-std::string ImportedEntity::importReference() const
+const std::string &ImportedEntity::importReference() const
 {
     return mPimpl->mImportReference;
 }
@@ -17,11 +17,29 @@ limitations under the License.
 #include "libcellml/importer.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <libxml/uri.h>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <set>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
 
 #include "libcellml/component.h"
 #include "libcellml/importsource.h"
@@ -31,6 +49,9 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
+#include "binarymodel.h"
+#include "importsource_p.h"
+#include "importstatistics_p.h"
 #include "namespaces.h"
 #include "utilities.h"
 #include "xmldoc.h"
@@ -38,7 +59,115 @@ limitations under the License.
 
 namespace libcellml {
 
-using HistorySearchVector = std::vector<std::tuple<std::string, std::string, std::string>>;
+using ImportHistoryEntry = std::tuple<std::string, std::string, std::string>;
+
+/**
+ * @brief The ImportHistoryEntryHash struct.
+ *
+ * Hash function for the entries of an @c ImportHistory.
+ */
+struct ImportHistoryEntryHash
+{
+    size_t operator()(const ImportHistoryEntry &entry) const
+    {
+        std::hash<std::string> hash;
+        auto res = hash(std::get<0>(entry));
+        res ^= hash(std::get<1>(entry)) + 0x9e3779b9 + (res << 6) + (res >> 2);
+        res ^= hash(std::get<2>(entry)) + 0x9e3779b9 + (res << 6) + (res >> 2);
+        return res;
+    }
+};
+
+/**
+ * @brief The ImportHistory struct.
+ *
+ * Keep track of the imports on the path being walked when resolving imports
+ * or checking them for cycles, i.e. a depth-first search of the import graph.
+ * The imports on the path are indexed, so that checking whether an import
+ * closes a cycle takes constant time.  Imported entities that have been fully
+ * walked are remembered, so that shared parts of the import graph are only
+ * walked once.
+ */
+struct ImportHistory
+{
+    std::vector<ImportHistoryEntry> mPath; /**< The imports on the path, in order. */
+    std::unordered_set<ImportHistoryEntry, ImportHistoryEntryHash> mPathIndex; /**< The imports on the path. */
+    std::unordered_set<const ImportedEntity *> mDoneEntities; /**< The imported entities that have been fully walked. */
+
+    bool isOnPath(const ImportHistoryEntry &entry) const;
+    bool isDone(const ImportedEntity *entity) const;
+
+    void push(const ImportHistoryEntry &entry);
+    void pop(const ImportedEntity *entity);
+    void close(const ImportHistoryEntry &entry);
+    void clear();
+};
+
+bool ImportHistory::isOnPath(const ImportHistoryEntry &entry) const
+{
+    return mPathIndex.count(entry) != 0;
+}
+
+bool ImportHistory::isDone(const ImportedEntity *entity) const
+{
+    return mDoneEntities.count(entity) != 0;
+}
+
+void ImportHistory::push(const ImportHistoryEntry &entry)
+{
+    mPath.push_back(entry);
+    mPathIndex.insert(entry);
+}
+
+void ImportHistory::pop(const ImportedEntity *entity)
+{
+    // Leave the import at the end of the path, which has been fully walked
+    // without any cycle being found.
+
+    mPathIndex.erase(mPath.back());
+    mPath.pop_back();
+    mDoneEntities.insert(entity);
+}
+
+void ImportHistory::close(const ImportHistoryEntry &entry)
+{
+    // Add an import that is already on the path, so that the path describes
+    // the dependency loop.
+
+    mPath.push_back(entry);
+}
+
+void ImportHistory::clear()
+{
+    mPath.clear();
+    mPathIndex.clear();
+}
+
+/**
+ * @brief The ParsedFile struct.
+ *
+ * A model parsed from the contents of a file, and what it cost to get it.
+ */
+struct ParsedFile
+{
+    ModelPtr mModel; /**< The model. */
+    size_t mBytesRead = 0; /**< The size of the contents of the file. */
+    double mParseTime = 0.0; /**< The time, in seconds, spent parsing the contents of the file. */
+};
+
+/**
+ * @brief Get the time elapsed since @p start.
+ *
+ * Get the time, in seconds, elapsed since @p start.
+ *
+ * @param start The start time.
+ *
+ * @return The time elapsed, in seconds.
+ */
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
 
 /**
  * @brief The Importer::ImporterImpl struct.
@@ -55,22 +184,49 @@ struct Importer::ImporterImpl
         COMPONENT
     };
 
+    /**
+     * @brief The LazyResolution struct.
+     *
+     * The state shared by the import sources that are to be resolved lazily,
+     * which may outlive the importer.
+     */
+    struct LazyResolution
+    {
+        std::mutex mMutex; /**< The mutex serialising the lazy loading of models. */
+        ImporterImpl *mImporter = nullptr; /**< The importer, or @c nullptr if it has been deleted. */
+    };
+
     Importer *mImporter = nullptr;
 
     ImportLibrary mLibrary;
+    std::map<std::string, ParsedFile> mPrefetchedModels;
+    std::map<std::string, std::map<const ImportSource *, std::weak_ptr<ImportSource>>> mImportSources;
+    ImportLoader mLoader = Importer::fileLoader();
+    std::string mCacheDirectory;
+    bool mLazyResolution = false;
+    std::shared_ptr<LazyResolution> mLazyResolutionState = std::make_shared<LazyResolution>();
+    bool mStatisticsEnabled = false;
+    std::map<std::string, ImportStatisticsPtr> mStatistics;
 
     IssuePtr makeIssueCyclicDependency(const ModelPtr &model, Type type,
-                                       HistorySearchVector &history,
+                                       ImportHistory &history,
                                        const std::string &action) const;
 
+    void prefetchModels(const ModelPtr &model, const std::string &baseFile);
+    ModelPtr libraryModel(const ImportSourcePtr &importSource, const std::string &baseFile);
+    std::vector<ImportSourcePtr> importSources(const std::string &key) const;
+    std::string libraryKey(const ModelPtr &model) const;
+    ImportStatistics::ImportStatisticsImpl *statistics(const std::string &key);
+    void recordParsedFile(const std::string &key, const ParsedFile &parsedFile);
     bool fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile);
-    bool fetchImportSource(const ModelPtr &origModel, const ImportSourcePtr &importSource, Type type, const std::string &baseFile, HistorySearchVector &history);
+    void setModelLoaders(const ModelPtr &model, const std::string &baseFile);
+    bool fetchImportSource(const ModelPtr &origModel, const ImportSourcePtr &importSource, Type type, const std::string &baseFile, ImportHistory &history);
 
-    bool fetchComponent(const ModelPtr &origModel, const ComponentPtr &importComponent, const std::string &baseFile, HistorySearchVector &history);
-    bool fetchUnits(const ModelPtr &origModel, const UnitsPtr &importUnits, const std::string &baseFile, HistorySearchVector &history);
+    bool fetchComponent(const ModelPtr &origModel, const ComponentPtr &importComponent, const std::string &baseFile, ImportHistory &history);
+    bool fetchUnits(const ModelPtr &origModel, const UnitsPtr &importUnits, const std::string &baseFile, ImportHistory &history);
 
-    bool checkUnitsForCycles(const ModelPtr &origModel, const UnitsPtr &units, HistorySearchVector &history);
-    bool checkComponentForCycles(const ModelPtr &origModel, const ComponentPtr &component, HistorySearchVector &history);
+    bool checkUnitsForCycles(const ModelPtr &origModel, const UnitsPtr &units, ImportHistory &history);
+    bool checkComponentForCycles(const ModelPtr &origModel, const ComponentPtr &component, ImportHistory &history);
     bool checkModelForCycles(const ModelPtr &model);
 };
 
@@ -78,6 +234,7 @@ Importer::Importer()
     : mPimpl(new ImporterImpl())
 {
     mPimpl->mImporter = this;
+    mPimpl->mLazyResolutionState->mImporter = mPimpl;
 }
 
 ImporterPtr Importer::create() noexcept
@@ -87,18 +244,24 @@ ImporterPtr Importer::create() noexcept
 
 Importer::~Importer()
 {
+    {
+        std::lock_guard<std::mutex> lock(mPimpl->mLazyResolutionState->mMutex);
+
+        mPimpl->mLazyResolutionState->mImporter = nullptr;
+    }
+
     delete mPimpl;
 }
 
-bool checkForCycles(ModelPtr &model, HistorySearchVector &history)
+bool checkForCycles(ModelPtr &model, ImportHistory &history)
 {
     for (size_t u = 0; u < model->unitsCount(); ++u) {
         auto units = model->units(u);
         if (units->isImport()) {
             auto importSource = units->importSource();
             auto h = std::make_tuple(units->name(), units->importReference(), importSource->url());
-            if (std::find(history.begin(), history.end(), h) != history.end()) {
-                history.emplace_back(h);
+            if (history.isOnPath(h)) {
+                history.close(h);
                 return false;
             }
         }
@@ -108,8 +271,8 @@ bool checkForCycles(ModelPtr &model, HistorySearchVector &history)
         if (component->isImport()) {
             auto importSource = component->importSource();
             auto h = std::make_tuple(component->name(), component->importReference(), importSource->url());
-            if (std::find(history.begin(), history.end(), h) != history.end()) {
-                history.emplace_back(h);
+            if (history.isOnPath(h)) {
+                history.close(h);
                 return false;
             }
         }
@@ -117,10 +280,16 @@ bool checkForCycles(ModelPtr &model, HistorySearchVector &history)
     return true;
 }
 
-bool Importer::ImporterImpl::checkUnitsForCycles(const ModelPtr &origModel, const UnitsPtr &units, HistorySearchVector &history)
+bool Importer::ImporterImpl::checkUnitsForCycles(const ModelPtr &origModel, const UnitsPtr &units, ImportHistory &history)
 {
+    // Don't walk the same units twice.
+    if (history.isDone(units.get())) {
+        return false;
+    }
+
     // Even if these units are not imported, they might have imported children.
     if (!units->isImport()) {
+        history.mDoneEntities.insert(units.get());
         for (size_t u = 0; u < units->unitCount(); ++u) {
             std::string ref;
             std::string prefix;
@@ -143,9 +312,9 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const ModelPtr &origModel, cons
     // If they are imported, then they can't have any child unit elements anyway.
     auto h = std::make_tuple(units->name(), units->importReference(), units->importSource()->url());
 
-    // If the dependencies have not been recorded already, then check it.
-    if (std::find(history.begin(), history.end(), h) == history.end()) {
-        history.emplace_back(h);
+    // If the dependencies are not being checked already, then check them.
+    if (!history.isOnPath(h)) {
+        history.push(h);
 
         auto model = units->importSource()->model();
         if (model == nullptr) {
@@ -167,21 +336,30 @@ bool Importer::ImporterImpl::checkUnitsForCycles(const ModelPtr &origModel, cons
             mImporter->addIssue(issue);
             return true;
         }
-        return checkUnitsForCycles(origModel, importedUnits, history);
+        if (checkUnitsForCycles(origModel, importedUnits, history)) {
+            return true;
+        }
+        history.pop(units.get());
+        return false;
     }
     // Otherwise, return true indicating that cycles have been found.
-    history.emplace_back(h);
+    history.close(h);
     mImporter->addIssue(makeIssueCyclicDependency(origModel, Type::UNITS, history, "flatten"));
     return true;
 }
 
-bool Importer::ImporterImpl::checkComponentForCycles(const ModelPtr &origModel, const ComponentPtr &component, HistorySearchVector &history)
+bool Importer::ImporterImpl::checkComponentForCycles(const ModelPtr &origModel, const ComponentPtr &component, ImportHistory &history)
 {
+    // Don't walk the same component twice.
+    if (history.isDone(component.get())) {
+        return false;
+    }
+
     auto h = std::make_tuple(component->name(), component->importReference(), component->importSource()->url());
 
-    // If the dependencies have not been recorded already, then check it.
-    if (std::find(history.begin(), history.end(), h) == history.end()) {
-        history.emplace_back(h);
+    // If the dependencies are not being checked already, then check them.
+    if (!history.isOnPath(h)) {
+        history.push(h);
 
         if (component->isImport()) {
             auto model = component->importSource()->model();
@@ -208,18 +386,19 @@ bool Importer::ImporterImpl::checkComponentForCycles(const ModelPtr &origModel,
                 return true;
             }
         }
+        history.pop(component.get());
         return false;
     }
 
     // Otherwise, return true indicating that cycles have been found.
-    history.emplace_back(h);
+    history.close(h);
     mImporter->addIssue(makeIssueCyclicDependency(origModel, Type::COMPONENT, history, "flatten"));
     return true;
 }
 
 bool Importer::ImporterImpl::checkModelForCycles(const ModelPtr &model)
 {
-    HistorySearchVector history;
+    ImportHistory history;
     for (size_t i = 0; i < model->importSourceCount(); ++i) {
         auto importSource = model->importSource(i);
         for (size_t u = 0; u < importSource->unitsCount(); ++u) {
@@ -260,7 +439,302 @@ std::string resolvePath(const std::string &filename, const std::string &base)
     return directoryPath(base) + filename;
 }
 
-bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile)
+/**
+ * @brief Parse the given contents of a file.
+ *
+ * Parse the given @p contents of a file, unless the model that they
+ * represent can be found in the given @p cacheDirectory, in which case it is
+ * read from there.  The cache entries are named after the SHA-1 of the
+ * contents that they represent, and an entry is (re)created whenever it is
+ * missing or cannot be read.
+ *
+ * @param contents The contents to parse.
+ * @param cacheDirectory The cache directory, or an empty string if there is none.
+ *
+ * @return The model.
+ */
+ModelPtr parseContents(const std::string &contents, const std::string &cacheDirectory)
+{
+    if (cacheDirectory.empty()) {
+        return Parser::create()->parseModel(contents);
+    }
+
+    auto cacheFile = cacheDirectory + "/" + sha1(contents) + ".cellmlb";
+    std::ifstream input(cacheFile, std::ios::binary);
+
+    if (input.good()) {
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        auto model = Model::create();
+        std::string error;
+        if (readBinaryModel(model, buffer.str(), error)) {
+            return model;
+        }
+    }
+
+    // Parse the contents and (re)create their cache entry, making sure that
+    // the entry cannot be read before it is complete. The cache directory may
+    // be shared by several processes, so the name of our temporary file
+    // includes our process id and a random suffix.
+
+    static thread_local std::mt19937_64 randomGenerator(std::random_device {}());
+
+#ifdef _WIN32
+    auto processId = _getpid();
+#else
+    auto processId = getpid();
+#endif
+    auto model = Parser::create()->parseModel(contents);
+    auto tempFile = cacheFile + "." + std::to_string(processId) + "-" + std::to_string(randomGenerator());
+    std::ofstream output(tempFile, std::ios::binary);
+
+    if (output.good()) {
+        output << writeBinaryModel(model);
+        output.close();
+        if (output.fail() || (std::rename(tempFile.c_str(), cacheFile.c_str()) != 0)) {
+            std::remove(tempFile.c_str());
+        }
+    }
+
+    return model;
+}
+
+/**
+ * @brief Parse the given contents, timing it.
+ *
+ * Parse, like @ref parseContents, the given @p contents and record how long
+ * it took.
+ *
+ * @param contents The contents to parse.
+ * @param cacheDirectory The cache directory, or an empty string if there is none.
+ *
+ * @return The @c ParsedFile.
+ */
+ParsedFile parseFile(const std::string &contents, const std::string &cacheDirectory)
+{
+    ParsedFile res;
+    auto start = std::chrono::steady_clock::now();
+
+    res.mModel = parseContents(contents, cacheDirectory);
+    res.mBytesRead = contents.size();
+    res.mParseTime = secondsSince(start);
+
+    return res;
+}
+
+/**
+ * @brief Read and parse the given files.
+ *
+ * Read, using the given @p loader, and parse the given files concurrently.
+ *
+ * @param urls The files to read and parse.
+ * @param loader The @c ImportLoader to read the files with.
+ * @param cacheDirectory The cache directory, or an empty string if there is none.
+ *
+ * @return The files parsed, in the same order as @p urls, with a @c nullptr
+ * model for each file that could not be opened.
+ */
+std::vector<ParsedFile> parseFiles(const std::vector<std::string> &urls, const ImportLoader &loader, const std::string &cacheDirectory)
+{
+    std::vector<ParsedFile> res(urls.size());
+    std::atomic<size_t> nextUrl(0);
+    auto parseNextFiles = [&]() {
+        std::string contents;
+        for (size_t i = nextUrl++; i < urls.size(); i = nextUrl++) {
+            if (loader(urls[i], contents)) {
+                res[i] = parseFile(contents, cacheDirectory);
+            }
+        }
+    };
+    auto threadCount = std::min(urls.size(), size_t(std::max(1U, std::thread::hardware_concurrency())));
+    std::vector<std::thread> threads;
+
+    // Use the current thread as one of our threads.
+
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(parseNextFiles);
+    }
+
+    parseNextFiles();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    return res;
+}
+
+/**
+ * @brief Add the import sources needed to resolve the given component.
+ *
+ * Add to @p importSources the import sources that resolving the given
+ * @p component needs, i.e. its own import source if it is imported, or else
+ * the import sources of its imported descendants.
+ *
+ * @param component The component.
+ * @param importSources The import sources.
+ */
+void addNeededImportSources(const ComponentPtr &component, std::vector<ImportSourcePtr> &importSources)
+{
+    if (component->isImport()) {
+        importSources.push_back(component->importSource());
+
+        return;
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        addNeededImportSources(component->component(i), importSources);
+    }
+}
+
+/**
+ * @brief Add the import sources needed to resolve the given units.
+ *
+ * Add to @p importSources the import sources that resolving the given
+ * @p units needs, i.e. its own import source if it is imported.
+ *
+ * @param units The units.
+ * @param importSources The import sources.
+ */
+void addNeededImportSources(const UnitsPtr &units, std::vector<ImportSourcePtr> &importSources)
+{
+    if ((units != nullptr) && units->isImport()) {
+        importSources.push_back(units->importSource());
+    }
+}
+
+/**
+ * @brief Get the import sources needed to resolve what is imported from a model.
+ *
+ * Get the import sources of the given @p model that fetchComponent() and
+ * fetchUnits() would use to resolve the components and units that the given
+ * @p importSource imports from it.
+ *
+ * @param importSource The import source.
+ * @param model The model of the import source.
+ *
+ * @return The import sources.
+ */
+std::vector<ImportSourcePtr> neededImportSources(const ImportSourcePtr &importSource, const ModelPtr &model)
+{
+    std::vector<ImportSourcePtr> res;
+
+    for (size_t i = 0; i < importSource->componentCount(); ++i) {
+        auto component = model->component(importSource->component(i)->importReference());
+
+        if (component != nullptr) {
+            addNeededImportSources(component, res);
+
+            for (size_t j = 0; j < component->componentCount(); ++j) {
+                addNeededImportSources(component->component(j), res);
+            }
+
+            for (const auto &unitsName : unitsNamesUsed(component)) {
+                addNeededImportSources(model->units(unitsName), res);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < importSource->unitsCount(); ++i) {
+        auto units = model->units(importSource->units(i)->importReference());
+
+        if (units != nullptr) {
+            addNeededImportSources(units, res);
+
+            for (size_t j = 0; j < units->unitCount(); ++j) {
+                std::string reference;
+                std::string prefix;
+                std::string id;
+                double exponent;
+                double multiplier;
+                units->unitAttributes(j, reference, prefix, exponent, multiplier, id);
+                if (!isStandardUnitName(reference)) {
+                    addNeededImportSources(model->units(reference), res);
+                }
+            }
+        }
+    }
+
+    return res;
+}
+
+void Importer::ImporterImpl::prefetchModels(const ModelPtr &model, const std::string &baseFile)
+{
+    // Discover, one level of imports at a time, the files that resolving the
+    // imports of the given model needs, and read and parse them concurrently.
+    // All the import sources of the given model are needed, but only those
+    // used by what gets imported are needed in an imported model. The
+    // prefetched models are only added to our library if and when
+    // fetchModel() needs them, so that the result of resolving imports,
+    // including any issue, is the same as without prefetching.
+
+    std::set<const ImportSource *> visitedImportSources;
+    std::vector<std::pair<ImportSourcePtr, std::string>> importSources;
+
+    for (size_t i = 0; i < model->importSourceCount(); ++i) {
+        auto importSource = model->importSource(i);
+
+        if (((importSource->componentCount() != 0) || (importSource->unitsCount() != 0))
+            && visitedImportSources.insert(importSource.get()).second) {
+            importSources.emplace_back(importSource, baseFile);
+        }
+    }
+
+    while (!importSources.empty()) {
+        std::vector<std::string> urls;
+        std::vector<std::string> importUrls;
+
+        for (const auto &importSource : importSources) {
+            // Determine the URL that fetchModel() would use.
+
+            const std::string &importUrl = importSource.first->url();
+            auto url = (mLibrary.count(importUrl) == 0) ? resolvePath(importUrl, importSource.second) : importUrl;
+
+            importUrls.push_back(url);
+
+            if ((mLibrary.count(url) == 0) && (mPrefetchedModels.count(url) == 0)
+                && (std::find(urls.begin(), urls.end(), url) == urls.end())) {
+                urls.push_back(url);
+            }
+        }
+
+        auto parsedFiles = parseFiles(urls, mLoader, mCacheDirectory);
+
+        for (size_t i = 0; i < urls.size(); ++i) {
+            if (parsedFiles[i].mModel != nullptr) {
+                mPrefetchedModels.emplace(urls[i], parsedFiles[i]);
+            }
+        }
+
+        std::vector<std::pair<ImportSourcePtr, std::string>> nextImportSources;
+
+        for (size_t i = 0; i < importSources.size(); ++i) {
+            auto libraryModel = mLibrary.find(importUrls[i]);
+            auto prefetchedModel = mPrefetchedModels.find(importUrls[i]);
+            ModelPtr importedModel;
+
+            if (libraryModel != mLibrary.end()) {
+                importedModel = libraryModel->second;
+            } else if (prefetchedModel != mPrefetchedModels.end()) {
+                importedModel = prefetchedModel->second.mModel;
+            } else {
+                continue;
+            }
+
+            auto importedBaseFile = importSources[i].second + directoryPath(importSources[i].first->url());
+
+            for (const auto &importSource : neededImportSources(importSources[i].first, importedModel)) {
+                if (visitedImportSources.insert(importSource.get()).second) {
+                    nextImportSources.emplace_back(importSource, importedBaseFile);
+                }
+            }
+        }
+
+        importSources = nextImportSources;
+    }
+}
+
+ModelPtr Importer::ImporterImpl::libraryModel(const ImportSourcePtr &importSource, const std::string &baseFile)
 {
     std::string url = importSource->url();
     if (mLibrary.count(url) == 0) {
@@ -268,31 +742,137 @@ bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, con
     }
 
     ModelPtr model;
-    if (mLibrary.count(url) == 0) {
+    auto prefetchedModel = mPrefetchedModels.find(url);
+    if ((mLibrary.count(url) == 0) && (prefetchedModel != mPrefetchedModels.end())) {
+        // The model has been prefetched, so just save it.
+        model = prefetchedModel->second.mModel;
+        mLibrary.insert(std::make_pair(url, model));
+        recordParsedFile(url, prefetchedModel->second);
+        mPrefetchedModels.erase(prefetchedModel);
+    } else if (mLibrary.count(url) == 0) {
         // If the URL has not ever been resolved into a model in this library, with or
         // without baseFile, parse it and save.
-        std::ifstream file(url);
-        if (!file.good()) {
+        std::string contents;
+        if (!mLoader(url, contents)) {
             auto issue = Issue::create();
             issue->setDescription("The attempt to resolve imports with the model at '" + url + "' failed: the file could not be opened.");
             issue->setImportSource(importSource);
             issue->setReferenceRule(Issue::ReferenceRule::UNSPECIFIED);
             mImporter->addIssue(issue);
-            return false;
+            return nullptr;
         }
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        auto parser = Parser::create();
-        model = parser->parseModel(buffer.str());
+        auto parsedFile = parseFile(contents, mCacheDirectory);
+        model = parsedFile.mModel;
         mLibrary.insert(std::make_pair(url, model));
+        recordParsedFile(url, parsedFile);
     } else {
         model = mLibrary[url];
+        auto urlStatistics = statistics(url);
+        if (urlStatistics != nullptr) {
+            ++urlStatistics->mCacheHitCount;
+        }
+    }
+
+    // Keep track of the import sources that use the model, so that we know
+    // what to update if the model gets invalidated.
+
+    mImportSources[url][importSource.get()] = importSource;
+
+    return model;
+}
+
+ImportStatistics::ImportStatisticsImpl *Importer::ImporterImpl::statistics(const std::string &key)
+{
+    if (!mStatisticsEnabled) {
+        return nullptr;
+    }
+    auto &res = mStatistics[key];
+    if (res == nullptr) {
+        res = std::shared_ptr<ImportStatistics> {new ImportStatistics {}};
+        res->mPimpl->mKey = key;
+    }
+    return res->mPimpl;
+}
+
+void Importer::ImporterImpl::recordParsedFile(const std::string &key, const ParsedFile &parsedFile)
+{
+    auto keyStatistics = statistics(key);
+    if (keyStatistics != nullptr) {
+        ++keyStatistics->mCacheMissCount;
+        keyStatistics->mBytesRead += parsedFile.mBytesRead;
+        keyStatistics->mParseTime += parsedFile.mParseTime;
+    }
+}
+
+std::vector<ImportSourcePtr> Importer::ImporterImpl::importSources(const std::string &key) const
+{
+    std::vector<ImportSourcePtr> res;
+    auto importSources = mImportSources.find(key);
+    if (importSources != mImportSources.end()) {
+        for (const auto &importSource : importSources->second) {
+            auto lockedImportSource = importSource.second.lock();
+            if (lockedImportSource != nullptr) {
+                res.push_back(lockedImportSource);
+            }
+        }
+    }
+    return res;
+}
+
+std::string Importer::ImporterImpl::libraryKey(const ModelPtr &model) const
+{
+    for (const auto &libraryModel : mLibrary) {
+        if (libraryModel.second == model) {
+            return libraryModel.first;
+        }
+    }
+    return "";
+}
+
+bool Importer::ImporterImpl::fetchModel(const ImportSourcePtr &importSource, const std::string &baseFile)
+{
+    auto model = libraryModel(importSource, baseFile);
+    if (model == nullptr) {
+        return false;
     }
     importSource->setModel(model);
     return true;
 }
 
-bool Importer::ImporterImpl::fetchImportSource(const ModelPtr &origModel, const ImportSourcePtr &importSource, Type type, const std::string &baseFile, HistorySearchVector &history)
+void Importer::ImporterImpl::setModelLoaders(const ModelPtr &model, const std::string &baseFile)
+{
+    // Have the unresolved import sources of the given model load their model
+    // the first time that it is needed, using the same base file as if they
+    // were resolved straightaway. The models of the import sources of a lazily
+    // loaded model are themselves to be loaded lazily.
+
+    for (size_t i = 0; i < model->importSourceCount(); ++i) {
+        auto importSource = model->importSource(i);
+        std::weak_ptr<ImportSource> weakImportSource = importSource;
+        auto lazyResolutionState = mLazyResolutionState;
+
+        setModelLoader(importSource, [weakImportSource, lazyResolutionState, baseFile]() -> ModelPtr {
+            std::lock_guard<std::mutex> lock(lazyResolutionState->mMutex);
+            auto importer = lazyResolutionState->mImporter;
+            auto importSource = weakImportSource.lock();
+
+            if ((importer == nullptr) || (importSource == nullptr)) {
+                return nullptr;
+            }
+
+            auto libraryModelCount = importer->mLibrary.size();
+            auto model = importer->libraryModel(importSource, baseFile);
+
+            if ((model != nullptr) && (importer->mLibrary.size() != libraryModelCount)) {
+                importer->setModelLoaders(model, baseFile + directoryPath(importSource->url()));
+            }
+
+            return model;
+        });
+    }
+}
+
+bool Importer::ImporterImpl::fetchImportSource(const ModelPtr &origModel, const ImportSourcePtr &importSource, Type type, const std::string &baseFile, ImportHistory &history)
 {
     // If the model has never been retrieved, get it and add to library.
     if (!importSource->hasModel()) {
@@ -301,21 +881,27 @@ bool Importer::ImporterImpl::fetchImportSource(const ModelPtr &origModel, const
         }
     }
     // Check for cycles.
-    std::string url = importSource->url();
-    if (mLibrary.count(url) == 0) {
-        url = resolvePath(url, baseFile);
-    }
-    auto model = mLibrary[url];
+    auto model = importSource->model();
     if (!checkForCycles(model, history)) {
         auto issue = makeIssueCyclicDependency(origModel, type, history, "resolve");
         issue->setImportSource(importSource);
         mImporter->addIssue(issue);
         return false;
     }
+    std::string url = importSource->url();
+    if (mLibrary.count(url) == 0) {
+        url = resolvePath(url, baseFile);
+    }
+    if (mLibrary.count(url) != 0) {
+        auto urlStatistics = statistics(url);
+        if (urlStatistics != nullptr) {
+            ++((type == Type::UNITS) ? urlStatistics->mUnitsCount : urlStatistics->mComponentCount);
+        }
+    }
     return true;
 }
 
-bool Importer::ImporterImpl::fetchComponent(const ModelPtr &origModel, const ComponentPtr &importComponent, const std::string &baseFile, HistorySearchVector &history)
+bool Importer::ImporterImpl::fetchComponent(const ModelPtr &origModel, const ComponentPtr &importComponent, const std::string &baseFile, ImportHistory &history)
 {
     // Given the importComponent, check whether it has been resolved previously.  If so, return.
     // If not, check for model, and parse/instantiate/add to library if needed.
@@ -335,7 +921,12 @@ bool Importer::ImporterImpl::fetchComponent(const ModelPtr &origModel, const Com
         return true;
     }
 
-    history.emplace_back(std::make_tuple(importComponent->name(), importComponent->importReference(), importComponent->importSource()->url()));
+    // Don't fetch the same component twice.
+    if (history.isDone(importComponent.get())) {
+        return true;
+    }
+
+    history.push(std::make_tuple(importComponent->name(), importComponent->importReference(), importComponent->importSource()->url()));
     if (!fetchImportSource(origModel, importComponent->importSource(), Type::COMPONENT, baseFile, history)) {
         return false;
     }
@@ -385,16 +976,23 @@ bool Importer::ImporterImpl::fetchComponent(const ModelPtr &origModel, const Com
         return false;
     }
 
+    history.pop(importComponent.get());
+
     return true;
 }
 
-bool Importer::ImporterImpl::fetchUnits(const ModelPtr &origModel, const UnitsPtr &importUnits, const std::string &baseFile, HistorySearchVector &history)
+bool Importer::ImporterImpl::fetchUnits(const ModelPtr &origModel, const UnitsPtr &importUnits, const std::string &baseFile, ImportHistory &history)
 {
     if (!importUnits->isImport()) {
         return true;
     }
 
-    history.emplace_back(std::make_tuple(importUnits->name(), importUnits->importReference(), importUnits->importSource()->url()));
+    // Don't fetch the same units twice.
+    if (history.isDone(importUnits.get())) {
+        return true;
+    }
+
+    history.push(std::make_tuple(importUnits->name(), importUnits->importReference(), importUnits->importSource()->url()));
     if (!fetchImportSource(origModel, importUnits->importSource(), Type::UNITS, baseFile, history)) {
         return false;
     }
@@ -445,22 +1043,24 @@ bool Importer::ImporterImpl::fetchUnits(const ModelPtr &origModel, const UnitsPt
         return false;
     }
 
+    history.pop(importUnits.get());
+
     return true;
 }
 
 IssuePtr Importer::ImporterImpl::makeIssueCyclicDependency(const ModelPtr &model,
                                                            Type type,
-                                                           HistorySearchVector &history,
+                                                           ImportHistory &history,
                                                            const std::string &action) const
 {
     std::string msg = "Cyclic dependencies were found when attempting to " + action + " "
                       + std::string((type == Type::UNITS) ? "units" : "components") + " in model '"
                       + model->name() + "'. The dependency loop is:\n";
-    std::tuple<std::string, std::string, std::string> h;
-    auto hSize = history.size();
+    ImportHistoryEntry h;
+    auto hSize = history.mPath.size();
     std::string typeString = (type == Type::UNITS) ? "units" : "component";
     for (size_t i = 0; i < hSize; ++i) {
-        h = history[i];
+        h = history.mPath[i];
         msg += " - " + typeString + " '" + std::get<0>(h) + "' is imported from '" + std::get<1>(h) + "' in '" + std::get<2>(h) + "'";
         if (i != hSize - 1) {
             msg += ";";
@@ -482,23 +1082,47 @@ IssuePtr Importer::ImporterImpl::makeIssueCyclicDependency(const ModelPtr &model
 
 bool Importer::resolveImports(ModelPtr &model, const std::string &baseFile)
 {
-    HistorySearchVector history;
+    ImportHistory history;
     bool status = true;
     clearImports(model);
 
+    // Only get our import sources to load their model when needed, if
+    // requested.
+
+    if (mPimpl->mLazyResolution) {
+        mPimpl->setModelLoaders(model, baseFile);
+
+        return true;
+    }
+
+    // Read and parse, concurrently, the files that we may need, and then resolve
+    // our imports.
+
+    mPimpl->prefetchModels(model, baseFile);
+
+    // Each import of our model starts a new import path, but the imported
+    // entities that have already been fetched are remembered across imports.
+
     for (size_t i = 0; i < model->importSourceCount(); ++i) {
         auto imp = model->importSource(i);
         for (size_t u = 0; u < imp->unitsCount(); ++u) {
+            history.clear();
             if (!mPimpl->fetchUnits(model, imp->units(u), baseFile, history)) {
                 status = false;
             }
         }
         for (size_t c = 0; c < imp->componentCount(); ++c) {
+            history.clear();
             if (!mPimpl->fetchComponent(model, imp->component(c), baseFile, history)) {
                 status = false;
             }
         }
     }
+
+    // Forget about any prefetched model that we didn't need.
+
+    mPimpl->mPrefetchedModels.clear();
+
     return status;
 }
 
@@ -526,9 +1150,236 @@ void Importer::clearImports(ModelPtr &model)
     }
 }
 
-void flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component, size_t index)
+/**
+ * @brief The FlatteningCache struct.
+ *
+ * Remember, while flattening a model, what has been computed for each of the
+ * components that it imports, so that a component that is imported several
+ * times only gets analysed once.
+ */
+struct FlatteningCache
+{
+    /**
+     * @brief The ImportedComponent struct.
+     *
+     * What has been computed for an imported component.
+     */
+    struct ImportedComponent
+    {
+        IndexStack mIndexStack; /**< The index stack of the component in its model. */
+        EquivalenceMap mEquivalenceMap; /**< The equivalences within the component. */
+        bool mImported = false; /**< Whether the component has already been imported. */
+        StringStringMap mUnitsNamesToReplace; /**< The renaming of the units of the component when it was first imported. */
+        std::map<StringStringMap, std::vector<std::string>> mMaths; /**< The math of the component and of its child components, for a given units renaming. */
+    };
+
+    std::map<const Component *, ImportedComponent> mImportedComponents; /**< The imported components, indexed by their source. */
+    std::unordered_map<std::string, std::vector<UnitsPtr>> mUnits; /**< The units of the flattened model, indexed by the key of their definition. */
+    std::unordered_set<const Units *> mIndexedUnits; /**< The units of the flattened model that have been indexed. */
+    bool mStatisticsEnabled = false; /**< Whether to time the instantiation of imported components. */
+    std::map<const Model *, double> mFlattenTimes; /**< The time, in seconds, spent instantiating the components imported from a model. */
+
+    ImportedComponent &importedComponent(const ComponentPtr &component);
+    UnitsPtr equivalentUnits(const ModelPtr &model, const UnitsPtr &units);
+};
+
+FlatteningCache::ImportedComponent &FlatteningCache::importedComponent(const ComponentPtr &component)
+{
+    auto importedComponent = mImportedComponents.find(component.get());
+
+    if (importedComponent != mImportedComponents.end()) {
+        return importedComponent->second;
+    }
+
+    auto &res = mImportedComponents[component.get()];
+
+    res.mIndexStack = reverseEngineerIndexStack(component);
+
+    auto indexStack = res.mIndexStack;
+
+    recordVariableEquivalences(component, res.mEquivalenceMap, indexStack);
+    generateEquivalenceMap(component, res.mEquivalenceMap, indexStack);
+
+    return res;
+}
+
+/**
+ * @brief Find units of the given @p model that are equivalent to @p units.
+ *
+ * Find units of the given @p model, which is being flattened, that are
+ * equivalent to the given @p units. The units of @p model are indexed by the
+ * key of their definition, so that only units that are likely to be
+ * equivalent to @p units get checked.
+ *
+ * @param model The model being flattened.
+ * @param units The @c Units to find equivalent units for.
+ *
+ * @return The equivalent units, or @c nullptr if there are none.
+ */
+UnitsPtr FlatteningCache::equivalentUnits(const ModelPtr &model, const UnitsPtr &units)
+{
+    // Index the units that have been added to the model since we were last
+    // called. Imported units get replaced when they are instantiated, so there
+    // is no point in indexing them.
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto modelUnits = model->units(i);
+
+        if (!modelUnits->isImport() && mIndexedUnits.insert(modelUnits.get()).second) {
+            auto key = unitsDefinitionKey(modelUnits);
+
+            if (!key.empty()) {
+                mUnits[key].push_back(modelUnits);
+            }
+        }
+    }
+
+    auto key = unitsDefinitionKey(units);
+
+    if (key.empty()) {
+        return nullptr;
+    }
+
+    auto candidates = mUnits.find(key);
+
+    if (candidates == mUnits.end()) {
+        return nullptr;
+    }
+
+    for (const auto &candidate : candidates->second) {
+        if ((owningModel(candidate) == model) && Units::equivalent(candidate, units)) {
+            return candidate;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Rename the units referenced by the given @p units.
+ *
+ * Rename, using the given @p replaceMap, the units that the given @p units
+ * are defined in terms of.
+ *
+ * @param units The @c Units to update.
+ * @param replaceMap The map of units names to replace.
+ */
+void replaceUnitsReferences(const UnitsPtr &units, const StringStringMap &replaceMap)
+{
+    std::string reference;
+    std::string prefix;
+    std::string id;
+    double exponent;
+    double multiplier;
+    bool replace = false;
+
+    for (size_t i = 0; (i < units->unitCount()) && !replace; ++i) {
+        units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+        replace = replaceMap.find(reference) != replaceMap.end();
+    }
+
+    if (!replace) {
+        return;
+    }
+
+    auto unitsCopy = units->clone();
+
+    units->removeAllUnits();
+
+    for (size_t i = 0; i < unitsCopy->unitCount(); ++i) {
+        unitsCopy->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+
+        auto newReference = replaceMap.find(reference);
+
+        units->addUnit((newReference != replaceMap.end()) ? newReference->second : reference, prefix, exponent, multiplier, id);
+    }
+}
+
+/**
+ * @brief Replace the units of the variables of a component.
+ *
+ * Replace, using the given @p unitsMap, the units of the variables of the
+ * given @p component and of its child components.
+ *
+ * @param component The @c Component to update.
+ * @param unitsMap The map of units to replace.
+ */
+void replaceVariablesUnits(const ComponentPtr &component, const std::map<const Units *, UnitsPtr> &unitsMap)
+{
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+        auto units = unitsMap.find(variable->units().get());
+
+        if (units != unitsMap.end()) {
+            variable->setUnits(units->second);
+        }
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        replaceVariablesUnits(component->component(i), unitsMap);
+    }
+}
+
+/**
+ * @brief Rename the units used in the math of an imported component.
+ *
+ * Rename, using the given @p replaceMap, the units used in the math of the
+ * given @p importedComponentCopy, a copy of @p importedComponent, and of its
+ * child components.  The math of the copy and of the child components that it
+ * got from @p importedComponent only depends on @p importedComponent, so it is
+ * only computed once for a given @p replaceMap.
+ *
+ * @param importedComponent The @c FlatteningCache::ImportedComponent of the imported component.
+ * @param importedComponentCopy The copy of the imported component.
+ * @param copiedComponentCount The number of child components copied from the imported component.
+ * @param replaceMap The map of units names to replace.
+ */
+void replaceCnUnitsNames(FlatteningCache::ImportedComponent &importedComponent,
+                         const ComponentPtr &importedComponentCopy, size_t copiedComponentCount,
+                         const StringStringMap &replaceMap)
+{
+    if (replaceMap.empty()) {
+        return;
+    }
+
+    auto maths = importedComponent.mMaths.find(replaceMap);
+
+    if (maths == importedComponent.mMaths.end()) {
+        std::vector<std::string> newMaths;
+
+        findAndReplaceComponentCnUnitsNames(importedComponentCopy, replaceMap);
+        newMaths.push_back(importedComponentCopy->math());
+
+        for (size_t i = 0; i < copiedComponentCount; ++i) {
+            auto childComponent = importedComponentCopy->component(i);
+            findAndReplaceComponentCnUnitsNames(childComponent, replaceMap);
+            newMaths.push_back(childComponent->math());
+        }
+
+        importedComponent.mMaths.emplace(replaceMap, std::move(newMaths));
+    } else {
+        importedComponentCopy->setMath(maths->second[0]);
+
+        for (size_t i = 0; i < copiedComponentCount; ++i) {
+            importedComponentCopy->component(i)->setMath(maths->second[i + 1]);
+        }
+    }
+
+    // Child components that did not come from the imported component need
+    // their units renaming too.
+
+    for (size_t i = copiedComponentCount; i < importedComponentCopy->componentCount(); ++i) {
+        findAndReplaceComponentCnUnitsNames(importedComponentCopy->component(i), replaceMap);
+    }
+}
+
+void flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component, size_t index, FlatteningCache &cache)
 {
     if (component->isImport()) {
+        std::chrono::steady_clock::time_point start;
+        if (cache.mStatisticsEnabled) {
+            start = std::chrono::steady_clock::now();
+        }
         auto model = owningModel(component);
         auto importSource = component->importSource();
         auto importModel = importSource->model();
@@ -540,16 +1391,11 @@ void flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component,
         // Determine the stack for the destination component.
         IndexStack destinationComponentBaseIndexStack = reverseEngineerIndexStack(component);
 
-        // Determine the stack for the source component.
-        IndexStack importedComponentBaseIndexStack = reverseEngineerIndexStack(importedComponent);
-
-        // Generate equivalence map for the source component.
-        EquivalenceMap map;
-        recordVariableEquivalences(importedComponent, map, importedComponentBaseIndexStack);
-        generateEquivalenceMap(importedComponent, map, importedComponentBaseIndexStack);
+        // Determine the stack for the source component and its equivalence map.
+        auto &cachedImportedComponent = cache.importedComponent(importedComponent);
 
         // Rebase the generated equivalence map from the source component to the destination component.
-        auto rebasedMap = rebaseEquivalenceMap(map, importedComponentBaseIndexStack, destinationComponentBaseIndexStack);
+        auto rebasedMap = rebaseEquivalenceMap(cachedImportedComponent.mEquivalenceMap, cachedImportedComponent.mIndexStack, destinationComponentBaseIndexStack);
 
         // Take a copy of the imported component which will be used to replace the import defined in this model.
         auto importedComponentCopy = importedComponent->clone();
@@ -602,37 +1448,69 @@ void flattenComponent(const ComponentEntityPtr &parent, ComponentPtr &component,
         // Apply the re-based equivalence map onto the modified model.
         applyEquivalenceMapToModel(rebasedMap, model);
 
-        // Copy over units used in imported component to this model.
+        // Copy over units used in imported component to this model, unless
+        // this model already has units with an equivalent definition, in which
+        // case those are used instead.
         std::map<std::string, std::string> unitsNamesToReplace;
+        std::map<const Units *, UnitsPtr> mergedUnits;
         for (const auto &u : requiredUnits) {
             if (!model->hasUnits(u)) {
                 auto originalName = u->name();
+                auto equivalentUnits = cache.equivalentUnits(model, u);
+                if (equivalentUnits != nullptr) {
+                    mergedUnits.emplace(u.get(), equivalentUnits);
+                    if (originalName != equivalentUnits->name()) {
+                        unitsNamesToReplace[originalName] = equivalentUnits->name();
+                    }
+                    continue;
+                }
                 size_t count = 0;
                 while (!model->hasUnits(u) && model->hasUnits(u->name())) {
                     auto name = u->name();
                     name += "_" + convertToString(++count);
                     u->setName(name);
                 }
-                model->addUnits(u);
+                if (!model->hasUnits(u)) {
+                    replaceUnitsReferences(u, unitsNamesToReplace);
+                    model->addUnits(u);
+                }
                 if (originalName != u->name()) {
                     unitsNamesToReplace[originalName] = u->name();
                 }
             }
         }
-        findAndReplaceComponentsCnUnitsNames(importedComponentCopy, unitsNamesToReplace);
+
+        if (!mergedUnits.empty()) {
+            replaceVariablesUnits(importedComponentCopy, mergedUnits);
+        }
+
+        // The units of the imported component get renamed the first time that
+        // it is imported, so make sure that its later copies use the same names.
+        if (!cachedImportedComponent.mImported) {
+            cachedImportedComponent.mImported = true;
+            cachedImportedComponent.mUnitsNamesToReplace = unitsNamesToReplace;
+        } else {
+            unitsNamesToReplace.insert(cachedImportedComponent.mUnitsNamesToReplace.begin(), cachedImportedComponent.mUnitsNamesToReplace.end());
+        }
+
+        replaceCnUnitsNames(cachedImportedComponent, importedComponentCopy, importedComponent->componentCount(), unitsNamesToReplace);
 
         // Remove the component from the import source.
         importSource->removeComponent(component);
+
+        if (cache.mStatisticsEnabled) {
+            cache.mFlattenTimes[importModel.get()] += secondsSince(start);
+        }
     }
 }
 
-void flattenComponentTree(const ComponentEntityPtr &parent, ComponentPtr &component, size_t componentIndex)
+void flattenComponentTree(const ComponentEntityPtr &parent, ComponentPtr &component, size_t componentIndex, FlatteningCache &cache)
 {
-    flattenComponent(parent, component, componentIndex);
+    flattenComponent(parent, component, componentIndex, cache);
     auto flattenedComponent = parent->component(componentIndex);
     for (size_t index = 0; index < flattenedComponent->componentCount(); ++index) {
         auto c = flattenedComponent->component(index);
-        flattenComponentTree(flattenedComponent, c, index);
+        flattenComponentTree(flattenedComponent, c, index, cache);
     }
 }
 
@@ -653,6 +1531,10 @@ ModelPtr Importer::flattenModel(const ModelPtr &model)
 
     flatModel = model->clone();
 
+    FlatteningCache cache;
+
+    cache.mStatisticsEnabled = mPimpl->mStatisticsEnabled;
+
     while (flatModel->hasImports()) {
         // Go through Units and instantiate any imported Units.
         for (size_t index = 0; index < flatModel->unitsCount(); ++index) {
@@ -670,12 +1552,21 @@ ModelPtr Importer::flattenModel(const ModelPtr &model)
         // Go through Components and instantiate any imported Components.
         for (size_t index = 0; index < flatModel->componentCount(); ++index) {
             auto c = flatModel->component(index);
-            flattenComponentTree(flatModel, c, index);
+            flattenComponentTree(flatModel, c, index, cache);
         }
     }
 
     flatModel->linkUnits();
 
+    if (mPimpl->mStatisticsEnabled) {
+        for (const auto &libraryModel : mPimpl->mLibrary) {
+            auto flattenTime = cache.mFlattenTimes.find(libraryModel.second.get());
+            if (flattenTime != cache.mFlattenTimes.end()) {
+                mPimpl->statistics(libraryModel.first)->mFlattenTime += flattenTime->second;
+            }
+        }
+    }
+
     for (int i = int(flatModel->importSourceCount()) - 1; i >= 0; --i) {
         auto importSource = flatModel->importSource(size_t(i));
         if ((importSource->unitsCount() == 0) && (importSource->componentCount() == 0)) {
@@ -733,6 +1624,453 @@ bool Importer::replaceModel(const ModelPtr &model, const std::string &key)
     return true;
 }
 
+void Importer::setLoader(const ImportLoader &loader)
+{
+    if (!loader) {
+        auto issue = Issue::create();
+        issue->setReferenceRule(Issue::ReferenceRule::INVALID_ARGUMENT);
+        issue->setDescription("The loader is empty.");
+        addIssue(issue);
+
+        return;
+    }
+
+    mPimpl->mLoader = loader;
+}
+
+void Importer::setLazyResolution(bool lazyResolution)
+{
+    mPimpl->mLazyResolution = lazyResolution;
+}
+
+bool Importer::lazyResolution() const
+{
+    return mPimpl->mLazyResolution;
+}
+
+void Importer::setCacheDirectory(const std::string &directory)
+{
+    mPimpl->mCacheDirectory = directory;
+}
+
+std::string Importer::cacheDirectory() const
+{
+    return mPimpl->mCacheDirectory;
+}
+
+ImportLoader Importer::fileLoader()
+{
+    return [](const std::string &url, std::string &contents) {
+        std::ifstream file(url);
+        if (!file.good()) {
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        contents = buffer.str();
+        return true;
+    };
+}
+
+ImportLoader Importer::memoryLoader(const std::map<std::string, std::string> &files)
+{
+    auto sharedFiles = std::make_shared<const std::map<std::string, std::string>>(files);
+
+    return [sharedFiles](const std::string &url, std::string &contents) {
+        auto file = sharedFiles->find(url);
+        if (file == sharedFiles->end()) {
+            return false;
+        }
+        contents = file->second;
+        return true;
+    };
+}
+
+/**
+ * @brief Get the value of the given numeric field of a tar header.
+ *
+ * Get the value of the given numeric field of a tar header. The field is
+ * either in octal, terminated by a space or a null character, or in base-256
+ * (as used by GNU tar for large files), in which case the high bit of its
+ * first byte is set and its remaining bits are a big-endian binary number.
+ *
+ * @param field The field.
+ * @param size The size of the field.
+ * @param value The value of the field.
+ *
+ * @return @c true if the value of the field could be retrieved, @c false if
+ * it is negative or does not fit in a @c size_t.
+ */
+bool tarNumericField(const char *field, size_t size, size_t &value)
+{
+    value = 0;
+    if ((static_cast<unsigned char>(field[0]) & 0x80) != 0) {
+        if ((static_cast<unsigned char>(field[0]) & 0x40) != 0) {
+            return false;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            auto byte = static_cast<unsigned char>(field[i]) & ((i == 0) ? 0x7f : 0xff);
+            if (value > (std::numeric_limits<size_t>::max() >> 8)) {
+                return false;
+            }
+            value = (value << 8) | size_t(byte);
+        }
+        return true;
+    }
+    for (size_t i = 0; (i < size) && (field[i] >= '0') && (field[i] <= '7'); ++i) {
+        if (value > (std::numeric_limits<size_t>::max() >> 3)) {
+            return false;
+        }
+        value = 8 * value + size_t(field[i] - '0');
+    }
+    return true;
+}
+
+/**
+ * @brief Return the value of the given string field of a tar header.
+ *
+ * Return the value of the given string field of a tar header, which is
+ * terminated by a null character unless it uses the whole field.
+ *
+ * @param field The field.
+ * @param size The size of the field.
+ *
+ * @return The value of the field.
+ */
+std::string tarStringField(const char *field, size_t size)
+{
+    return {field, strnlen(field, size)};
+}
+
+/**
+ * @brief Return the checksum of the given tar header.
+ *
+ * Return the checksum of the given tar header, i.e. the sum of its bytes, with
+ * its checksum field counting as spaces.
+ *
+ * @param header The header.
+ *
+ * @return The checksum of the header.
+ */
+size_t tarChecksum(const char *header)
+{
+    size_t res = 0;
+    for (size_t i = 0; i < 512; ++i) {
+        res += ((i >= 148) && (i < 156)) ? size_t(' ') : size_t(static_cast<unsigned char>(header[i]));
+    }
+    return res;
+}
+
+/**
+ * @brief Return the path record of the given pax header data.
+ *
+ * Return the path record of the given pax header data, which consists of
+ * records of the form "<length> <keyword>=<value>\n", where <length> is the
+ * length of the whole record.
+ *
+ * @param data The data.
+ * @param size The size of the data.
+ *
+ * @return The path record, or an empty string if there is none.
+ */
+std::string tarPaxPath(const char *data, size_t size)
+{
+    static const std::string PATH_KEYWORD = "path=";
+
+    std::string res;
+    size_t offset = 0;
+    while (offset < size) {
+        size_t length = 0;
+        size_t i = offset;
+        while ((i < size) && (data[i] >= '0') && (data[i] <= '9')) {
+            length = 10 * length + size_t(data[i] - '0');
+            ++i;
+        }
+        if ((length == 0) || (offset + length > size) || (i >= size) || (data[i] != ' ')) {
+            break;
+        }
+        std::string record(data + i + 1, offset + length - i - 1);
+        if ((record.size() > PATH_KEYWORD.size())
+            && (record.compare(0, PATH_KEYWORD.size(), PATH_KEYWORD) == 0)
+            && (record.back() == '\n')) {
+            res = record.substr(PATH_KEYWORD.size(), record.size() - PATH_KEYWORD.size() - 1);
+        }
+        offset += length;
+    }
+    return res;
+}
+
+ImportLoader Importer::archiveLoader(const std::string &archive)
+{
+    // Read the archive in one go and index its regular files, so that they can
+    // then be served without accessing the disk. We support ustar archives
+    // (with a prefix for long paths), GNU archives (with a special entry for
+    // long paths and base-256 sizes for large files), and pax archives (with a
+    // path record in an extended or a global header).
+
+    static const size_t BLOCK_SIZE = 512;
+
+    std::ifstream file(archive, std::ios::binary);
+    if (!file.good()) {
+        return nullptr;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    auto sharedData = std::make_shared<const std::string>(buffer.str());
+    auto sharedFiles = std::make_shared<std::map<std::string, std::pair<size_t, size_t>>>();
+    std::string longPath;
+    std::string globalPath;
+    bool ended = false;
+    size_t offset = 0;
+
+    while (offset + BLOCK_SIZE <= sharedData->size()) {
+        const char *header = sharedData->data() + offset;
+        if (header[0] == '\0') {
+            ended = true;
+            break;
+        }
+
+        size_t checksum;
+        size_t size;
+
+        if (!tarNumericField(header + 148, 8, checksum) || (checksum != tarChecksum(header))
+            || !tarNumericField(header + 124, 12, size)) {
+            return nullptr;
+        }
+
+        auto type = header[156];
+        auto dataOffset = offset + BLOCK_SIZE;
+
+        if (size > sharedData->size() - dataOffset) {
+            return nullptr;
+        }
+
+        if (type == 'L') {
+            longPath = tarStringField(sharedData->data() + dataOffset, size);
+        } else if (type == 'x') {
+            auto path = tarPaxPath(sharedData->data() + dataOffset, size);
+            if (!path.empty()) {
+                longPath = path;
+            }
+        } else if (type == 'g') {
+            globalPath = tarPaxPath(sharedData->data() + dataOffset, size);
+        } else {
+            std::string path;
+            if (!longPath.empty()) {
+                path = longPath;
+                longPath.clear();
+            } else if (!globalPath.empty()) {
+                path = globalPath;
+            } else {
+                path = tarStringField(header, 100);
+                if (memcmp(header + 257, "ustar", 5) == 0) {
+                    auto prefix = tarStringField(header + 345, 155);
+                    if (!prefix.empty()) {
+                        path = prefix + "/" + path;
+                    }
+                }
+            }
+            if ((type == '0') || (type == '\0')) {
+                if (path.compare(0, 2, "./") == 0) {
+                    path = path.substr(2);
+                }
+                (*sharedFiles)[path] = std::make_pair(dataOffset, size);
+            }
+        }
+
+        offset = dataOffset + (size + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+    }
+
+    // An archive ends with a block of zeros, so if we didn't come across one
+    // then the archive is truncated.
+
+    if (!ended) {
+        return nullptr;
+    }
+
+    return [sharedData, sharedFiles](const std::string &url, std::string &contents) {
+        auto file = sharedFiles->find(url);
+        if (file == sharedFiles->end()) {
+            return false;
+        }
+        contents.assign(*sharedData, file->second.first, file->second.second);
+        return true;
+    };
+}
+
+/**
+ * @brief Get the model that imports from the given import source.
+ *
+ * Get the model that imports from the given @p importSource, i.e. the model
+ * that owns the components and units imported from it.
+ *
+ * @param importSource The import source.
+ *
+ * @return The importing model, or @c nullptr if nothing is imported from
+ * @p importSource.
+ */
+ModelPtr importingModel(const ImportSourcePtr &importSource)
+{
+    if (importSource->componentCount() != 0) {
+        return owningModel(importSource->component(0));
+    }
+    if (importSource->unitsCount() != 0) {
+        return owningModel(importSource->units(0));
+    }
+    return nullptr;
+}
+
+std::vector<std::string> Importer::dependencies(const std::string &key) const
+{
+    std::vector<std::string> res;
+    auto model = mPimpl->mLibrary.find(key);
+    if (model == mPimpl->mLibrary.end()) {
+        return res;
+    }
+    for (const auto &importSources : mPimpl->mImportSources) {
+        for (const auto &importSource : mPimpl->importSources(importSources.first)) {
+            if (importingModel(importSource) == model->second) {
+                res.push_back(importSources.first);
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+std::vector<std::string> Importer::dependants(const std::string &key) const
+{
+    std::set<std::string> res;
+    for (const auto &importSource : mPimpl->importSources(key)) {
+        auto model = importingModel(importSource);
+        for (const auto &libraryModel : mPimpl->mLibrary) {
+            if (libraryModel.second == model) {
+                res.insert(libraryModel.first);
+                break;
+            }
+        }
+    }
+    return {res.begin(), res.end()};
+}
+
+bool Importer::invalidate(const std::string &key)
+{
+    auto model = mPimpl->mLibrary.find(key);
+    if (model == mPimpl->mLibrary.end()) {
+        return false;
+    }
+
+    std::string contents;
+    if (!mPimpl->mLoader(key, contents)) {
+        auto issue = Issue::create();
+        issue->setDescription("The attempt to invalidate the model at '" + key + "' failed: the file could not be opened.");
+        issue->setReferenceRule(Issue::ReferenceRule::UNSPECIFIED);
+        addIssue(issue);
+        return false;
+    }
+
+    // Replace the model, resolve its imports, and have the import sources that
+    // used the old model use the new one.
+
+    auto parsedFile = parseFile(contents, mPimpl->mCacheDirectory);
+    auto newModel = parsedFile.mModel;
+    model->second = newModel;
+    mPimpl->recordParsedFile(key, parsedFile);
+    auto res = resolveImports(newModel, key);
+    auto importSources = mPimpl->importSources(key);
+    for (const auto &importSource : importSources) {
+        importSource->setModel(newModel);
+    }
+
+    // The new model may not provide the entities that other models import from
+    // it anymore or it may introduce a cycle, so fetch those entities again,
+    // unless imports are resolved lazily. The base file of an importing model
+    // is its key in the library, if it is there.
+
+    // Those import sources are kept by address, so go through them in the order
+    // of the key of their importing model and of their index in that model, so
+    // that any issue is always reported in the same order.
+
+    if (!mPimpl->mLazyResolution) {
+        std::vector<std::tuple<std::string, size_t, ModelPtr, ImportSourcePtr>> dependants;
+        for (const auto &importSource : importSources) {
+            auto origModel = importingModel(importSource);
+            if (origModel == nullptr) {
+                continue;
+            }
+            size_t index = 0;
+            while ((index < origModel->importSourceCount())
+                   && (origModel->importSource(index) != importSource)) {
+                ++index;
+            }
+            dependants.emplace_back(mPimpl->libraryKey(origModel), index, origModel, importSource);
+        }
+        std::sort(dependants.begin(), dependants.end(), [](const auto &a, const auto &b) {
+            return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+        });
+
+        ImportHistory history;
+        for (const auto &dependant : dependants) {
+            const auto &baseFile = std::get<0>(dependant);
+            const auto &origModel = std::get<2>(dependant);
+            const auto &importSource = std::get<3>(dependant);
+            for (size_t u = 0; u < importSource->unitsCount(); ++u) {
+                history.clear();
+                if (!mPimpl->fetchUnits(origModel, importSource->units(u), baseFile, history)) {
+                    res = false;
+                }
+            }
+            for (size_t c = 0; c < importSource->componentCount(); ++c) {
+                history.clear();
+                if (!mPimpl->fetchComponent(origModel, importSource->component(c), baseFile, history)) {
+                    res = false;
+                }
+            }
+        }
+    }
+
+    return res;
+}
+
+void Importer::setStatisticsEnabled(bool enabled)
+{
+    mPimpl->mStatisticsEnabled = enabled;
+}
+
+bool Importer::statisticsEnabled() const
+{
+    return mPimpl->mStatisticsEnabled;
+}
+
+size_t Importer::statisticsCount() const
+{
+    return mPimpl->mStatistics.size();
+}
+
+ImportStatisticsPtr Importer::statistics(const std::string &key) const
+{
+    auto res = mPimpl->mStatistics.find(key);
+    if (res == mPimpl->mStatistics.end()) {
+        return nullptr;
+    }
+    return res->second;
+}
+
+ImportStatisticsPtr Importer::statistics(size_t index) const
+{
+    if (index >= mPimpl->mStatistics.size()) {
+        return nullptr;
+    }
+    return std::next(mPimpl->mStatistics.begin(), ptrdiff_t(index))->second;
+}
+
+void Importer::removeAllStatistics()
+{
+    mPimpl->mStatistics.clear();
+}
+
 std::string Importer::key(const size_t &index)
 {
     if (index >= mPimpl->mLibrary.size()) {
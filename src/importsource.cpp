@@ -17,7 +17,6 @@ limitations under the License.
 #include "libcellml/importsource.h"
 
 #include <algorithm>
-#include <vector>
 
 #include "libcellml/component.h"
 #include "libcellml/importedentity.h"
@@ -25,28 +24,85 @@ limitations under the License.
 #include "libcellml/types.h"
 #include "libcellml/units.h"
 
-#include "internaltypes.h"
+#include "importsource_p.h"
+#include "utilities.h"
 
 namespace libcellml {
 
-using ImportedEntityWeakPtr = std::weak_ptr<ImportedEntity>;
+ModelPtr ImportSource::ImportSourceImpl::model()
+{
+    std::lock_guard<std::mutex> lock(mModelMutex);
+
+    // Load our model, if it is to be loaded lazily and hasn't been loaded yet.
+
+    if (mModelLoader != nullptr) {
+        auto modelLoader = std::move(mModelLoader);
+
+        mModelLoader = nullptr;
+        mModel = modelLoader();
+    }
+
+    return mModel.lock();
+}
+
+bool ImportSource::ImportSourceImpl::hasModel()
+{
+    std::lock_guard<std::mutex> lock(mModelMutex);
+
+    return !mModel.expired();
+}
+
+void ImportSource::ImportSourceImpl::setModel(const ModelPtr &model)
+{
+    std::lock_guard<std::mutex> lock(mModelMutex);
+
+    mModelLoader = nullptr;
+
+    if (model == nullptr) {
+        mModel.reset();
+    } else {
+        mModel = model;
+    }
+}
+
+void ImportSource::ImportSourceImpl::setModelLoader(const ModelLoader &modelLoader)
+{
+    std::lock_guard<std::mutex> lock(mModelMutex);
+
+    // Only set the loader if we have neither a model nor a loader already.
+
+    if (mModel.expired() && (mModelLoader == nullptr)) {
+        mModelLoader = modelLoader;
+    }
+}
+
+ImportSource::ImportSourceImpl *ImportSource::ImportSourceImpl::impl(const ImportSource *importSource)
+{
+    return importSource->mPimpl;
+}
+
+namespace {
 
 /**
- * @brief The ImportSource::ImportSourceImpl struct.
+ * @brief The ImportSourceLoader class.
  *
- * The private implementation for the ImportSource class.
+ * The importer gets to the private implementation of an import source, whose
+ * type is only visible to classes that derive from ImportSource, to set the
+ * loader of its model.
  */
-struct ImportSource::ImportSourceImpl
+class ImportSourceLoader: public ImportSource
 {
-    std::string mUrl;
-    ModelWeakPtr mModel;
-    std::vector<size_t> mComponents;
-    std::vector<size_t> mUnits;
-    std::vector<ImportedEntityWeakPtr> mImports;
-
-    void removeItem(std::vector<ImportedEntityWeakPtr>::iterator &it);
+public:
+    using ImportSource::ImportSourceImpl;
 };
 
+} // namespace
+
+void setModelLoader(const ImportSourcePtr &importSource, const ModelLoader &modelLoader)
+{
+    ImportSourceLoader::ImportSourceImpl::impl(importSource.get())->setModelLoader(modelLoader);
+}
+
 ImportSource::ImportSource()
     : mPimpl(new ImportSourceImpl())
 {
@@ -59,10 +115,14 @@ ImportSource::~ImportSource()
 
 ImportSourcePtr ImportSource::create() noexcept
 {
-    return std::shared_ptr<ImportSource> {new ImportSource {}};
+    struct ImportSourceInstance: public ImportSource
+    {
+    };
+
+    return std::make_shared<ImportSourceInstance>();
 }
 
-std::string ImportSource::url() const
+const std::string &ImportSource::url() const
 {
     return mPimpl->mUrl;
 }
@@ -74,29 +134,22 @@ void ImportSource::setUrl(const std::string &url)
 
 ModelPtr ImportSource::model() const
 {
-    if (mPimpl->mModel.expired()) {
-        return nullptr;
-    }
-    return mPimpl->mModel.lock();
+    return mPimpl->model();
 }
 
 void ImportSource::setModel(const ModelPtr &model)
 {
-    if (model == nullptr) {
-        mPimpl->mModel.reset();
-    } else {
-        mPimpl->mModel = model;
-    }
+    mPimpl->setModel(model);
 }
 
 void ImportSource::removeModel()
 {
-    mPimpl->mModel.reset();
+    mPimpl->setModel(nullptr);
 }
 
 bool ImportSource::hasModel() const
 {
-    return !mPimpl->mModel.expired();
+    return mPimpl->hasModel();
 }
 
 ImportSourcePtr ImportSource::clone() const
@@ -0,0 +1,67 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importsource.h"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "internaltypes.h"
+
+namespace libcellml {
+
+using ImportedEntityWeakPtr = std::weak_ptr<ImportedEntity>;
+using ModelLoader = std::function<ModelPtr()>; /**< Type definition for a function loading the model of an import source. */
+
+/**
+ * @brief The ImportSource::ImportSourceImpl struct.
+ *
+ * The private implementation for the ImportSource class.
+ */
+struct ImportSource::ImportSourceImpl
+{
+    std::string mUrl;
+    ModelWeakPtr mModel;
+    ModelLoader mModelLoader;
+    std::mutex mModelMutex;
+    std::vector<size_t> mComponents;
+    std::vector<size_t> mUnits;
+    std::vector<ImportedEntityWeakPtr> mImports;
+
+    ModelPtr model();
+    bool hasModel();
+    void setModel(const ModelPtr &model);
+    void setModelLoader(const ModelLoader &modelLoader);
+
+    void removeItem(std::vector<ImportedEntityWeakPtr>::iterator &it);
+
+    static ImportSourceImpl *impl(const ImportSource *importSource);
+};
+
+/**
+ * @brief Set the loader of the model of the given import source.
+ *
+ * Set the loader that the given import source is to use to load its model the
+ * first time that it is needed, unless the import source already has a model
+ * or a loader.
+ *
+ * @param importSource The import source whose model is to be loaded lazily.
+ * @param modelLoader The loader of the model of the import source.
+ */
+void setModelLoader(const ImportSourcePtr &importSource, const ModelLoader &modelLoader);
+
+} // namespace libcellml
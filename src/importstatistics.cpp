@@ -0,0 +1,73 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importstatistics.h"
+
+#include "importstatistics_p.h"
+
+namespace libcellml {
+
+ImportStatistics::ImportStatistics()
+    : mPimpl(new ImportStatisticsImpl())
+{
+}
+
+ImportStatistics::~ImportStatistics()
+{
+    delete mPimpl;
+}
+
+std::string ImportStatistics::key() const
+{
+    return mPimpl->mKey;
+}
+
+size_t ImportStatistics::bytesRead() const
+{
+    return mPimpl->mBytesRead;
+}
+
+double ImportStatistics::parseTime() const
+{
+    return mPimpl->mParseTime;
+}
+
+size_t ImportStatistics::cacheHitCount() const
+{
+    return mPimpl->mCacheHitCount;
+}
+
+size_t ImportStatistics::cacheMissCount() const
+{
+    return mPimpl->mCacheMissCount;
+}
+
+size_t ImportStatistics::componentCount() const
+{
+    return mPimpl->mComponentCount;
+}
+
+size_t ImportStatistics::unitsCount() const
+{
+    return mPimpl->mUnitsCount;
+}
+
+double ImportStatistics::flattenTime() const
+{
+    return mPimpl->mFlattenTime;
+}
+
+} // namespace libcellml
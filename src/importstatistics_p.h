@@ -0,0 +1,40 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/importstatistics.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ImportStatistics::ImportStatisticsImpl struct.
+ *
+ * The private implementation for the ImportStatistics class.
+ */
+struct ImportStatistics::ImportStatisticsImpl
+{
+    std::string mKey;
+    size_t mBytesRead = 0;
+    double mParseTime = 0.0;
+    size_t mCacheHitCount = 0;
+    size_t mCacheMissCount = 0;
+    size_t mComponentCount = 0;
+    size_t mUnitsCount = 0;
+    double mFlattenTime = 0.0;
+};
+
+} // namespace libcellml
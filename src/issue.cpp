@@ -64,58 +64,13 @@ Issue::~Issue()
     delete mPimpl;
 }
 
-Issue::Issue(const ModelPtr &model)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<ModelPtr>(model);
-    mPimpl->mCellmlElementType = CellmlElementType::MODEL;
-}
-
-Issue::Issue(const ComponentPtr &component)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<ComponentPtr>(component);
-    mPimpl->mCellmlElementType = CellmlElementType::COMPONENT;
-}
-
-Issue::Issue(const ImportSourcePtr &importSource)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<ImportSourcePtr>(importSource);
-    mPimpl->mCellmlElementType = CellmlElementType::IMPORT;
-}
-
-Issue::Issue(const UnitsPtr &units)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<UnitsPtr>(units);
-    mPimpl->mCellmlElementType = CellmlElementType::UNITS;
-}
-
-Issue::Issue(const VariablePtr &variable)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<VariablePtr>(variable);
-    mPimpl->mCellmlElementType = CellmlElementType::VARIABLE;
-}
-
-Issue::Issue(const ResetPtr &reset)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<ResetPtr>(reset);
-    mPimpl->mCellmlElementType = CellmlElementType::RESET;
-}
-
-Issue::Issue(const UnitPtr &unit)
-    : mPimpl(new IssueImpl())
-{
-    mPimpl->mItem = std::make_any<UnitPtr>(unit);
-    mPimpl->mCellmlElementType = CellmlElementType::UNIT;
-}
-
 IssuePtr Issue::create() noexcept
 {
-    return std::shared_ptr<Issue> {new Issue {}};
+    struct IssueInstance: public Issue
+    {
+    };
+
+    return std::make_shared<IssueInstance>();
 }
 
 IssuePtr Issue::create(const ComponentPtr &component, CellmlElementType cellmlElementType) noexcept
@@ -124,7 +79,8 @@ IssuePtr Issue::create(const ComponentPtr &component, CellmlElementType cellmlEl
         && ((cellmlElementType == CellmlElementType::COMPONENT)
             || (cellmlElementType == CellmlElementType::COMPONENT_REF)
             || (cellmlElementType == CellmlElementType::MATH))) {
-        auto issue = std::shared_ptr<Issue> {new Issue {component}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<ComponentPtr>(component);
         issue->mPimpl->mCellmlElementType = cellmlElementType;
         return issue;
     }
@@ -134,7 +90,8 @@ IssuePtr Issue::create(const ComponentPtr &component, CellmlElementType cellmlEl
 IssuePtr Issue::create(const ImportSourcePtr &importSource) noexcept
 {
     if (importSource != nullptr) {
-        auto issue = std::shared_ptr<Issue> {new Issue {importSource}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<ImportSourcePtr>(importSource);
         issue->mPimpl->mCellmlElementType = CellmlElementType::IMPORT;
         return issue;
     }
@@ -147,7 +104,8 @@ IssuePtr Issue::create(const ModelPtr &model, CellmlElementType cellmlElementTyp
     if ((model != nullptr)
         && ((cellmlElementType == CellmlElementType::MODEL)
             || (cellmlElementType == CellmlElementType::ENCAPSULATION))) {
-        auto issue = std::shared_ptr<Issue> {new Issue {model}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<ModelPtr>(model);
         issue->mPimpl->mCellmlElementType = cellmlElementType;
         return issue;
     }
@@ -161,7 +119,8 @@ IssuePtr Issue::create(const ResetPtr &reset, CellmlElementType cellmlElementTyp
         && ((cellmlElementType == CellmlElementType::RESET)
             || (cellmlElementType == CellmlElementType::RESET_VALUE)
             || (cellmlElementType == CellmlElementType::TEST_VALUE))) {
-        auto issue = std::shared_ptr<Issue> {new Issue {reset}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<ResetPtr>(reset);
         issue->mPimpl->mCellmlElementType = cellmlElementType;
         return issue;
     }
@@ -171,7 +130,8 @@ IssuePtr Issue::create(const ResetPtr &reset, CellmlElementType cellmlElementTyp
 IssuePtr Issue::create(const UnitsPtr &units) noexcept
 {
     if (units != nullptr) {
-        auto issue = std::shared_ptr<Issue> {new Issue {units}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<UnitsPtr>(units);
         issue->mPimpl->mCellmlElementType = CellmlElementType::UNITS;
         return issue;
     }
@@ -181,7 +141,8 @@ IssuePtr Issue::create(const UnitsPtr &units) noexcept
 IssuePtr Issue::create(const VariablePtr &variable) noexcept
 {
     if (variable != nullptr) {
-        auto issue = std::shared_ptr<Issue> {new Issue {variable}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<VariablePtr>(variable);
         issue->mPimpl->mCellmlElementType = CellmlElementType::VARIABLE;
         return issue;
     }
@@ -191,7 +152,8 @@ IssuePtr Issue::create(const VariablePtr &variable) noexcept
 IssuePtr Issue::create(const UnitPtr &unit) noexcept
 {
     if (unit->isValid()) {
-        auto issue = std::shared_ptr<Issue> {new Issue {unit}};
+        auto issue = create();
+        issue->mPimpl->mItem = std::make_any<UnitPtr>(unit);
         issue->mPimpl->mCellmlElementType = CellmlElementType::UNIT;
         return issue;
     }
@@ -203,7 +165,7 @@ IssuePtr Issue::create(const VariablePairPtr &variablePair, CellmlElementType ce
     if (variablePair->isValid()
         && ((cellmlElementType == CellmlElementType::CONNECTION)
             || (cellmlElementType == CellmlElementType::MAP_VARIABLES))) {
-        auto issue = std::shared_ptr<Issue> {new Issue {}};
+        auto issue = create();
         issue->mPimpl->mItem = variablePair;
         issue->mPimpl->mCellmlElementType = cellmlElementType;
         return issue;
@@ -31,6 +31,7 @@ limitations under the License.
 #include "libcellml/variable.h"
 
 #include "internaltypes.h"
+#include "namedentity_p.h"
 #include "utilities.h"
 #include "xmldoc.h"
 #include "xmlutils.h"
@@ -47,43 +48,109 @@ namespace libcellml {
 struct Model::ModelImpl
 {
     std::vector<UnitsPtr> mUnits;
+    NameIndex mUnitsNameIndex;
     std::vector<ImportSourcePtr> mImports;
 
+    IndexRevision mPathIndexRevision;
+    std::unordered_map<std::string, ComponentWeakPtr> mComponentPaths;
+    std::unordered_map<std::string, VariableWeakPtr> mVariablePaths;
+
     std::vector<UnitsPtr>::iterator findUnits(const std::string &name);
     std::vector<UnitsPtr>::iterator findUnits(const UnitsPtr &units);
+
+    void indexPaths(const ComponentPtr &component, const std::string &parentPath);
+    void updatePathIndex(const Model *model);
 };
 
 std::vector<UnitsPtr>::iterator Model::ModelImpl::findUnits(const std::string &name)
 {
-    return std::find_if(mUnits.begin(), mUnits.end(),
-                        [=](const UnitsPtr &u) -> bool { return u->name() == name; });
+    return mUnitsNameIndex.find(mUnits, name);
 }
 
 std::vector<UnitsPtr>::iterator Model::ModelImpl::findUnits(const UnitsPtr &units)
 {
-    return std::find_if(mUnits.begin(), mUnits.end(),
-                        [=](const UnitsPtr &u) -> bool { return units->name().empty() ? false : u->name() == units->name() && Units::equivalent(u, units); });
+    if (units->name().empty()) {
+        return mUnits.end();
+    }
+
+    // Use our name index to find the first units with the same name and only
+    // search further if those units are not equivalent to the given ones.
+
+    auto result = mUnitsNameIndex.find(mUnits, units->name());
+
+    if ((result == mUnits.end()) || Units::equivalent(*result, units)) {
+        return result;
+    }
+
+    return std::find_if(result + 1, mUnits.end(),
+                        [=](const UnitsPtr &u) -> bool { return u->name() == units->name() && Units::equivalent(u, units); });
+}
+
+void Model::ModelImpl::indexPaths(const ComponentPtr &component, const std::string &parentPath)
+{
+    auto path = parentPath.empty() ? component->name() : parentPath + "/" + component->name();
+
+    mComponentPaths.emplace(path, component);
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+
+        mVariablePaths.emplace(path + "/" + variable->name(), variable);
+    }
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        indexPaths(component->component(i), path);
+    }
+}
+
+void Model::ModelImpl::updatePathIndex(const Model *model)
+{
+    // (Re)build our path index if it has never been built or if a component or
+    // a variable has been added, removed or renamed since it was last built.
+
+    mPathIndexRevision.update(structureRevision(model), [&]() {
+        mComponentPaths.clear();
+        mVariablePaths.clear();
+
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            indexPaths(model->component(i), "");
+        }
+    });
 }
 
 Model::Model()
     : mPimpl(new ModelImpl())
 {
+    mPimpl->mUnitsNameIndex.mOwnerNameRevision = &childNameRevision(this);
 }
 
 Model::Model(const std::string &name)
     : mPimpl(new ModelImpl())
 {
+    mPimpl->mUnitsNameIndex.mOwnerNameRevision = &childNameRevision(this);
     setName(name);
 }
 
 ModelPtr Model::create() noexcept
 {
-    return std::shared_ptr<Model> {new Model {}};
+    struct ModelInstance: public Model
+    {
+    };
+
+    return std::make_shared<ModelInstance>();
 }
 
 ModelPtr Model::create(const std::string &name) noexcept
 {
-    return std::shared_ptr<Model> {new Model {name}};
+    struct ModelInstance: public Model
+    {
+        explicit ModelInstance(const std::string &name)
+            : Model(name)
+        {
+        }
+    };
+
+    return std::make_shared<ModelInstance>(name);
 }
 
 Model::~Model()
@@ -131,6 +198,7 @@ bool Model::addUnits(const UnitsPtr &units)
         otherParent->removeUnits(units);
     }
     mPimpl->mUnits.push_back(units);
+    mPimpl->mUnitsNameIndex.add(units->name(), mPimpl->mUnits.size() - 1);
     units->setParent(shared_from_this());
 
     if (units->isImport()) {
@@ -146,6 +214,7 @@ bool Model::removeUnits(size_t index)
         auto units = *(mPimpl->mUnits.begin() + int64_t(index));
         units->removeParent();
         mPimpl->mUnits.erase(mPimpl->mUnits.begin() + int64_t(index));
+        mPimpl->mUnitsNameIndex.invalidate();
         status = true;
     }
 
@@ -159,6 +228,7 @@ bool Model::removeUnits(const std::string &name)
     if (result != mPimpl->mUnits.end()) {
         (*result)->removeParent();
         mPimpl->mUnits.erase(result);
+        mPimpl->mUnitsNameIndex.invalidate();
         status = true;
     }
 
@@ -172,6 +242,7 @@ bool Model::removeUnits(const UnitsPtr &units)
     if (result != mPimpl->mUnits.end()) {
         units->removeParent();
         mPimpl->mUnits.erase(result);
+        mPimpl->mUnitsNameIndex.invalidate();
         status = true;
     }
 
@@ -184,6 +255,7 @@ void Model::removeAllUnits()
         u->removeParent();
     }
     mPimpl->mUnits.clear();
+    mPimpl->mUnitsNameIndex.invalidate();
 }
 
 bool Model::hasUnits(const std::string &name) const
@@ -239,6 +311,7 @@ bool Model::replaceUnits(size_t index, const UnitsPtr &units)
     bool status = false;
     if (removeUnits(index)) {
         mPimpl->mUnits.insert(mPimpl->mUnits.begin() + int64_t(index), units);
+        mPimpl->mUnitsNameIndex.invalidate();
         status = true;
     }
 
@@ -364,6 +437,24 @@ bool Model::hasUnresolvedImports() const
     return unresolvedImports;
 }
 
+ComponentPtr Model::componentByPath(const std::string &path) const
+{
+    mPimpl->updatePathIndex(this);
+
+    auto result = mPimpl->mComponentPaths.find(path);
+
+    return (result != mPimpl->mComponentPaths.end()) ? result->second.lock() : nullptr;
+}
+
+VariablePtr Model::variableByPath(const std::string &path) const
+{
+    mPimpl->updatePathIndex(this);
+
+    auto result = mPimpl->mVariablePaths.find(path);
+
+    return (result != mPimpl->mVariablePaths.end()) ? result->second.lock() : nullptr;
+}
+
 bool hasComponentImports(const ComponentEntityConstPtr &componentEntity)
 {
     bool importsPresent = false;
@@ -19,6 +19,9 @@ limitations under the License.
 #include "libcellml/component.h"
 #include "libcellml/componententity.h"
 
+#include "namedentity_p.h"
+#include "utilities.h"
+
 namespace libcellml {
 
 /**
@@ -29,8 +32,58 @@ namespace libcellml {
 struct NamedEntity::NamedEntityImpl
 {
     std::string mName; /**< Entity name represented as a std::string. */
+    size_t mChildNameRevision = 0; /**< Revision of the names of this entity's children. */
+    size_t mStructureRevision = 0; /**< Revision of the structure of the tree of entities rooted at this entity. */
+    size_t mEquivalenceRevision = 0; /**< Revision of the equivalences of the tree of entities rooted at this entity. */
+
+    void nameChanged(NamedEntity *entity);
+
+    static NamedEntityImpl *impl(const NamedEntity *entity);
+    static NamedEntityImpl *rootImpl(const NamedEntity *entity, EntityPtr &root);
 };
 
+NamedEntity::NamedEntityImpl *NamedEntity::NamedEntityImpl::impl(const NamedEntity *entity)
+{
+    return entity->mPimpl;
+}
+
+NamedEntity::NamedEntityImpl *NamedEntity::NamedEntityImpl::rootImpl(const NamedEntity *entity, EntityPtr &root)
+{
+    // Some revisions are kept by the root of the tree of entities to which the
+    // given entity belongs, e.g. a model. The root is returned through the
+    // given shared pointer so that it stays alive for as long as it is needed.
+
+    auto parent = entity->parent();
+
+    while (parent != nullptr) {
+        root = parent;
+        parent = parent->parent();
+    }
+
+    auto namedRoot = (root != nullptr) ? dynamic_cast<const NamedEntity *>(root.get()) : entity;
+
+    return (namedRoot != nullptr) ? namedRoot->mPimpl : nullptr;
+}
+
+void NamedEntity::NamedEntityImpl::nameChanged(NamedEntity *entity)
+{
+    // Let any name index of our parent and any path index of our root know
+    // that they might need rebuilding.
+
+    auto parent = std::dynamic_pointer_cast<NamedEntity>(entity->parent());
+
+    if (parent != nullptr) {
+        ++parent->mPimpl->mChildNameRevision;
+
+        EntityPtr root;
+        auto impl = rootImpl(entity, root);
+
+        if (impl != nullptr) {
+            ++impl->mStructureRevision;
+        }
+    }
+}
+
 NamedEntity::NamedEntity()
     : mPimpl(new NamedEntityImpl())
 {
@@ -43,12 +96,83 @@ NamedEntity::~NamedEntity()
 
 void NamedEntity::setName(const std::string &name)
 {
+    if (name != mPimpl->mName) {
+        mPimpl->nameChanged(this);
+    }
+
     mPimpl->mName = name;
 }
 
-std::string NamedEntity::name() const
+void NamedEntity::setName(std::string &&name)
+{
+    if (name != mPimpl->mName) {
+        mPimpl->nameChanged(this);
+    }
+
+    mPimpl->mName = std::move(name);
+}
+
+const std::string &NamedEntity::name() const
 {
     return mPimpl->mName;
 }
 
+namespace {
+
+/**
+ * @brief The NamedEntityRevisions class.
+ *
+ * Internal code gets to the revisions of a named entity through the private
+ * implementation of the named entity, whose type is only visible to classes
+ * that derive from NamedEntity.
+ */
+class NamedEntityRevisions: public NamedEntity
+{
+public:
+    using NamedEntity::NamedEntityImpl;
+};
+
+using Impl = NamedEntityRevisions::NamedEntityImpl;
+
+} // namespace
+
+const size_t &childNameRevision(const NamedEntity *entity)
+{
+    return Impl::impl(entity)->mChildNameRevision;
+}
+
+size_t structureRevision(const NamedEntity *entity)
+{
+    return Impl::impl(entity)->mStructureRevision;
+}
+
+void updateStructureRevision(const NamedEntity *entity)
+{
+    // Adding or removing an entity may also add or remove equivalences, so
+    // both revisions of our root need updating.
+
+    EntityPtr root;
+    auto impl = Impl::rootImpl(entity, root);
+
+    if (impl != nullptr) {
+        ++impl->mStructureRevision;
+        ++impl->mEquivalenceRevision;
+    }
+}
+
+size_t equivalenceRevision(const NamedEntity *entity)
+{
+    return Impl::impl(entity)->mEquivalenceRevision;
+}
+
+void updateEquivalenceRevision(const NamedEntity *entity)
+{
+    EntityPtr root;
+    auto impl = Impl::rootImpl(entity, root);
+
+    if (impl != nullptr) {
+        ++impl->mEquivalenceRevision;
+    }
+}
+
 } // namespace libcellml
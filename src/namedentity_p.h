@@ -0,0 +1,90 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/namedentity.h"
+
+namespace libcellml {
+
+/**
+ * @brief Get the revision of the names of the children of the given entity.
+ *
+ * Get the revision of the names of the children of the given entity. The
+ * revision changes every time a child of the entity is renamed, which allows an
+ * index of the children of the entity, based on their name, to know when it
+ * needs rebuilding.
+ *
+ * @param entity The entity whose children are to be considered.
+ *
+ * @return A reference to the revision of the names of the children of the
+ * given entity.
+ */
+const size_t &childNameRevision(const NamedEntity *entity);
+
+/**
+ * @brief Get the revision of the structure of the given entity.
+ *
+ * Get the revision of the structure of the tree of entities of which the given
+ * entity is the root, e.g. a model. The revision changes every time an entity
+ * is added to, removed from or renamed in that tree, which allows an index of
+ * the paths of the entities in that tree to know when it needs rebuilding.
+ *
+ * @param entity The entity that is the root of the tree of entities.
+ *
+ * @return The revision of the structure of the given entity.
+ */
+size_t structureRevision(const NamedEntity *entity);
+
+/**
+ * @brief Update the revisions of the root of the given entity.
+ *
+ * Update the revisions of the structure and of the equivalences of the root of
+ * the tree of entities to which the given entity belongs. This must be called
+ * every time an entity is added to or removed from the given entity since the
+ * added or removed entity may come with its own equivalences.
+ *
+ * @param entity The entity to which an entity was added or from which an
+ * entity was removed.
+ */
+void updateStructureRevision(const NamedEntity *entity);
+
+/**
+ * @brief Get the revision of the equivalences of the given entity.
+ *
+ * Get the revision of the equivalences of the variables in the tree of
+ * entities of which the given entity is the root, e.g. a model. The revision
+ * changes every time an equivalence involving one of those variables is added
+ * or removed, as well as every time an entity is added to or removed from that
+ * tree, which allows an index of those equivalences to know when it needs
+ * rebuilding.
+ *
+ * @param entity The entity that is the root of the tree of entities.
+ *
+ * @return The revision of the equivalences of the given entity.
+ */
+size_t equivalenceRevision(const NamedEntity *entity);
+
+/**
+ * @brief Update the revision of the equivalences of the root of the given entity.
+ *
+ * Update the revision of the equivalences of the root of the tree of entities
+ * to which the given entity belongs. This must be called every time an
+ * equivalence involving the given entity is added or removed.
+ *
+ * @param entity The entity involved in the equivalence.
+ */
+void updateEquivalenceRevision(const NamedEntity *entity);
+
+} // namespace libcellml
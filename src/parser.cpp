@@ -29,6 +29,7 @@ limitations under the License.
 #include "libcellml/reset.h"
 #include "libcellml/variable.h"
 
+#include "binarymodel.h"
 #include "namespaces.h"
 #include "utilities.h"
 #include "xmldoc.h"
@@ -243,6 +244,20 @@ ModelPtr Parser::parseModel(const std::string &input)
     return model;
 }
 
+ModelPtr Parser::parseBinaryModel(const std::string &input)
+{
+    removeAllIssues();
+    ModelPtr model = Model::create();
+    std::string error;
+    if (!readBinaryModel(model, input, error)) {
+        IssuePtr issue = Issue::create();
+        issue->setDescription(error);
+        issue->setReferenceRule(Issue::ReferenceRule::INVALID_ARGUMENT);
+        addIssue(issue);
+    }
+    return model;
+}
+
 void Parser::ParserImpl::updateModel(const ModelPtr &model, const std::string &input)
 {
     loadModel(model, input);
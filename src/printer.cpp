@@ -31,9 +31,11 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
+#include "binarymodel.h"
 #include "internaltypes.h"
+#include "namespaces.h"
 #include "utilities.h"
-#include "xmldoc.h"
+#include "xmlwriter.h"
 
 namespace libcellml {
 
@@ -44,32 +46,26 @@ namespace libcellml {
  */
 struct Printer::PrinterImpl
 {
-    std::string printImports(const ModelPtr &model, IdList &idList, bool autoIds);
-    std::string printUnits(const UnitsPtr &units, IdList &idList, bool autoIds);
-    std::string printComponent(const ComponentPtr &component, IdList &idList, bool autoIds);
-    std::string printEncapsulation(const ComponentPtr &component, IdList &idList, bool autoIds);
-    std::string printVariable(const VariablePtr &variable, IdList &idList, bool autoIds);
-    std::string printReset(const ResetPtr &reset, IdList &idList, bool autoIds);
-    std::string printResetChild(const std::string &childLabel, const std::string &childId, const std::string &math, IdList &idList, bool autoIds);
+    void printImports(const ModelPtr &model, XmlWriter &writer, IdList &idList, bool autoIds);
+    void printUnits(const UnitsPtr &units, XmlWriter &writer, IdList &idList, bool autoIds);
+    void printComponent(const ComponentPtr &component, XmlWriter &writer, IdList &idList, bool autoIds);
+    void printVariable(const VariablePtr &variable, XmlWriter &writer, IdList &idList, bool autoIds);
+    void printReset(const ResetPtr &reset, XmlWriter &writer, IdList &idList, bool autoIds);
+    void printResetChild(const std::string &childLabel, const std::string &childId, const std::string &math, XmlWriter &writer, IdList &idList, bool autoIds);
+    bool printModel(const ModelPtr &model, std::ostream &output, bool autoIds);
 };
 
-std::string printMapVariables(const VariablePairPtr &variablePair, IdList &idList, bool autoIds)
+void printId(const std::string &id, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string mapVariables = "<map_variables variable_1=\"" + variablePair->variable1()->name() + "\""
-                               + " variable_2=\"" + variablePair->variable2()->name() + "\"";
-    std::string mappingId = Variable::equivalenceMappingId(variablePair->variable1(), variablePair->variable2());
-    if (!mappingId.empty()) {
-        mapVariables += " id=\"" + mappingId + "\"";
+    if (!id.empty()) {
+        writer.addAttribute("id", id);
     } else if (autoIds) {
-        mapVariables += " id=\"" + makeUniqueId(idList) + "\"";
+        writer.addAttribute("id", makeUniqueId(idList));
     }
-    mapVariables += "/>";
-    return mapVariables;
 }
 
-std::string printConnections(const ComponentMap &componentMap, const VariableMap &variableMap, IdList &idList, bool autoIds)
+void printConnections(const ComponentMap &componentMap, const VariableMap &variableMap, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string connections;
     ComponentMap serialisedComponentMap;
     size_t componentMapIndex1 = 0;
     for (auto iterPair = componentMap.begin(); iterPair < componentMap.end(); ++iterPair) {
@@ -90,10 +86,19 @@ std::string printConnections(const ComponentMap &componentMap, const VariableMap
             ++componentMapIndex1;
             continue;
         }
-        std::string mappingVariables;
+        // Collect the variable equivalence pairs of this connection, along with their mapping ids, which are
+        // generated before the connection id.
+        std::vector<std::pair<VariablePairPtr, std::string>> mappings;
+        auto addMapping = [&mappings, &idList, autoIds](const VariablePairPtr &variablePair) {
+            std::string mappingId = Variable::equivalenceMappingId(variablePair->variable1(), variablePair->variable2());
+            if (mappingId.empty() && autoIds) {
+                mappingId = makeUniqueId(idList);
+            }
+            mappings.emplace_back(variablePair, mappingId);
+        };
         VariablePairPtr variablePair = variableMap.at(componentMapIndex1);
         std::string connectionId = Variable::equivalenceConnectionId(variablePair->variable1(), variablePair->variable2());
-        mappingVariables += printMapVariables(variablePair, idList, autoIds);
+        addMapping(variablePair);
         // Check for subsequent variable equivalence pairs with the same parent components.
         size_t componentMapIndex2 = componentMapIndex1 + 1;
         for (auto iterPair2 = iterPair + 1; iterPair2 < componentMap.end(); ++iterPair2) {
@@ -101,30 +106,33 @@ std::string printConnections(const ComponentMap &componentMap, const VariableMap
             ComponentPtr nextComponent2 = iterPair2->second;
             VariablePairPtr variablePair2 = variableMap.at(componentMapIndex2);
             if ((currentComponent1 == nextComponent1) && (currentComponent2 == nextComponent2)) {
-                mappingVariables += printMapVariables(variablePair2, idList, autoIds);
+                addMapping(variablePair2);
                 connectionId = Variable::equivalenceConnectionId(variablePair2->variable1(), variablePair2->variable2());
             }
             ++componentMapIndex2;
         }
         // Serialise out the new connection.
-        connections += "<connection";
+        writer.startElement("connection");
         if (currentComponent1 != nullptr) {
-            connections += " component_1=\"" + currentComponent1->name() + "\"";
+            writer.addAttribute("component_1", currentComponent1->name());
         }
         if (currentComponent2 != nullptr) {
-            connections += " component_2=\"" + currentComponent2->name() + "\"";
+            writer.addAttribute("component_2", currentComponent2->name());
         }
-        if (!connectionId.empty()) {
-            connections += " id=\"" + connectionId + "\"";
-        } else if (autoIds) {
-            connections += " id=\"" + makeUniqueId(idList) + "\"";
+        printId(connectionId, writer, idList, autoIds);
+        for (const auto &mapping : mappings) {
+            writer.startElement("map_variables");
+            writer.addAttribute("variable_1", mapping.first->variable1()->name());
+            writer.addAttribute("variable_2", mapping.first->variable2()->name());
+            if (!mapping.second.empty()) {
+                writer.addAttribute("id", mapping.second);
+            }
+            writer.endElement();
         }
-        connections += ">" + mappingVariables + "</connection>";
+        writer.endElement();
         serialisedComponentMap.push_back(currentComponentPair);
         ++componentMapIndex1;
     }
-
-    return connections;
 }
 
 std::string printMath(const std::string &math)
@@ -135,6 +143,49 @@ std::string printMath(const std::string &math)
     return std::regex_replace(temp, after, "<");
 }
 
+/**
+ * @brief Get the ids of the component references of an encapsulation.
+ *
+ * Get, in document order, the ids of the component references for
+ * @p component and its descendants, generating the missing ones if
+ * @p autoIds is @c true. The ids are generated when the components are
+ * serialised, but the encapsulation itself is only serialised after the
+ * connections.
+ *
+ * @param component The component at the top of the encapsulation.
+ * @param ids The list of ids to add to.
+ * @param idList The list of ids already in use.
+ * @param autoIds Whether to generate missing ids.
+ */
+void listEncapsulationIds(const ComponentPtr &component, std::vector<std::string> &ids, IdList &idList, bool autoIds)
+{
+    std::string id = component->encapsulationId();
+    if (id.empty() && autoIds) {
+        id = makeUniqueId(idList);
+    }
+    ids.push_back(id);
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        listEncapsulationIds(component->component(i), ids, idList, autoIds);
+    }
+}
+
+void printEncapsulation(const ComponentPtr &component, XmlWriter &writer, const std::vector<std::string> &ids, size_t &idIndex)
+{
+    const std::string &componentName = component->name();
+    writer.startElement("component_ref");
+    if (!componentName.empty()) {
+        writer.addAttribute("component", componentName);
+    }
+    const std::string &id = ids.at(idIndex++);
+    if (!id.empty()) {
+        writer.addAttribute("id", id);
+    }
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        printEncapsulation(component->component(i), writer, ids, idIndex);
+    }
+    writer.endElement();
+}
+
 void buildMapsForComponentsVariables(const ComponentPtr &component, ComponentMap &componentMap, VariableMap &variableMap)
 {
     for (size_t i = 0; i < component->variableCount(); ++i) {
@@ -172,271 +223,154 @@ void buildMaps(const ComponentEntityPtr &componentEntity, ComponentMap &componen
     }
 }
 
-std::string Printer::PrinterImpl::printUnits(const UnitsPtr &units, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printUnits(const UnitsPtr &units, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string repr;
     if (!units->isImport() && !isStandardUnit(units)) {
-        bool endTag = false;
-        repr += "<units";
-        std::string unitsName = units->name();
+        writer.startElement("units");
+        const std::string &unitsName = units->name();
         if (!unitsName.empty()) {
-            repr += " name=\"" + unitsName + "\"";
-        }
-        if (!units->id().empty()) {
-            repr += " id=\"" + units->id() + "\"";
-        } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+            writer.addAttribute("name", unitsName);
         }
-        if (units->unitCount() > 0) {
-            endTag = true;
-            repr += ">";
-            for (size_t i = 0; i < units->unitCount(); ++i) {
-                std::string reference;
-                std::string prefix;
-                std::string id;
-                double exponent;
-                double multiplier;
-                units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
-                repr += "<unit";
-                if (exponent != 1.0) {
-                    repr += " exponent=\"" + convertToString(exponent) + "\"";
-                }
-                if (multiplier != 1.0) {
-                    repr += " multiplier=\"" + convertToString(multiplier) + "\"";
-                }
-                if (!prefix.empty()) {
-                    repr += " prefix=\"" + prefix + "\"";
-                }
-                repr += " units=\"" + reference + "\"";
-                if (!id.empty()) {
-                    repr += " id=\"" + id + "\"";
-                } else if (autoIds) {
-                    repr += " id=\"" + makeUniqueId(idList) + "\"";
-                }
-                repr += "/>";
+        printId(units->id(), writer, idList, autoIds);
+        for (size_t i = 0; i < units->unitCount(); ++i) {
+            std::string reference;
+            std::string prefix;
+            std::string id;
+            double exponent;
+            double multiplier;
+            units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+            writer.startElement("unit");
+            if (exponent != 1.0) {
+                writer.addAttribute("exponent", convertToString(exponent));
             }
+            if (multiplier != 1.0) {
+                writer.addAttribute("multiplier", convertToString(multiplier));
+            }
+            if (!prefix.empty()) {
+                writer.addAttribute("prefix", prefix);
+            }
+            writer.addAttribute("units", reference);
+            printId(id, writer, idList, autoIds);
+            writer.endElement();
         }
-        if (endTag) {
-            repr += "</units>";
-        } else {
-            repr += "/>";
-        }
+        writer.endElement();
     }
-
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printComponent(const ComponentPtr &component, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printComponent(const ComponentPtr &component, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string repr;
     if (!component->isImport()) {
-        repr += "<component";
-        std::string componentName = component->name();
+        writer.startElement("component");
+        const std::string &componentName = component->name();
         if (!componentName.empty()) {
-            repr += " name=\"" + componentName + "\"";
+            writer.addAttribute("name", componentName);
         }
-        if (!component->id().empty()) {
-            repr += " id=\"" + component->id() + "\"";
-        } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
+        printId(component->id(), writer, idList, autoIds);
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            printVariable(component->variable(i), writer, idList, autoIds);
         }
-        size_t variableCount = component->variableCount();
-        size_t resetCount = component->resetCount();
-        bool hasChildren = false;
-        if (variableCount > 0 || resetCount > 0 || !component->math().empty()) {
-            hasChildren = true;
+        for (size_t i = 0; i < component->resetCount(); ++i) {
+            printReset(component->reset(i), writer, idList, autoIds);
         }
-        if (hasChildren) {
-            repr += ">";
-            for (size_t i = 0; i < variableCount; ++i) {
-                repr += printVariable(component->variable(i), idList, autoIds);
-            }
-            for (size_t i = 0; i < resetCount; ++i) {
-                repr += printReset(component->reset(i), idList, autoIds);
-            }
-            if (!component->math().empty()) {
-                repr += printMath(component->math());
-            }
-
-            repr += "</component>";
-        } else {
-            repr += "/>";
+        if (!component->math().empty()) {
+            writer.addMath(printMath(component->math()));
         }
+        writer.endElement();
     }
 
     // Traverse through children of this component and add them to the representation.
     for (size_t i = 0; i < component->componentCount(); ++i) {
-        repr += printComponent(component->component(i), idList, autoIds);
+        printComponent(component->component(i), writer, idList, autoIds);
     }
-
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printEncapsulation(const ComponentPtr &component, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printVariable(const VariablePtr &variable, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string componentName = component->name();
-    std::string repr = "<component_ref";
-    if (!componentName.empty()) {
-        repr += " component=\"" + componentName + "\"";
-    }
-    if (!component->encapsulationId().empty()) {
-        repr += " id=\"" + component->encapsulationId() + "\"";
-    } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
-    }
-    size_t componentCount = component->componentCount();
-    if (componentCount > 0) {
-        repr += ">";
-    } else {
-        repr += "/>";
-    }
-    for (size_t i = 0; i < componentCount; ++i) {
-        repr += printEncapsulation(component->component(i), idList, autoIds);
-    }
-    if (componentCount > 0) {
-        repr += "</component_ref>";
-    }
-    return repr;
-}
-
-std::string Printer::PrinterImpl::printVariable(const VariablePtr &variable, IdList &idList, bool autoIds)
-{
-    std::string repr;
-    repr += "<variable";
-    std::string name = variable->name();
-    std::string id = variable->id();
+    writer.startElement("variable");
+    const std::string &name = variable->name();
     std::string units = variable->units() != nullptr ? variable->units()->name() : "";
-    std::string intial_value = variable->initialValue();
-    std::string interface_type = variable->interfaceType();
+    const std::string &intial_value = variable->initialValue();
+    const std::string &interface_type = variable->interfaceType();
     if (!name.empty()) {
-        repr += " name=\"" + name + "\"";
+        writer.addAttribute("name", name);
     }
     if (!units.empty()) {
-        repr += " units=\"" + units + "\"";
+        writer.addAttribute("units", units);
     }
     if (!intial_value.empty()) {
-        repr += " initial_value=\"" + intial_value + "\"";
+        writer.addAttribute("initial_value", intial_value);
     }
     if (!interface_type.empty()) {
-        repr += " interface=\"" + interface_type + "\"";
-    }
-    if (!id.empty()) {
-        repr += " id=\"" + id + "\"";
-    } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
+        writer.addAttribute("interface", interface_type);
     }
-
-    repr += "/>";
-    return repr;
+    printId(variable->id(), writer, idList, autoIds);
+    writer.endElement();
 }
 
-std::string Printer::PrinterImpl::printResetChild(const std::string &childLabel, const std::string &childId,
-                                                  const std::string &math, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printResetChild(const std::string &childLabel, const std::string &childId,
+                                           const std::string &math, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string repr;
-
     if (!childId.empty() || !math.empty()) {
-        repr += "<" + childLabel;
-        if (!childId.empty()) {
-            repr += " id=\"" + childId + "\"";
-        } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
-        }
-        if (math.empty()) {
-            repr += "/>";
-        } else {
-            repr += ">" + printMath(math) + "</" + childLabel + ">";
+        writer.startElement(childLabel);
+        printId(childId, writer, idList, autoIds);
+        if (!math.empty()) {
+            writer.addMath(printMath(math));
         }
+        writer.endElement();
     }
-
-    return repr;
 }
 
-std::string Printer::PrinterImpl::printReset(const ResetPtr &reset, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printReset(const ResetPtr &reset, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string repr = "<reset";
-    std::string rid = reset->id();
-    std::string rvid = reset->resetValueId();
     VariablePtr variable = reset->variable();
     VariablePtr testVariable = reset->testVariable();
-    bool hasChild = false;
 
+    writer.startElement("reset");
     if (variable) {
-        repr += " variable=\"" + variable->name() + "\"";
+        writer.addAttribute("variable", variable->name());
     }
     if (testVariable) {
-        repr += " test_variable=\"" + testVariable->name() + "\"";
+        writer.addAttribute("test_variable", testVariable->name());
     }
     if (reset->isOrderSet()) {
-        repr += " order=\"" + convertToString(reset->order()) + "\"";
+        writer.addAttribute("order", convertToString(reset->order()));
     }
-    if (!rid.empty()) {
-        repr += " id=\"" + rid + "\"";
-    } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
-    }
-
-    std::string testValue = printResetChild("test_value", reset->testValueId(), reset->testValue(), idList, autoIds);
-    if (!testValue.empty()) {
-        repr += ">" + testValue;
-        hasChild = true;
-    }
-    std::string resetValue = printResetChild("reset_value", reset->resetValueId(), reset->resetValue(), idList, autoIds);
-    if (!resetValue.empty()) {
-        if (!hasChild) {
-            repr += ">";
-        }
-        repr += resetValue;
-        hasChild = true;
-    }
-    if (hasChild) {
-        repr += "</reset>";
-    } else {
-        repr += "/>";
-    }
-    return repr;
+    printId(reset->id(), writer, idList, autoIds);
+    printResetChild("test_value", reset->testValueId(), reset->testValue(), writer, idList, autoIds);
+    printResetChild("reset_value", reset->resetValueId(), reset->resetValue(), writer, idList, autoIds);
+    writer.endElement();
 }
 
-std::string Printer::PrinterImpl::printImports(const ModelPtr &model, IdList &idList, bool autoIds)
+void Printer::PrinterImpl::printImports(const ModelPtr &model, XmlWriter &writer, IdList &idList, bool autoIds)
 {
-    std::string repr;
-
     for (size_t i = 0; i < model->importSourceCount(); ++i) {
         auto importSource = model->importSource(i);
 
-        repr += "<import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"" + importSource->url() + "\"";
-        if (!importSource->id().empty()) {
-            repr += " id=\"" + importSource->id() + "\"";
-        } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\"";
-        }
-        repr += ">";
+        writer.startElement("import");
+        writer.addAttribute("xmlns:xlink", XLINK_NS);
+        writer.addAttribute("xlink:href", importSource->url());
+        printId(importSource->id(), writer, idList, autoIds);
 
         for (size_t c = 0; c < importSource->componentCount(); ++c) {
             auto component = importSource->component(c);
-            repr += "<component component_ref=\"" + component->importReference() + "\" name=\"" + component->name() + "\"";
-            if (!component->id().empty()) {
-                repr += " id=\"" + component->id() + "\"";
-            } else if (autoIds) {
-                repr += " id=\"" + makeUniqueId(idList) + "\"";
-            }
-            repr += "/>";
+            writer.startElement("component");
+            writer.addAttribute("component_ref", component->importReference());
+            writer.addAttribute("name", component->name());
+            printId(component->id(), writer, idList, autoIds);
+            writer.endElement();
         }
 
         for (size_t u = 0; u < importSource->unitsCount(); ++u) {
             auto units = importSource->units(u);
-            repr += "<units units_ref=\"" + units->importReference() + "\" name=\"" + units->name() + "\"";
-            if (!units->id().empty()) {
-                repr += " id=\"" + units->id() + "\"";
-            } else if (autoIds) {
-                repr += " id=\"" + makeUniqueId(idList) + "\"";
-            }
-            repr += "/>";
+            writer.startElement("units");
+            writer.addAttribute("units_ref", units->importReference());
+            writer.addAttribute("name", units->name());
+            printId(units->id(), writer, idList, autoIds);
+            writer.endElement();
         }
-        repr += "</import>";
-    }
 
-    return repr;
+        writer.endElement();
+    }
 }
 
 Printer::Printer()
@@ -454,50 +388,41 @@ PrinterPtr Printer::create() noexcept
     return std::shared_ptr<Printer> {new Printer {}};
 }
 
-std::string Printer::printModel(const ModelPtr &model, bool autoIds) const
+bool Printer::PrinterImpl::printModel(const ModelPtr &model, std::ostream &output, bool autoIds)
 {
-    if (model == nullptr) {
-        return "";
-    }
     // Automatic ids.
     IdList idList;
     if (autoIds) {
         idList = listIds(model);
     }
 
-    std::string repr;
-    repr += "<?xml version=\"1.0\" encoding=\"UTF-8\"?><model xmlns=\"http://www.cellml.org/cellml/2.0#\"";
-    if (!model->name().empty()) {
-        repr += " name=\"" + model->name() + "\"";
-    }
-    if (!model->id().empty()) {
-        repr += " id=\"" + model->id() + "\"";
-    } else if (autoIds) {
-        repr += " id=\"" + makeUniqueId(idList) + "\"";
-    }
+    // The model is written out, pretty-printed, as it is serialised. Only the
+    // user-supplied MathML gets parsed, so that its layout can be adjusted.
+    XmlWriter writer(output);
 
-    bool endTag = false;
-    if ((model->componentCount() > 0) || (model->unitsCount() > 0)) {
-        endTag = true;
-        repr += ">";
+    writer.startElement("model");
+    writer.addAttribute("xmlns", CELLML_2_0_NS);
+    if (!model->name().empty()) {
+        writer.addAttribute("name", model->name());
     }
+    printId(model->id(), writer, idList, autoIds);
 
     if (model->hasImports()) {
-        repr += mPimpl->printImports(model, idList, autoIds);
+        printImports(model, writer, idList, autoIds);
     }
 
     for (size_t i = 0; i < model->unitsCount(); ++i) {
-        repr += mPimpl->printUnits(model->units(i), idList, autoIds);
+        printUnits(model->units(i), writer, idList, autoIds);
     }
 
-    std::string componentEncapsulation;
+    std::vector<std::string> encapsulationIds;
     // Serialise components of the model, imported components have already been dealt with at this point,
     //  ... but their locally-defined children have not.
     for (size_t i = 0; i < model->componentCount(); ++i) {
         ComponentPtr component = model->component(i);
-        repr += mPimpl->printComponent(component, idList, autoIds);
+        printComponent(component, writer, idList, autoIds);
         if (component->componentCount() > 0) {
-            componentEncapsulation += mPimpl->printEncapsulation(component, idList, autoIds);
+            listEncapsulationIds(component, encapsulationIds, idList, autoIds);
         }
     }
 
@@ -506,34 +431,55 @@ std::string Printer::printModel(const ModelPtr &model, bool autoIds) const
     // Build unique variable equivalence pairs (ComponentMap, VariableMap) for connections.
     buildMaps(model, componentMap, variableMap);
     // Serialise connections of the model.
-    repr += printConnections(componentMap, variableMap, idList, autoIds);
-
-    if (!componentEncapsulation.empty()) {
-        repr += "<encapsulation";
-        if (!model->encapsulationId().empty()) {
-            repr += " id=\"" + model->encapsulationId() + "\">";
-        } else if (autoIds) {
-            repr += " id=\"" + makeUniqueId(idList) + "\">";
-        } else {
-            repr += ">";
+    printConnections(componentMap, variableMap, writer, idList, autoIds);
+
+    if (!encapsulationIds.empty()) {
+        writer.startElement("encapsulation");
+        printId(model->encapsulationId(), writer, idList, autoIds);
+        size_t idIndex = 0;
+        for (size_t i = 0; i < model->componentCount(); ++i) {
+            ComponentPtr component = model->component(i);
+            if (component->componentCount() > 0) {
+                printEncapsulation(component, writer, encapsulationIds, idIndex);
+            }
         }
-        repr += componentEncapsulation + "</encapsulation>";
+        writer.endElement();
     }
-    if (endTag) {
-        repr += "</model>";
-    } else {
-        repr += "/>";
+
+    writer.endElement();
+
+    return writer.finish();
+}
+
+std::string Printer::printModel(const ModelPtr &model, bool autoIds) const
+{
+    if (model == nullptr) {
+        return "";
+    }
+
+    std::ostringstream output;
+    if (!mPimpl->printModel(model, output, autoIds)) {
+        return "";
+    }
+    return output.str();
+}
+
+bool Printer::printModel(const ModelPtr &model, std::ostream &output, bool autoIds) const
+{
+    if (model == nullptr) {
+        return false;
+    }
+
+    return mPimpl->printModel(model, output, autoIds);
+}
+
+std::string Printer::printBinaryModel(const ModelPtr &model) const
+{
+    if (model == nullptr) {
+        return "";
     }
 
-    // Generate a pretty-print version of the model using libxml2.
-    // The xmlKeepBlanksDefault is turned off so that the pretty print can adjust
-    // the spacing in the user-supplied MathML.
-    // See http://www.xmlsoft.org/html/libxml-tree.html#xmlDocDumpFormatMemoryEnc
-    // for details.
-    XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
-    xmlKeepBlanksDefault(0);
-    xmlDoc->parse(repr);
-    return xmlDoc->prettyPrint();
+    return writeBinaryModel(model);
 }
 
 } // namespace libcellml
@@ -21,6 +21,8 @@ limitations under the License.
 
 #include "libcellml/variable.h"
 
+#include "utilities.h"
+
 namespace libcellml {
 
 /**
@@ -34,9 +36,9 @@ struct Reset::ResetImpl
     bool mOrderSet = false; /**< Whether the relative order of the reset has been set.*/
     VariablePtr mVariable; /**< The associated variable for the reset.*/
     VariablePtr mTestVariable; /**< The associated test_variable for the reset.*/
-    std::string mTestValue; /**< The MathML string for the test_value.*/
+    SharedString mTestValue; /**< The MathML string for the test_value.*/
     std::string mTestValueId; /**< The id of the test_value block */
-    std::string mResetValue; /**< The MathML string for the reset_value.*/
+    SharedString mResetValue; /**< The MathML string for the reset_value.*/
     std::string mResetValueId; /**< The id of the reset_value block */
 };
 
@@ -53,12 +55,24 @@ Reset::Reset(int order)
 
 ResetPtr Reset::create() noexcept
 {
-    return std::shared_ptr<Reset> {new Reset {}};
+    struct ResetInstance: public Reset
+    {
+    };
+
+    return std::make_shared<ResetInstance>();
 }
 
 ResetPtr Reset::create(int order) noexcept
 {
-    return std::shared_ptr<Reset> {new Reset {order}};
+    struct ResetInstance: public Reset
+    {
+        explicit ResetInstance(int order)
+            : Reset(order)
+        {
+        }
+    };
+
+    return std::make_shared<ResetInstance>(order);
 }
 
 Reset::~Reset()
@@ -112,9 +126,9 @@ void Reset::appendTestValue(const std::string &math)
     mPimpl->mTestValue.append(math);
 }
 
-std::string Reset::testValue() const
+const std::string &Reset::testValue() const
 {
-    return mPimpl->mTestValue;
+    return mPimpl->mTestValue.value();
 }
 
 void Reset::setTestValueId(const std::string &id)
@@ -127,19 +141,24 @@ void Reset::removeTestValueId()
     mPimpl->mTestValueId = "";
 }
 
-std::string Reset::testValueId() const
+const std::string &Reset::testValueId() const
 {
     return mPimpl->mTestValueId;
 }
 
 void Reset::setTestValue(const std::string &math)
 {
-    mPimpl->mTestValue = math;
+    mPimpl->mTestValue.set(math);
+}
+
+void Reset::setTestValue(std::string &&math)
+{
+    mPimpl->mTestValue.set(std::move(math));
 }
 
 void Reset::removeTestValue()
 {
-    mPimpl->mTestValue = "";
+    mPimpl->mTestValue.clear();
 }
 
 void Reset::appendResetValue(const std::string &math)
@@ -147,19 +166,24 @@ void Reset::appendResetValue(const std::string &math)
     mPimpl->mResetValue.append(math);
 }
 
-std::string Reset::resetValue() const
+const std::string &Reset::resetValue() const
 {
-    return mPimpl->mResetValue;
+    return mPimpl->mResetValue.value();
 }
 
 void Reset::setResetValue(const std::string &math)
 {
-    mPimpl->mResetValue = math;
+    mPimpl->mResetValue.set(math);
+}
+
+void Reset::setResetValue(std::string &&math)
+{
+    mPimpl->mResetValue.set(std::move(math));
 }
 
 void Reset::removeResetValue()
 {
-    mPimpl->mResetValue = "";
+    mPimpl->mResetValue.clear();
 }
 
 void Reset::setResetValueId(const std::string &id)
@@ -172,7 +196,7 @@ void Reset::removeResetValueId()
     mPimpl->mResetValueId = "";
 }
 
-std::string Reset::resetValueId() const
+const std::string &Reset::resetValueId() const
 {
     return mPimpl->mResetValueId;
 }
@@ -183,9 +207,9 @@ ResetPtr Reset::clone() const
 
     r->setId(id());
     r->setOrder(order());
-    r->setResetValue(resetValue());
+    r->mPimpl->mResetValue = mPimpl->mResetValue;
     r->setResetValueId(resetValueId());
-    r->setTestValue(testValue());
+    r->mPimpl->mTestValue = mPimpl->mTestValue;
     r->setTestValueId(testValueId());
     if (mPimpl->mVariable != nullptr) {
         r->setVariable(mPimpl->mVariable->clone());
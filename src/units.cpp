@@ -235,12 +235,24 @@ Units::~Units()
 
 UnitsPtr Units::create() noexcept
 {
-    return std::shared_ptr<Units> {new Units {}};
+    struct UnitsInstance: public Units
+    {
+    };
+
+    return std::make_shared<UnitsInstance>();
 }
 
 UnitsPtr Units::create(const std::string &name) noexcept
 {
-    return std::shared_ptr<Units> {new Units {name}};
+    struct UnitsInstance: public Units
+    {
+        explicit UnitsInstance(const std::string &name)
+            : Units(name)
+        {
+        }
+    };
+
+    return std::make_shared<UnitsInstance>(name);
 }
 
 bool Units::isBaseUnit() const
@@ -568,6 +580,29 @@ UnitsMap createUnitsMap(const UnitsPtr &units, bool &isValid)
     return unitsMap;
 }
 
+std::string unitsDefinitionKey(const UnitsPtr &units)
+{
+    if (units->isImport() || units->requiresImports()) {
+        return "";
+    }
+
+    bool isValid;
+    auto unitsMap = createUnitsMap(units, isValid);
+    double multiplier = 0.0;
+    if (!isValid || !updateUnitMultiplier(units, 1, multiplier)) {
+        return "";
+    }
+
+    std::string key;
+    for (const auto &unit : unitsMap) {
+        key += unit.first + "^" + convertToString(unit.second) + " ";
+    }
+
+    // The multiplier is a power of ten, round it to absorb the error from
+    // adding up its different contributions.
+    return key + "10^" + convertToString(std::round(multiplier * 1.0e9) / 1.0e9 + 0.0);
+}
+
 bool Units::requiresImports() const
 {
     // Function to check child unit dependencies for imports.
@@ -653,15 +688,7 @@ UnitsPtr Units::clone() const
 
     units->setImportReference(importReference());
 
-    std::string reference;
-    std::string prefix;
-    std::string id;
-    double exponent;
-    double multiplier;
-    for (size_t index = 0; index < mPimpl->mUnits.size(); ++index) {
-        unitAttributes(index, reference, prefix, exponent, multiplier, id);
-        units->addUnit(reference, prefix, exponent, multiplier, id);
-    }
+    units->mPimpl->mUnits = mPimpl->mUnits;
 
     return units;
 }
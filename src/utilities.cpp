@@ -23,6 +23,7 @@ limitations under the License.
 #include <limits>
 #include <set>
 #include <sstream>
+#include <unordered_set>
 #include <vector>
 
 #include "libcellml/component.h"
@@ -459,6 +460,70 @@ bool areEquivalentVariables(const VariablePtr &variable1,
     return (variable1 == variable2) || variable1->hasEquivalentVariable(variable2, true);
 }
 
+void IndexRevision::invalidate()
+{
+    mRevision.store(0, std::memory_order_relaxed);
+}
+
+bool IndexRevision::isCurrent(size_t revision) const
+{
+    return mRevision.load(std::memory_order_acquire) == revision + 1;
+}
+
+void NameIndex::invalidate()
+{
+    mRevision.invalidate();
+}
+
+void NameIndex::add(const std::string &name, size_t position)
+{
+    if (mRevision.isCurrent(*mOwnerNameRevision)) {
+        mPositions.emplace(name, position);
+    }
+}
+
+const std::string &SharedString::value() const
+{
+    static const std::string EMPTY_STRING;
+
+    return (mString != nullptr) ? *mString : EMPTY_STRING;
+}
+
+void SharedString::set(const std::string &value)
+{
+    mString = value.empty() ? nullptr : std::make_shared<std::string>(value);
+}
+
+void SharedString::set(std::string &&value)
+{
+    mString = value.empty() ? nullptr : std::make_shared<std::string>(std::move(value));
+}
+
+void SharedString::append(const std::string &value)
+{
+    if (value.empty()) {
+        return;
+    }
+
+    if (mString == nullptr) {
+        mString = std::make_shared<std::string>(value);
+    } else if (mString.use_count() > 1) {
+        auto string = std::make_shared<std::string>();
+
+        string->reserve(mString->size() + value.size());
+        string->append(*mString).append(value);
+
+        mString = string;
+    } else {
+        mString->append(value);
+    }
+}
+
+void SharedString::clear()
+{
+    mString = nullptr;
+}
+
 bool isEntityChildOf(const EntityPtr &entity1, const EntityPtr &entity2)
 {
     return entity1->parent() == entity2;
@@ -556,7 +621,6 @@ void findAllVariablesWithEquivalences(const ComponentPtr &component, VariablePtr
 NameList findCnUnitsNames(const XmlNodePtr &node);
 NameList findComponentCnUnitsNames(const ComponentPtr &component);
 void findAndReplaceCnUnitsNames(const XmlNodePtr &node, const StringStringMap &replaceMap);
-void findAndReplaceComponentCnUnitsNames(const ComponentPtr &component, const StringStringMap &replaceMap);
 size_t getComponentIndexInComponentEntity(const ComponentEntityPtr &componentParent, const ComponentEntityPtr &component);
 IndexStack reverseEngineerIndexStack(const VariablePtr &variable);
 VariablePtr getVariableLocatedAt(const IndexStack &stack, const ModelPtr &model);
@@ -588,7 +652,7 @@ NameList findComponentCnUnitsNames(const ComponentPtr &component)
 {
     NameList names;
     // Inspect the MathML in this component for any specified constant <cn> units.
-    std::string mathContent = component->math();
+    const std::string &mathContent = component->math();
     if (mathContent.empty()) {
         return names;
     }
@@ -622,7 +686,7 @@ void findAndReplaceCnUnitsNames(const XmlNodePtr &node, const StringStringMap &r
 
 void findAndReplaceComponentCnUnitsNames(const ComponentPtr &component, const StringStringMap &replaceMap)
 {
-    std::string mathContent = component->math();
+    const std::string &mathContent = component->math();
     if (mathContent.empty()) {
         return;
     }
@@ -1065,15 +1129,16 @@ ConnectionMap createConnectionMap(const VariablePtr &variable1, const VariablePt
     return map;
 }
 
-void recursiveEquivalentVariables(const VariablePtr &variable, std::vector<VariablePtr> &equivalentVariables)
+void recursiveEquivalentVariables(const VariablePtr &variable, std::vector<VariablePtr> &equivalentVariables,
+                                  std::unordered_set<const Variable *> &visitedVariables)
 {
     for (size_t i = 0; i < variable->equivalentVariableCount(); ++i) {
         VariablePtr equivalentVariable = variable->equivalentVariable(i);
 
-        if (std::find(equivalentVariables.begin(), equivalentVariables.end(), equivalentVariable) == equivalentVariables.end()) {
+        if (visitedVariables.insert(equivalentVariable.get()).second) {
             equivalentVariables.push_back(equivalentVariable);
 
-            recursiveEquivalentVariables(equivalentVariable, equivalentVariables);
+            recursiveEquivalentVariables(equivalentVariable, equivalentVariables, visitedVariables);
         }
     }
 }
@@ -1081,8 +1146,9 @@ void recursiveEquivalentVariables(const VariablePtr &variable, std::vector<Varia
 std::vector<VariablePtr> equivalentVariables(const VariablePtr &variable)
 {
     std::vector<VariablePtr> res = {variable};
+    std::unordered_set<const Variable *> visitedVariables = {variable.get()};
 
-    recursiveEquivalentVariables(variable, res);
+    recursiveEquivalentVariables(variable, res, visitedVariables);
 
     return res;
 }
@@ -1158,13 +1224,4 @@ bool areComponentVariableUnitsUnlinked(const ComponentPtr &component)
     return unlinked;
 }
 
-std::string replace(std::string string, const std::string &from, const std::string &to)
-{
-    auto index = string.find(from);
-
-    return (index == std::string::npos) ?
-               string :
-               string.replace(index, from.length(), to);
-}
-
 } // namespace libcellml
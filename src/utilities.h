@@ -17,9 +17,13 @@ limitations under the License.
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "libcellml/types.h"
@@ -403,6 +407,23 @@ bool isStandardUnitName(const std::string &name);
  */
 bool isStandardUnit(const UnitsPtr &units);
 
+/**
+ * @brief Get a key identifying the definition of the given @p units.
+ *
+ * Get a key made of the base units that the given @p units reduce to, and of
+ * their multiplier. Equivalent units, as defined by @ref Units::equivalent,
+ * normally get the same key, so the key can be used to quickly look for
+ * candidate equivalent units. It does not replace @ref Units::equivalent,
+ * though, since rounding may give two units the same key and yet make them
+ * not equivalent. The key is empty if @p units cannot be reduced, e.g. because
+ * they are, or rely on, imported units.
+ *
+ * @param units The @c Units to get the key for.
+ *
+ * @return The key of the definition of @p units.
+ */
+std::string unitsDefinitionKey(const UnitsPtr &units);
+
 /**
  * @brief Check if the provided @p name is a standard prefix.
  *
@@ -447,6 +468,194 @@ size_t getVariableIndexInComponent(const ComponentPtr &component, const Variable
 bool areEquivalentVariables(const VariablePtr &variable1,
                             const VariablePtr &variable2);
 
+/**
+ * @brief The IndexRevision struct.
+ *
+ * The revision of the data for which an index was built. An index is only
+ * (re)built when it is used for a revision other than the one for which it was
+ * last built. Since data is not modified while it is being read from several
+ * threads, all the threads see the same revision, so once an index has been
+ * (re)built it can be read without locking. Only (re)building an index is
+ * serialised.
+ */
+struct IndexRevision
+{
+    std::atomic<size_t> mRevision {0}; /**< The revision for which the index was built, plus one, or zero if the index is invalid. */
+    std::mutex mMutex; /**< The mutex used to serialise the (re)building of the index. */
+
+    /**
+     * @brief Invalidate the index.
+     *
+     * Invalidate the index, so that it gets rebuilt the next time it is used.
+     */
+    void invalidate();
+
+    /**
+     * @brief Test whether the index is current.
+     *
+     * Test whether the index was built for the given revision.
+     *
+     * @param revision The revision of the data.
+     *
+     * @return @c true if the index was built for @p revision, @c false
+     * otherwise.
+     */
+    bool isCurrent(size_t revision) const;
+
+    /**
+     * @brief Make sure that the index is current.
+     *
+     * Make sure that the index was built for the given revision, calling
+     * @p build to (re)build it if it was not.
+     *
+     * @param revision The revision of the data.
+     * @param build The function that (re)builds the index.
+     */
+    template<typename F>
+    void update(size_t revision, F build)
+    {
+        if (isCurrent(revision)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mRevision.load(std::memory_order_relaxed) != revision + 1) {
+            build();
+
+            mRevision.store(revision + 1, std::memory_order_release);
+        }
+    }
+};
+
+/**
+ * @brief The NameIndex struct.
+ *
+ * An index of the position of named entities in a vector, based on their
+ * name. Like a linear search, the index gives the position of the first entity
+ * with a given name. The index is rebuilt lazily, i.e. the first time it is
+ * used after it was invalidated or after an entity was renamed (see
+ * @ref IndexRevision).
+ *
+ * The entities are the children of an owner, whose revision of the names of
+ * its children tells the index whether one of them was renamed.
+ */
+struct NameIndex
+{
+    std::unordered_map<std::string, size_t> mPositions; /**< The position of the first entity with a given name. */
+    const size_t *mOwnerNameRevision = nullptr; /**< The revision of the names of the children of the owner. */
+    IndexRevision mRevision; /**< The revision of the names of the children of the owner for which the index was built. */
+
+    /**
+     * @brief Invalidate the index.
+     *
+     * Invalidate the index. This must be called every time an entity is
+     * inserted in or removed from the vector, unless it is appended to it, in
+     * which case @ref add can be used instead.
+     */
+    void invalidate();
+
+    /**
+     * @brief Add an entity that was appended to the vector.
+     *
+     * Add an entity that was appended to the vector, keeping the index valid
+     * if it currently is.
+     *
+     * @param name The name of the entity.
+     * @param position The position of the entity in the vector.
+     */
+    void add(const std::string &name, size_t position);
+
+    /**
+     * @brief Find the first entity with the given name.
+     *
+     * Find the first entity with the given name in the given vector, which is
+     * the one that this index is for.
+     *
+     * @param entities The vector of entities.
+     * @param name The name of the entity to find.
+     *
+     * @return An iterator to the entity or @c entities.end() if no entity with
+     * the given name could be found.
+     */
+    template<typename T>
+    typename std::vector<T>::iterator find(std::vector<T> &entities, const std::string &name)
+    {
+        mRevision.update(*mOwnerNameRevision, [&]() {
+            mPositions.clear();
+
+            for (size_t i = 0; i < entities.size(); ++i) {
+                mPositions.emplace(entities[i]->name(), i);
+            }
+        });
+
+        auto position = mPositions.find(name);
+
+        return (position != mPositions.end()) ?
+                   entities.begin() + int64_t(position->second) :
+                   entities.end();
+    }
+};
+
+/**
+ * @brief The SharedString struct.
+ *
+ * A string that is shared between copies of it until one of them is modified,
+ * at which point the modified copy gets its own string. This is used for
+ * MathML strings, which can be large, so that cloning an entity does not
+ * duplicate them unless either the original or the clone changes them.
+ */
+struct SharedString
+{
+    std::shared_ptr<std::string> mString; /**< The (possibly shared) string, or @c nullptr if empty. */
+
+    /**
+     * @brief Get the value of the string.
+     *
+     * Get the value of the string.
+     *
+     * @return The value of the string.
+     */
+    const std::string &value() const;
+
+    /**
+     * @brief Set the value of the string.
+     *
+     * Set the value of the string, without affecting any copy that shares it.
+     *
+     * @param value The new value of the string.
+     */
+    void set(const std::string &value);
+
+    /**
+     * @overload
+     *
+     * @brief Set the value of the string.
+     *
+     * Set the value of the string, moving @p value rather than copying it.
+     *
+     * @param value The new value of the string.
+     */
+    void set(std::string &&value);
+
+    /**
+     * @brief Append to the string.
+     *
+     * Append @p value to the string, without affecting any copy that shares
+     * it.
+     *
+     * @param value The value to append to the string.
+     */
+    void append(const std::string &value);
+
+    /**
+     * @brief Clear the string.
+     *
+     * Clear the string, without affecting any copy that shares it.
+     */
+    void clear();
+};
+
 /**
  * @brief Test to determine if @p entity1 is a child of @p entity2.
  *
@@ -634,8 +843,8 @@ IndexStack reverseEngineerIndexStack(const ComponentPtr &component);
 EquivalenceMap rebaseEquivalenceMap(const EquivalenceMap &map, const IndexStack &originStack, const IndexStack &destinationStack);
 std::vector<UnitsPtr> unitsUsed(const ModelPtr &model, const ComponentPtr &component);
 ComponentNameMap createComponentNamesMap(const ComponentPtr &component);
+void findAndReplaceComponentCnUnitsNames(const ComponentPtr &component, const StringStringMap &replaceMap);
 void findAndReplaceComponentsCnUnitsNames(const ComponentPtr &component, const StringStringMap &replaceMap);
-std::string replace(std::string string, const std::string &from, const std::string &to);
 
 /**
  * @brief Create a connection map for the given variables.
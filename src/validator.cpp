@@ -449,12 +449,12 @@ void Validator::validateModel(const ModelPtr &model)
             std::vector<std::string> unitsImportSources;
             for (size_t i = 0; i < model->unitsCount(); ++i) {
                 UnitsPtr units = model->units(i);
-                std::string unitsName = units->name();
+                const std::string &unitsName = units->name();
                 if (!unitsName.empty()) {
                     if (units->isImport()) {
                         // Check for a units_ref.
-                        std::string unitsRef = units->importReference();
-                        std::string importSource = units->importSource()->url();
+                        const std::string &unitsRef = units->importReference();
+                        const std::string &importSource = units->importSource()->url();
                         bool foundImportIssue = false;
                         if (!isCellmlIdentifier(unitsRef)) {
                             auto issue = makeIssueIllegalIdentifier(unitsRef);
@@ -574,9 +574,9 @@ void Validator::ValidatorImpl::validateImportedComponent(const ComponentPtr &com
     }
 
     // Check for a component_ref; assumes imported if the import source is not null.
-    std::string componentRef = component->importReference();
-    std::string importSource = component->importSource()->url();
-    std::string componentName = component->name();
+    const std::string &componentRef = component->importReference();
+    const std::string &importSource = component->importSource()->url();
+    const std::string &componentName = component->name();
 
     if (!isCellmlIdentifier(componentRef)) {
         auto issue = makeIssueIllegalIdentifier(componentRef);
@@ -622,7 +622,7 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component)
         // Check for duplicate variable names and construct vector of valid names in case
         // we have a variable initial_value set by reference.
         for (size_t i = 0; i < component->variableCount(); ++i) {
-            std::string variableName = component->variable(i)->name();
+            const std::string &variableName = component->variable(i)->name();
             if (!variableName.empty()) {
                 if (std::find(variableNames.begin(), variableNames.end(), variableName) != variableNames.end()) {
                     IssuePtr issue = Issue::create();
@@ -750,7 +750,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
         issue->setReferenceRule(Issue::ReferenceRule::VARIABLE_UNITS);
         mValidator->addIssue(issue);
     } else {
-        std::string unitsName = variable->units()->name();
+        const std::string &unitsName = variable->units()->name();
         if (!isCellmlIdentifier(unitsName)) {
             auto issue = makeIssueIllegalIdentifier(unitsName);
             issue->setDescription("Variable '" + variable->name() + "' in component '" + owningComponent(variable)->name() + "' does not have a valid units attribute. The attribute given is '" + unitsName + "'. " + issue->description());
@@ -771,7 +771,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
     }
     // Check for a valid interface attribute.
     if (!variable->interfaceType().empty()) {
-        std::string interfaceType = variable->interfaceType();
+        const std::string &interfaceType = variable->interfaceType();
         if ((interfaceType != "public") && (interfaceType != "private") && (interfaceType != "none") && (interfaceType != "public_and_private")) {
             IssuePtr issue = Issue::create();
             issue->setDescription("Variable '" + variable->name() + "' in component '" + owningComponent(variable)->name() + "' has an invalid interface attribute value '" + interfaceType + "'.");
@@ -782,7 +782,7 @@ void Validator::ValidatorImpl::validateVariable(const VariablePtr &variable, con
     }
     // Check for a valid initial value attribute.
     if (!variable->initialValue().empty()) {
-        std::string initialValue = variable->initialValue();
+        const std::string &initialValue = variable->initialValue();
         // Check if initial value is a variable reference
         if (!(std::find(variableNames.begin(), variableNames.end(), initialValue) != variableNames.end())) {
             // Otherwise, check that the initial value can be converted to a double
@@ -944,7 +944,7 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         XmlNodePtr nodeCopy = node;
         std::vector<std::string> variableNames;
         for (size_t i = 0; i < component->variableCount(); ++i) {
-            std::string variableName = component->variable(i)->name();
+            const std::string &variableName = component->variable(i)->name();
             if (std::find(variableNames.begin(), variableNames.end(), variableName) == variableNames.end()) {
                 variableNames.push_back(variableName);
             }
@@ -1158,7 +1158,7 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
 {
     Variable::InterfaceType interfaceType = determineInterfaceType(variable);
     auto component = owningComponent(variable);
-    std::string componentName = component->name();
+    const std::string &componentName = component->name();
     if (interfaceType == Variable::InterfaceType::NONE) {
         for (size_t index = 0; index < variable->equivalentVariableCount(); ++index) {
             const auto equivalentVariable = variable->equivalentVariable(index);
@@ -1171,7 +1171,7 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
                 if (it == alreadyReported.end()) {
                     VariablePairPtr pair = VariablePair::create(variable, equivalentVariable);
                     alreadyReported.push_back(pair);
-                    std::string equivalentComponentName = equivalentComponent->name();
+                    const std::string &equivalentComponentName = equivalentComponent->name();
 
                     IssuePtr err = Issue::create();
                     err->setDescription("The equivalence between '" + variable->name() + "' in component '" + componentName + "'  and '" + equivalentVariable->name() + "' in component '" + equivalentComponentName + "' is invalid. Component '" + componentName + "' and '" + equivalentComponentName + "' are neither siblings nor in a parent/child relationship.");
@@ -1182,7 +1182,7 @@ void Validator::ValidatorImpl::validateVariableInterface(const VariablePtr &vari
             }
         }
     } else {
-        auto interfaceTypeString = variable->interfaceType();
+        const std::string &interfaceTypeString = variable->interfaceType();
         if (!interfaceTypeIsCompatible(interfaceType, interfaceTypeString)) {
             IssuePtr err = Issue::create();
             if (interfaceTypeString.empty()) {
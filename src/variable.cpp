@@ -18,13 +18,13 @@ limitations under the License.
 
 #include <algorithm>
 #include <cassert>
-#include <map>
 #include <sstream>
 #include <vector>
 
 #include "libcellml/model.h"
 #include "libcellml/units.h"
 
+#include "namedentity_p.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -38,20 +38,37 @@ using VariableWeakPtr = std::weak_ptr<Variable>; /**< Type definition for weak v
  */
 struct Variable::VariableImpl
 {
+    /**
+     * @brief The Equivalence struct.
+     *
+     * An equivalence between this variable and another one, along with the
+     * mapping and connection ids of that equivalence.
+     */
+    struct Equivalence
+    {
+        VariableWeakPtr mVariable; /**< The equivalent variable.*/
+        const Variable *mRawVariable = nullptr; /**< The address of the equivalent variable, for fast comparison.*/
+        std::string mMappingId; /**< The mapping id of the equivalence.*/
+        std::string mConnectionId; /**< The connection id of the equivalence.*/
+    };
+
     Variable *mVariable = nullptr;
-    std::vector<VariableWeakPtr> mEquivalentVariables; /**< Equivalent variables for this Variable.*/
-    std::map<VariableWeakPtr, std::string, std::owner_less<VariableWeakPtr>> mMappingIdMap; /**< Mapping id map for equivalent variable.*/
-    std::map<VariableWeakPtr, std::string, std::owner_less<VariableWeakPtr>> mConnectionIdMap; /**< Connection id map for equivalent variable.*/
+    std::vector<Equivalence> mEquivalences; /**< Equivalences for this Variable, stored contiguously.*/
+    std::vector<Equivalence> mIndirectEquivalences; /**< Ids of the equivalences with variables that are only indirectly equivalent to this Variable.*/
     std::string mInitialValue; /**< Initial value for this Variable.*/
     std::string mInterfaceType; /**< Interface type for this Variable.*/
     UnitsPtr mUnits = nullptr; /**< The Units defined for this Variable.*/
 
     /**
-     * @brief Clean expired equivalent variables.
+     * @brief Remove an equivalent variable that is being destroyed.
      *
-     * Clean away any equivalent variables that have become expired.
+     * Remove the given variable, which is being destroyed, from the set of
+     * equivalent variables for this variable. This means that the set never
+     * contains expired variables, so it can be read without being cleaned.
+     *
+     * @param variable The variable that is being destroyed.
      */
-    void cleanExpiredVariables();
+    void removeDestroyedVariable(const Variable *variable);
 
     /**
      * @brief Private function to add an equivalent variable to the set for this variable.
@@ -169,20 +186,68 @@ struct Variable::VariableImpl
      */
     std::string equivalentConnectionId(const VariablePtr &equivalentVariable) const;
 
-    std::vector<VariableWeakPtr>::iterator findEquivalentVariable(const VariablePtr &equivalentVariable);
-    std::vector<VariableWeakPtr>::const_iterator findEquivalentVariable(const VariablePtr &equivalentVariable) const;
+    std::vector<Equivalence>::iterator findEquivalentVariable(const VariablePtr &equivalentVariable);
+    std::vector<Equivalence>::const_iterator findEquivalentVariable(const VariablePtr &equivalentVariable) const;
+
+    /**
+     * @brief Get the equivalence with the given variable.
+     *
+     * Get the equivalence with the given variable, be it direct or indirect.
+     * The ids of an indirect equivalence are kept in a side table, to which
+     * an equivalence is added if @p create is @c true and it is not already
+     * there.
+     *
+     * @param equivalentVariable The variable this variable is equivalent to.
+     * @param create Whether to add an indirect equivalence if none is found.
+     *
+     * @return The equivalence with the given variable if found or created,
+     * @c nullptr otherwise.
+     */
+    Equivalence *equivalence(const VariablePtr &equivalentVariable, bool create);
+    const Equivalence *equivalence(const VariablePtr &equivalentVariable) const;
 };
 
-std::vector<VariableWeakPtr>::const_iterator Variable::VariableImpl::findEquivalentVariable(const VariablePtr &equivalentVariable) const
+// Note: we compare addresses rather than lock weak pointers, but we also check
+//       that an equivalent variable has not expired since another variable
+//       could have been allocated at the same address.
+
+std::vector<Variable::VariableImpl::Equivalence>::const_iterator Variable::VariableImpl::findEquivalentVariable(const VariablePtr &equivalentVariable) const
 {
-    return std::find_if(mEquivalentVariables.begin(), mEquivalentVariables.end(),
-                        [=](const VariableWeakPtr &variableWeak) -> bool { return equivalentVariable == variableWeak.lock(); });
+    return std::find_if(mEquivalences.begin(), mEquivalences.end(),
+                        [=](const Equivalence &equivalence) -> bool { return (equivalentVariable.get() == equivalence.mRawVariable) && !equivalence.mVariable.expired(); });
 }
 
-std::vector<VariableWeakPtr>::iterator Variable::VariableImpl::findEquivalentVariable(const VariablePtr &equivalentVariable)
+std::vector<Variable::VariableImpl::Equivalence>::iterator Variable::VariableImpl::findEquivalentVariable(const VariablePtr &equivalentVariable)
 {
-    return std::find_if(mEquivalentVariables.begin(), mEquivalentVariables.end(),
-                        [=](const VariableWeakPtr &variableWeak) -> bool { return equivalentVariable == variableWeak.lock(); });
+    return std::find_if(mEquivalences.begin(), mEquivalences.end(),
+                        [=](const Equivalence &equivalence) -> bool { return (equivalentVariable.get() == equivalence.mRawVariable) && !equivalence.mVariable.expired(); });
+}
+
+const Variable::VariableImpl::Equivalence *Variable::VariableImpl::equivalence(const VariablePtr &equivalentVariable) const
+{
+    auto result = findEquivalentVariable(equivalentVariable);
+    if (result != mEquivalences.end()) {
+        return &*result;
+    }
+
+    result = std::find_if(mIndirectEquivalences.begin(), mIndirectEquivalences.end(),
+                          [=](const Equivalence &equivalence) -> bool { return (equivalentVariable.get() == equivalence.mRawVariable) && !equivalence.mVariable.expired(); });
+
+    return (result != mIndirectEquivalences.end()) ? &*result : nullptr;
+}
+
+Variable::VariableImpl::Equivalence *Variable::VariableImpl::equivalence(const VariablePtr &equivalentVariable, bool create)
+{
+    auto res = const_cast<Equivalence *>(static_cast<const VariableImpl *>(this)->equivalence(equivalentVariable));
+
+    if ((res == nullptr) && create) {
+        mIndirectEquivalences.erase(std::remove_if(mIndirectEquivalences.begin(), mIndirectEquivalences.end(), [](const Equivalence &equivalence) -> bool { return equivalence.mVariable.expired(); }), mIndirectEquivalences.end());
+        mIndirectEquivalences.push_back({equivalentVariable, equivalentVariable.get(), "", ""});
+
+        res = &mIndirectEquivalences.back();
+    }
+
+    return res;
 }
 
 Variable::Variable()
@@ -200,17 +265,40 @@ Variable::Variable(const std::string &name)
 
 Variable::~Variable()
 {
+    // Remove ourselves from the variables to which we are equivalent.
+
+    for (const auto &equivalence : mPimpl->mEquivalences) {
+        auto variable = equivalence.mVariable.lock();
+
+        if (variable != nullptr) {
+            variable->mPimpl->removeDestroyedVariable(this);
+            updateEquivalenceRevision(variable.get());
+        }
+    }
+
     delete mPimpl;
 }
 
 VariablePtr Variable::create() noexcept
 {
-    return std::shared_ptr<Variable> {new Variable {}};
+    struct VariableInstance: public Variable
+    {
+    };
+
+    return std::make_shared<VariableInstance>();
 }
 
 VariablePtr Variable::create(const std::string &name) noexcept
 {
-    return std::shared_ptr<Variable> {new Variable {name}};
+    struct VariableInstance: public Variable
+    {
+        explicit VariableInstance(const std::string &name)
+            : Variable(name)
+        {
+        }
+    };
+
+    return std::make_shared<VariableInstance>(name);
 }
 
 bool Variable::addEquivalence(const VariablePtr &variable1, const VariablePtr &variable2)
@@ -249,29 +337,31 @@ bool Variable::removeEquivalence(const VariablePtr &variable1, const VariablePtr
 void Variable::removeAllEquivalences()
 {
     auto thisVariable = shared_from_this();
-    for (const auto &variable : mPimpl->mEquivalentVariables) {
-        if (!variable.expired()) {
-            variable.lock()->mPimpl->unsetEquivalentTo(thisVariable);
+    for (const auto &equivalence : mPimpl->mEquivalences) {
+        auto variable = equivalence.mVariable.lock();
+        if (variable != nullptr) {
+            variable->mPimpl->unsetEquivalentTo(thisVariable);
         }
     }
-    mPimpl->mEquivalentVariables.clear();
+    mPimpl->mEquivalences.clear();
 }
 
 VariablePtr Variable::equivalentVariable(size_t index) const
 {
-    VariablePtr equivalentVariable = nullptr;
-    if (index < mPimpl->mEquivalentVariables.size()) {
-        VariableWeakPtr weakEquivalentVariable = mPimpl->mEquivalentVariables.at(index);
-        equivalentVariable = weakEquivalentVariable.lock();
+    // A variable removes itself from the variables to which it is equivalent
+    // when it is destroyed, so our equivalences never refer to a variable
+    // that no longer exists and reading them never modifies them.
+
+    if (index < mPimpl->mEquivalences.size()) {
+        return mPimpl->mEquivalences[index].mVariable.lock();
     }
 
-    return equivalentVariable;
+    return nullptr;
 }
 
 size_t Variable::equivalentVariableCount() const
 {
-    mPimpl->cleanExpiredVariables();
-    return mPimpl->mEquivalentVariables.size();
+    return mPimpl->mEquivalences.size();
 }
 
 bool Variable::hasEquivalentVariable(const VariablePtr &equivalentVariable, bool considerIndirectEquivalences) const
@@ -279,9 +369,9 @@ bool Variable::hasEquivalentVariable(const VariablePtr &equivalentVariable, bool
     return mPimpl->hasEquivalentVariable(equivalentVariable, considerIndirectEquivalences);
 }
 
-void Variable::VariableImpl::cleanExpiredVariables()
+void Variable::VariableImpl::removeDestroyedVariable(const Variable *variable)
 {
-    mEquivalentVariables.erase(std::remove_if(mEquivalentVariables.begin(), mEquivalentVariables.end(), [=](const VariableWeakPtr &variableWeak) -> bool { return variableWeak.expired(); }), mEquivalentVariables.end());
+    mEquivalences.erase(std::remove_if(mEquivalences.begin(), mEquivalences.end(), [=](const Equivalence &equivalence) -> bool { return equivalence.mRawVariable == variable; }), mEquivalences.end());
 }
 
 bool Variable::VariableImpl::hasEquivalentVariable(const VariablePtr &equivalentVariable, bool considerIndirectEquivalences) const
@@ -290,11 +380,7 @@ bool Variable::VariableImpl::hasEquivalentVariable(const VariablePtr &equivalent
     if (considerIndirectEquivalences) {
         equivalent = hasIndirectEquivalentVariable(equivalentVariable);
     } else {
-        auto it = findEquivalentVariable(equivalentVariable);
-        if (it == mEquivalentVariables.end()) {
-            return false;
-        }
-        equivalent = !it->expired();
+        equivalent = findEquivalentVariable(equivalentVariable) != mEquivalences.end();
     }
 
     return equivalent;
@@ -351,10 +437,24 @@ bool Variable::VariableImpl::hasIndirectEquivalentVariable(const VariablePtr &eq
 
 bool Variable::VariableImpl::setEquivalentTo(const VariablePtr &equivalentVariable)
 {
-    cleanExpiredVariables();
     if (!hasEquivalentVariable(equivalentVariable)) {
-        VariableWeakPtr weakEquivalentVariable = equivalentVariable;
-        mEquivalentVariables.push_back(weakEquivalentVariable);
+        // Keep the ids that were set while the two variables were only
+        // indirectly equivalent.
+
+        auto result = std::find_if(mIndirectEquivalences.begin(), mIndirectEquivalences.end(),
+                                   [=](const Equivalence &equivalence) -> bool { return equivalentVariable.get() == equivalence.mRawVariable; });
+
+        if ((result != mIndirectEquivalences.end()) && !result->mVariable.expired()) {
+            mEquivalences.push_back(std::move(*result));
+        } else {
+            mEquivalences.push_back({equivalentVariable, equivalentVariable.get(), "", ""});
+        }
+
+        if (result != mIndirectEquivalences.end()) {
+            mIndirectEquivalences.erase(result);
+        }
+
+        updateEquivalenceRevision(mVariable);
         return true;
     }
 
@@ -363,19 +463,11 @@ bool Variable::VariableImpl::setEquivalentTo(const VariablePtr &equivalentVariab
 
 bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVariable)
 {
-    cleanExpiredVariables();
     bool status = false;
     auto result = findEquivalentVariable(equivalentVariable);
-    if (result != mEquivalentVariables.end()) {
-        mEquivalentVariables.erase(result);
-        auto mappingIdResult = mMappingIdMap.find(equivalentVariable);
-        if (mappingIdResult != mMappingIdMap.end()) {
-            mMappingIdMap.erase(mappingIdResult);
-        }
-        auto connectionIdResult = mConnectionIdMap.find(equivalentVariable);
-        if (connectionIdResult != mConnectionIdMap.end()) {
-            mConnectionIdMap.erase(connectionIdResult);
-        }
+    if (result != mEquivalences.end()) {
+        mEquivalences.erase(result);
+        updateEquivalenceRevision(mVariable);
         status = true;
     }
 
@@ -384,28 +476,34 @@ bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVari
 
 void Variable::VariableImpl::setEquivalentMappingId(const VariablePtr &equivalentVariable, const std::string &id)
 {
-    VariableWeakPtr weakEquivalentVariable = equivalentVariable;
-    mMappingIdMap[weakEquivalentVariable] = id;
+    auto result = equivalence(equivalentVariable, !id.empty());
+    if (result != nullptr) {
+        result->mMappingId = id;
+    }
 }
 
 std::string Variable::VariableImpl::equivalentMappingId(const VariablePtr &equivalentVariable) const
 {
-    if (mMappingIdMap.find(equivalentVariable) != mMappingIdMap.end()) {
-        return mMappingIdMap.at(equivalentVariable);
+    auto result = equivalence(equivalentVariable);
+    if (result != nullptr) {
+        return result->mMappingId;
     }
     return "";
 }
 
 void Variable::VariableImpl::setEquivalentConnectionId(const VariablePtr &equivalentVariable, const std::string &id)
 {
-    VariableWeakPtr weakEquivalentVariable = equivalentVariable;
-    mConnectionIdMap[weakEquivalentVariable] = id;
+    auto result = equivalence(equivalentVariable, !id.empty());
+    if (result != nullptr) {
+        result->mConnectionId = id;
+    }
 }
 
 std::string Variable::VariableImpl::equivalentConnectionId(const VariablePtr &equivalentVariable) const
 {
-    if (mConnectionIdMap.find(equivalentVariable) != mConnectionIdMap.end()) {
-        return mConnectionIdMap.at(equivalentVariable);
+    auto result = equivalence(equivalentVariable);
+    if (result != nullptr) {
+        return result->mConnectionId;
     }
     return "";
 }
@@ -435,6 +533,11 @@ void Variable::setInitialValue(const std::string &initialValue)
     mPimpl->mInitialValue = initialValue;
 }
 
+void Variable::setInitialValue(std::string &&initialValue)
+{
+    mPimpl->mInitialValue = std::move(initialValue);
+}
+
 void Variable::setInitialValue(double initialValue)
 {
     mPimpl->mInitialValue = convertToString(initialValue);
@@ -445,7 +548,7 @@ void Variable::setInitialValue(const VariablePtr &variable)
     mPimpl->mInitialValue = variable->name();
 }
 
-std::string Variable::initialValue() const
+const std::string &Variable::initialValue() const
 {
     return mPimpl->mInitialValue;
 }
@@ -467,7 +570,7 @@ void Variable::setInterfaceType(Variable::InterfaceType interfaceType)
     setInterfaceType(interfaceTypeString);
 }
 
-std::string Variable::interfaceType() const
+const std::string &Variable::interfaceType() const
 {
     return mPimpl->mInterfaceType;
 }
@@ -498,9 +601,27 @@ bool Variable::permitsInterfaceType(InterfaceType interfaceType) const
     return testString == mPimpl->mInterfaceType;
 }
 
+/**
+ * @brief Test if the two given variables are equivalent.
+ *
+ * Test if the two given variables are equivalent, directly or indirectly. A
+ * direct equivalence is tested first since it is the most common case and it
+ * does not require traversing the variable equivalence network.
+ *
+ * @param variable1 The first variable to test.
+ * @param variable2 The second variable to test.
+ *
+ * @return True if the two given variables are equivalent, false otherwise.
+ */
+bool areEquivalent(const VariablePtr &variable1, const VariablePtr &variable2)
+{
+    return (variable1->hasEquivalentVariable(variable2) && variable2->hasEquivalentVariable(variable1))
+           || (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true));
+}
+
 void Variable::setEquivalenceMappingId(const VariablePtr &variable1, const VariablePtr &variable2, const std::string &mappingId)
 {
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         variable1->mPimpl->setEquivalentMappingId(variable2, mappingId);
         variable2->mPimpl->setEquivalentMappingId(variable1, mappingId);
     }
@@ -508,7 +629,7 @@ void Variable::setEquivalenceMappingId(const VariablePtr &variable1, const Varia
 
 void Variable::setEquivalenceConnectionId(const VariablePtr &variable1, const VariablePtr &variable2, const std::string &connectionId)
 {
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         auto map = createConnectionMap(variable1, variable2);
         for (auto &it : map) {
             it.first->mPimpl->setEquivalentConnectionId(it.second, connectionId);
@@ -524,7 +645,7 @@ void Variable::setEquivalenceConnectionId(const VariablePtr &variable1, const Va
 std::string Variable::equivalenceMappingId(const VariablePtr &variable1, const VariablePtr &variable2)
 {
     std::string id;
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         id = variable1->mPimpl->equivalentMappingId(variable2);
     }
     return id;
@@ -533,7 +654,7 @@ std::string Variable::equivalenceMappingId(const VariablePtr &variable1, const V
 std::string Variable::equivalenceConnectionId(const VariablePtr &variable1, const VariablePtr &variable2)
 {
     std::string id;
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         auto map = createConnectionMap(variable1, variable2);
         for (auto &it : map) {
             id = it.first->mPimpl->equivalentConnectionId(it.second);
@@ -547,7 +668,7 @@ std::string Variable::equivalenceConnectionId(const VariablePtr &variable1, cons
 
 void Variable::removeEquivalenceConnectionId(const VariablePtr &variable1, const VariablePtr &variable2)
 {
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         variable1->mPimpl->setEquivalentConnectionId(variable2, "");
         variable2->mPimpl->setEquivalentConnectionId(variable1, "");
     }
@@ -555,7 +676,7 @@ void Variable::removeEquivalenceConnectionId(const VariablePtr &variable1, const
 
 void Variable::removeEquivalenceMappingId(const VariablePtr &variable1, const VariablePtr &variable2)
 {
-    if (variable1->hasEquivalentVariable(variable2, true) && variable2->hasEquivalentVariable(variable1, true)) {
+    if (areEquivalent(variable1, variable2)) {
         variable1->mPimpl->setEquivalentMappingId(variable2, "");
         variable2->mPimpl->setEquivalentMappingId(variable1, "");
     }
@@ -19,7 +19,7 @@ limitations under the License.
 #include <cstring>
 #include <libxml/tree.h>
 #include <libxml/xmlerror.h>
-#include <sstream>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -50,6 +50,28 @@ void structuredErrorCallback(void *userData, xmlErrorPtr error)
     doc->addXmlError(errorString);
 }
 
+static std::mutex parserMutex;
+static size_t parserUserCount = 0;
+
+void initialiseParser()
+{
+    std::lock_guard<std::mutex> lock(parserMutex);
+
+    if (parserUserCount++ == 0) {
+        xmlInitParser();
+    }
+}
+
+void cleanUpParser()
+{
+    std::lock_guard<std::mutex> lock(parserMutex);
+
+    if (--parserUserCount == 0) {
+        xmlCleanupParser();
+        xmlCleanupGlobals();
+    }
+}
+
 /**
  * @brief The XmlDoc::XmlDocImpl struct.
  *
@@ -78,20 +100,19 @@ XmlDoc::~XmlDoc()
 
 void XmlDoc::parse(const std::string &input)
 {
-    xmlInitParser();
+    initialiseParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
     mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
+    cleanUpParser();
 }
 
 void XmlDoc::parseMathML(const std::string &input)
 {
-    xmlInitParser();
+    initialiseParser();
     std::string mathmlString = "<!DOCTYPE math SYSTEM \"" + LIBCELLML_MATHML_DTD_LOCATION + "\">" + input;
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
@@ -100,19 +121,7 @@ void XmlDoc::parseMathML(const std::string &input)
                                         XML_PARSE_DTDVALID);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
-}
-
-std::string XmlDoc::prettyPrint() const
-{
-    xmlChar *buffer;
-    int size = 0;
-    xmlDocDumpFormatMemoryEnc(mPimpl->mXmlDocPtr, &buffer, &size, "UTF-8", 1);
-    std::stringstream res;
-    res << buffer;
-    xmlFree(buffer);
-    return res.str();
+    cleanUpParser();
 }
 
 XmlNodePtr XmlDoc::rootNode() const
@@ -23,6 +23,22 @@ limitations under the License.
 
 namespace libcellml {
 
+/**
+ * @brief Initialise the libxml2 parser.
+ *
+ * Initialise the libxml2 parser if it is not already in use by another thread.
+ * Each call must be matched by a call to @ref cleanUpParser.
+ */
+void initialiseParser();
+
+/**
+ * @brief Clean up the libxml2 parser.
+ *
+ * Clean up the libxml2 parser, unless it is still in use by another thread,
+ * since cleaning it up while it is in use is not safe.
+ */
+void cleanUpParser();
+
 class XmlDoc; /**< Forward declaration of the internal XmlDoc class. */
 using XmlDocPtr = std::shared_ptr<XmlDoc>; /**< Type definition for shared XML doc pointer. */
 
@@ -56,17 +72,6 @@ public:
      */
     void parseMathML(const std::string &input);
 
-    /**
-     * @brief Convert this @c XmlDoc content into a pretty-print @c std::string.
-     *
-     * Converts the content in this @c XmlDoc into a pretty-print
-     * @c std::string.
-     *
-     * @return The pretty-print @c std::string representation of the content for
-     * this @c XmlDoc.
-     */
-    std::string prettyPrint() const;
-
     /**
      * @brief Get the root XML element of this @c XmlDoc.
      *
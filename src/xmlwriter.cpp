@@ -0,0 +1,238 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "xmlwriter.h"
+
+#include <algorithm>
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <libxml/xmlIO.h>
+#include <libxml/xmlerror.h>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "namespaces.h"
+#include "xmldoc.h"
+
+namespace libcellml {
+
+/**
+ * libxml2 indents each level of a formatted document with two spaces, but
+ * never by more than 60 characters, i.e. 30 levels.
+ */
+static const size_t INDENT_SIZE = 2;
+static const size_t MAX_INDENT_LEVEL = 30;
+
+/**
+ * @brief Callback for output from the libxml2 output buffer.
+ *
+ * Write callback @c xmlOutputWriteCallback used to send the serialised
+ * document straight to a @c std::ostream.
+ *
+ * @param context The @c std::ostream to write to.
+ * @param buffer The serialised data.
+ * @param len The length of @p buffer.
+ *
+ * @return The number of bytes to have been written. A failure of the stream is
+ * not reported to libxml2, which would report it on stderr, but through the
+ * state of the stream, which gets checked when finishing the document.
+ */
+int writeToStream(void *context, const char *buffer, int len)
+{
+    auto output = reinterpret_cast<std::ostream *>(context);
+    output->write(buffer, len);
+    return len;
+}
+
+/**
+ * @brief Escape an attribute value.
+ *
+ * Escape @p value the same way libxml2 does when it serialises an attribute.
+ *
+ * @param value The attribute value to escape.
+ *
+ * @return The escaped attribute value.
+ */
+std::string escapeAttributeValue(const std::string &value)
+{
+    std::string res;
+    res.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+        case '<':
+            res += "&lt;";
+            break;
+        case '>':
+            res += "&gt;";
+            break;
+        case '&':
+            res += "&amp;";
+            break;
+        case '"':
+            res += "&quot;";
+            break;
+        case '\n':
+            res += "&#10;";
+            break;
+        case '\r':
+            res += "&#13;";
+            break;
+        case '\t':
+            res += "&#9;";
+            break;
+        default:
+            res += c;
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief The XmlWriter::XmlWriterImpl struct.
+ *
+ * This struct is the private implementation struct for the XmlWriter class.
+ */
+struct XmlWriter::XmlWriterImpl
+{
+    std::ostream *mOutput = nullptr;
+    xmlOutputBufferPtr mBuffer = nullptr;
+    std::vector<std::string> mElements;
+    bool mStartTagOpen = false;
+    bool mMathValid = true;
+
+    void write(const std::string &text);
+    void writeIndent();
+    void closeStartTag();
+};
+
+void XmlWriter::XmlWriterImpl::write(const std::string &text)
+{
+    if (mBuffer != nullptr) {
+        xmlOutputBufferWrite(mBuffer, static_cast<int>(text.size()), text.c_str());
+    }
+}
+
+void XmlWriter::XmlWriterImpl::writeIndent()
+{
+    write(std::string(INDENT_SIZE * std::min(mElements.size(), MAX_INDENT_LEVEL), ' '));
+}
+
+void XmlWriter::XmlWriterImpl::closeStartTag()
+{
+    if (mStartTagOpen) {
+        write(">\n");
+        mStartTagOpen = false;
+    }
+}
+
+XmlWriter::XmlWriter(std::ostream &output)
+    : mPimpl(new XmlWriterImpl())
+{
+    initialiseParser();
+    mPimpl->mOutput = &output;
+    mPimpl->mBuffer = xmlOutputBufferCreateIO(writeToStream, nullptr, &output, nullptr);
+    mPimpl->write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+}
+
+XmlWriter::~XmlWriter()
+{
+    finish();
+    cleanUpParser();
+    delete mPimpl;
+}
+
+void XmlWriter::startElement(const std::string &name)
+{
+    mPimpl->closeStartTag();
+    mPimpl->writeIndent();
+    mPimpl->write("<" + name);
+    mPimpl->mElements.push_back(name);
+    mPimpl->mStartTagOpen = true;
+}
+
+void XmlWriter::addAttribute(const std::string &name, const std::string &value)
+{
+    mPimpl->write(" " + name + "=\"" + escapeAttributeValue(value) + "\"");
+}
+
+void XmlWriter::addMath(const std::string &math)
+{
+    mPimpl->closeStartTag();
+
+    // Parse the MathML within an element that has the same default namespace
+    // as the CellML document, so that it gets serialised as if it had been
+    // parsed as part of that document.
+
+    static const std::string MATH_WRAPPER = "math_wrapper";
+    std::string input = "<" + MATH_WRAPPER + " xmlns=\"" + CELLML_2_0_NS + "\">" + math + "</" + MATH_WRAPPER + ">";
+    // Like when parsing an XmlDoc, any issue with the MathML is reported to our
+    // own error handler rather than on stderr. That issue is then reported by
+    // finish().
+
+    xmlParserCtxtPtr context = xmlNewParserCtxt();
+    xmlSetStructuredErrorFunc(context, [](void *, xmlErrorPtr) {});
+    xmlDocPtr doc = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, XML_PARSE_NOBLANKS);
+    xmlFreeParserCtxt(context);
+    xmlSetStructuredErrorFunc(nullptr, nullptr);
+    xmlNodePtr root = xmlDocGetRootElement(doc);
+
+    if (root == nullptr) {
+        mPimpl->mMathValid = false;
+    } else {
+        auto level = static_cast<int>(mPimpl->mElements.size());
+        for (xmlNodePtr node = root->children; node != nullptr; node = node->next) {
+            if ((node->type == XML_ELEMENT_NODE)
+                || (node->type == XML_COMMENT_NODE)
+                || (node->type == XML_PI_NODE)) {
+                mPimpl->writeIndent();
+            }
+            if (mPimpl->mBuffer != nullptr) {
+                xmlNodeDumpOutput(mPimpl->mBuffer, doc, node, level, 1, "UTF-8");
+            }
+            mPimpl->write("\n");
+        }
+    }
+
+    if (doc != nullptr) {
+        xmlFreeDoc(doc);
+    }
+}
+
+void XmlWriter::endElement()
+{
+    std::string name = mPimpl->mElements.back();
+    mPimpl->mElements.pop_back();
+    if (mPimpl->mStartTagOpen) {
+        mPimpl->write("/>\n");
+        mPimpl->mStartTagOpen = false;
+    } else {
+        mPimpl->writeIndent();
+        mPimpl->write("</" + name + ">\n");
+    }
+}
+
+bool XmlWriter::finish()
+{
+    if (mPimpl->mBuffer == nullptr) {
+        return false;
+    }
+    bool res = (xmlOutputBufferClose(mPimpl->mBuffer) >= 0) && mPimpl->mOutput->good() && mPimpl->mMathValid;
+    mPimpl->mBuffer = nullptr;
+    return res;
+}
+
+} // namespace libcellml
@@ -0,0 +1,105 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+namespace libcellml {
+
+/**
+ * @brief The XmlWriter class.
+ *
+ * The XmlWriter class writes a pretty-printed XML document straight to a
+ * @c std::ostream, element by element, laid out the same way libxml2 lays out
+ * a formatted document. Only user-supplied MathML is parsed, by libxml2, so
+ * that it can be reformatted.
+ */
+class XmlWriter
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * Creates a writer for @p output and writes the XML declaration to it.
+     *
+     * @param output The @c std::ostream to write to.
+     */
+    explicit XmlWriter(std::ostream &output);
+    ~XmlWriter(); /**< Destructor. */
+
+    XmlWriter(const XmlWriter &rhs) = delete; /**< Copy constructor */
+    XmlWriter(XmlWriter &&rhs) noexcept = delete; /**< Move constructor */
+    XmlWriter &operator=(XmlWriter rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Start an element.
+     *
+     * Starts an element called @p name as a child of the current element.
+     * Attributes can be added to it until a child is added to it.
+     *
+     * @param name The name of the element.
+     */
+    void startElement(const std::string &name);
+
+    /**
+     * @brief Add an attribute to the current element.
+     *
+     * Adds an attribute called @p name to the current element. @p value is
+     * escaped as needed.
+     *
+     * @param name The name of the attribute.
+     * @param value The value of the attribute.
+     */
+    void addAttribute(const std::string &name, const std::string &value);
+
+    /**
+     * @brief Add MathML to the current element.
+     *
+     * Parses @p math, which may hold several sibling elements, and writes
+     * them as children of the current element. If @p math cannot be parsed,
+     * then nothing is written and @ref finish reports a failure.
+     *
+     * @param math The MathML to add.
+     */
+    void addMath(const std::string &math);
+
+    /**
+     * @brief End the current element.
+     *
+     * Ends the current element, which is written as an empty element if no
+     * child was added to it.
+     */
+    void endElement();
+
+    /**
+     * @brief Finish the document.
+     *
+     * Writes out anything that is still buffered. No element can be added
+     * afterwards.
+     *
+     * @return @c true if the whole document could be written, @c false
+     * otherwise, e.g. if some MathML could not be parsed.
+     */
+    bool finish();
+
+private:
+    struct XmlWriterImpl; /**< Forward declaration for pImpl idiom. */
+    XmlWriterImpl *mPimpl; /**< Private member to implementation pointer. */
+};
+
+} // namespace libcellml
@@ -982,6 +982,87 @@ TEST(Analyser, threeEquivalentExternalVariablesNotIncludingPrimaryVariable)
     EXPECT_EQ_ISSUES_CELLMLELEMENTTYPES_LEVELS_REFERENCERULES(expectedIssues, expectedCellmlElementTypes, expectedLevels, expectedReferenceRules, analyser);
 }
 
+TEST(Analyser, equivalentVariables)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    auto membraneV = model->component("membrane")->variable("V");
+    auto sodiumChannelV = model->component("sodium_channel")->variable("V");
+    auto leakageCurrentV = model->component("leakage_current")->variable("V");
+    auto membraneCm = model->component("membrane")->variable("Cm");
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, membraneV));
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, sodiumChannelV));
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(sodiumChannelV, leakageCurrentV));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, membraneCm));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, nullptr));
+
+    // Check that adding and removing equivalences is taken into account.
+
+    libcellml::Variable::removeEquivalence(membraneV, leakageCurrentV);
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, sodiumChannelV));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, leakageCurrentV));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(sodiumChannelV, leakageCurrentV));
+
+    libcellml::Variable::addEquivalence(leakageCurrentV, membraneCm);
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(leakageCurrentV, membraneCm));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, membraneCm));
+
+    libcellml::Variable::addEquivalence(membraneV, leakageCurrentV);
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(sodiumChannelV, membraneCm));
+
+    // Check that equivalences edited while a component is not part of our model
+    // are taken into account once that component is back in our model.
+
+    auto sodiumChannel = model->component("sodium_channel");
+    auto sodiumChannelMGateV = sodiumChannel->component("sodium_channel_m_gate")->variable("V");
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(sodiumChannelV, sodiumChannelMGateV));
+
+    model->removeComponent(sodiumChannel);
+
+    libcellml::Variable::removeEquivalence(sodiumChannelV, sodiumChannelMGateV);
+
+    model->addComponent(sodiumChannel);
+
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(sodiumChannelV, sodiumChannelMGateV));
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, sodiumChannelV));
+
+    // Check that equivalences in another model are not mistaken for ours.
+
+    auto otherModel = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto otherMembraneV = otherModel->component("membrane")->variable("V");
+
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, otherMembraneV));
+
+    otherMembraneV->removeAllEquivalences();
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, sodiumChannelV));
+
+    // Check that we can still test the equivalence of variables once the
+    // analysed model is gone.
+
+    auto membrane = model->component("membrane");
+
+    model = nullptr;
+
+    EXPECT_TRUE(analyserModel->areEquivalentVariables(membraneV, membrane->variable("Cm")));
+    EXPECT_FALSE(analyserModel->areEquivalentVariables(membraneV, otherMembraneV));
+}
+
 TEST(Analyser, coverage)
 {
     auto analyser = libcellml::Analyser::create();
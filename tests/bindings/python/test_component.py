@@ -99,6 +99,18 @@ class ComponentTestCase(unittest.TestCase):
         v = Variable()
         c.addVariable(v)
 
+    def test_add_variables(self):
+        from libcellml import Component, Variable
+
+        c = Component()
+        v1 = Variable("v1")
+        v2 = Variable("v2")
+        c.reserveVariables(2)
+        self.assertTrue(c.addVariables([v1, v2]))
+        self.assertEqual(2, c.variableCount())
+        self.assertFalse(c.addVariables([v1]))
+        self.assertEqual(2, c.variableCount())
+
     def test_has_variable(self):
         from libcellml import Component, Variable
 
@@ -28,6 +28,16 @@ class GeneratorProfileTestCase(unittest.TestCase):
         pp = GeneratorProfile(GeneratorProfile.Profile.PYTHON)
         self.assertEqual(GeneratorProfile.Profile.PYTHON, pp.profile())
 
+        # Create a C SIMD profile.
+        ps = GeneratorProfile(GeneratorProfile.Profile.C_SIMD)
+        self.assertEqual(GeneratorProfile.Profile.C_SIMD, ps.profile())
+        self.assertTrue(ps.hasBranchlessPiecewise())
+
+        # Create a C++ profile.
+        pc = GeneratorProfile(GeneratorProfile.Profile.CXX)
+        self.assertEqual(GeneratorProfile.Profile.CXX, pc.profile())
+        self.assertFalse(pc.hasInterface())
+
     @unittest.skip('Create tests script')
     def test_create_tests(self):
         import re
@@ -337,6 +347,25 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setAtanhString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.atanhString())
 
+    def test_blend_function_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('double blend(double condition, double x, double y)\n{\n    return (condition != 0.0)?x:y;\n}\n',
+                         g.blendFunctionString())
+        g.setBlendFunctionString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.blendFunctionString())
+
+    def test_branchless_piecewise_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('blend(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)', g.branchlessPiecewiseString())
+        g.setBranchlessPiecewiseString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.branchlessPiecewiseString())
+
     def test_ceiling_string(self):
         from libcellml import GeneratorProfile
 
@@ -634,6 +663,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setHasAndOperator(False)
         self.assertFalse(g.hasAndOperator())
 
+    def test_has_branchless_piecewise(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertFalse(g.hasBranchlessPiecewise())
+        g.setHasBranchlessPiecewise(True)
+        self.assertTrue(g.hasBranchlessPiecewise())
+
     def test_has_conditional_operator(self):
         from libcellml import GeneratorProfile
 
@@ -797,6 +835,15 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setImplementationDeleteArrayMethodString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationDeleteArrayMethodString())
 
+    def test_implementation_footer_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.implementationFooterString())
+        g.setImplementationFooterString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.implementationFooterString())
+
     def test_implementation_header_string(self):
         from libcellml import GeneratorProfile
 
@@ -1277,6 +1324,25 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setPowerString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.powerString())
 
+    def test_precision(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, g.precision())
+        self.assertEqual('exp', g.exponentialString())
+        self.assertTrue(g.setPrecision(GeneratorProfile.Precision.SINGLE))
+        self.assertEqual(GeneratorProfile.Precision.SINGLE, g.precision())
+        self.assertEqual('expf', g.exponentialString())
+        self.assertTrue(g.setPrecision(GeneratorProfile.Precision.MIXED))
+        self.assertEqual(GeneratorProfile.Precision.MIXED, g.precision())
+        self.assertEqual('exp', g.exponentialString())
+
+        g.setProfile(GeneratorProfile.Profile.PYTHON)
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, g.precision())
+        self.assertFalse(g.setPrecision(GeneratorProfile.Precision.SINGLE))
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, g.precision())
+
     def test_rates_array_string(self):
         from libcellml import GeneratorProfile
 
@@ -1286,6 +1352,24 @@ class GeneratorProfileTestCase(unittest.TestCase):
         g.setRatesArrayString(GeneratorProfileTestCase.VALUE)
         self.assertEqual(GeneratorProfileTestCase.VALUE, g.ratesArrayString())
 
+    def test_real_literal_prefix_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.realLiteralPrefixString())
+        g.setRealLiteralPrefixString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.realLiteralPrefixString())
+
+    def test_real_literal_suffix_string(self):
+        from libcellml import GeneratorProfile
+
+        g = GeneratorProfile()
+
+        self.assertEqual('', g.realLiteralSuffixString())
+        g.setRealLiteralSuffixString(GeneratorProfileTestCase.VALUE)
+        self.assertEqual(GeneratorProfileTestCase.VALUE, g.realLiteralSuffixString())
+
     def test_rem_string(self):
         from libcellml import GeneratorProfile
 
@@ -180,6 +180,90 @@ class ValidatorTestCase(unittest.TestCase):
 
         self.assertFalse(c.isResolved())
 
+    def test_cache_directory(self):
+        from libcellml import Importer
+
+        importer = Importer()
+
+        self.assertEqual("", importer.cacheDirectory())
+
+        importer.setCacheDirectory("/some/directory")
+
+        self.assertEqual("/some/directory", importer.cacheDirectory())
+
+    def test_lazy_resolution(self):
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        importer = Importer()
+
+        self.assertFalse(importer.lazyResolution())
+
+        importer.setLazyResolution(True)
+
+        self.assertTrue(importer.lazyResolution())
+
+        model = parser.parseModel(file_contents("importer/diamond.cellml"))
+
+        self.assertTrue(importer.resolveImports(model, resource_path("importer/")))
+        self.assertEqual(0, importer.libraryCount())
+        self.assertFalse(model.hasUnresolvedImports())
+        self.assertEqual(3, importer.libraryCount())
+
+    def test_dependency_graph(self):
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        importer = Importer()
+
+        model = parser.parseModel(file_contents("importer/diamond.cellml"))
+        importer.resolveImports(model, resource_path("importer/"))
+
+        left = resource_path("importer/diamond_left.cellml")
+        right = resource_path("importer/diamond_right.cellml")
+        point = resource_path("importer/diamond_point.cellml")
+
+        self.assertEqual((point,), importer.dependencies(left))
+        self.assertEqual((left, right), importer.dependants(point))
+        self.assertTrue(importer.invalidate(point))
+        self.assertFalse(importer.invalidate("unknown.cellml"))
+
+    def test_statistics(self):
+        from libcellml import Importer, Parser
+
+        parser = Parser()
+        importer = Importer()
+
+        self.assertFalse(importer.statisticsEnabled())
+
+        importer.setStatisticsEnabled(True)
+
+        self.assertTrue(importer.statisticsEnabled())
+
+        model = parser.parseModel(file_contents("importer/diamond.cellml"))
+        importer.resolveImports(model, resource_path("importer/"))
+        importer.flattenModel(model)
+
+        self.assertEqual(3, importer.statisticsCount())
+
+        point = importer.statistics(resource_path("importer/diamond_point.cellml"))
+
+        self.assertEqual(resource_path("importer/diamond_point.cellml"), point.key())
+        self.assertEqual(len(file_contents("importer/diamond_point.cellml")), point.bytesRead())
+        self.assertLessEqual(0.0, point.parseTime())
+        self.assertEqual(1, point.cacheHitCount())
+        self.assertEqual(1, point.cacheMissCount())
+        self.assertEqual(2, point.componentCount())
+        self.assertEqual(0, point.unitsCount())
+        self.assertLessEqual(0.0, point.flattenTime())
+        self.assertEqual(point.key(), importer.statistics(1).key())
+        self.assertIsNone(importer.statistics(3))
+        self.assertIsNone(importer.statistics("unknown.cellml"))
+
+        importer.removeAllStatistics()
+
+        self.assertEqual(0, importer.statisticsCount())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -237,6 +237,25 @@ class ModelTestCase(unittest.TestCase):
         c.setImportSource(ImportSource())
         self.assertTrue(m.hasUnresolvedImports())
 
+    def test_entity_by_path(self):
+        from libcellml import Model, Component, Variable
+
+        # ComponentPtr componentByPath(const std::string &path)
+        # VariablePtr variableByPath(const std::string &path)
+        m = Model()
+        c1 = Component('c1')
+        c2 = Component('c2')
+        v = Variable('v')
+        m.addComponent(c1)
+        c1.addComponent(c2)
+        c2.addVariable(v)
+        self.assertEqual('c2', m.componentByPath('c1/c2').name())
+        self.assertEqual('v', m.variableByPath('c1/c2/v').name())
+        self.assertIsNone(m.componentByPath('c2'))
+        v.setName('w')
+        self.assertIsNone(m.variableByPath('c1/c2/v'))
+        self.assertEqual('w', m.variableByPath('c1/c2/w').name())
+
     def test_add_component(self):
         from libcellml import Model, Component
 
@@ -261,6 +261,43 @@ TEST(Clone, component)
     EXPECT_NE(c->name(), cClone->name());
 }
 
+TEST(Clone, componentMathModifiedAfterCloning)
+{
+    auto c = libcellml::Component::create();
+    c->setMath(NON_EMPTY_MATH);
+
+    auto cClone = c->clone();
+
+    cClone->appendMath(EMPTY_MATH);
+
+    EXPECT_EQ(NON_EMPTY_MATH, c->math());
+    EXPECT_EQ(NON_EMPTY_MATH + EMPTY_MATH, cClone->math());
+
+    auto cCloneClone = cClone->clone();
+
+    cClone->removeMath();
+
+    EXPECT_EQ("", cClone->math());
+    EXPECT_EQ(NON_EMPTY_MATH + EMPTY_MATH, cCloneClone->math());
+}
+
+TEST(Clone, resetMathModifiedAfterCloning)
+{
+    auto r = libcellml::Reset::create();
+    r->setTestValue(NON_EMPTY_MATH);
+    r->setResetValue(NON_EMPTY_MATH);
+
+    auto rClone = r->clone();
+
+    rClone->appendTestValue(EMPTY_MATH);
+    r->setResetValue(EMPTY_MATH);
+
+    EXPECT_EQ(NON_EMPTY_MATH, r->testValue());
+    EXPECT_EQ(NON_EMPTY_MATH + EMPTY_MATH, rClone->testValue());
+    EXPECT_EQ(EMPTY_MATH, r->resetValue());
+    EXPECT_EQ(NON_EMPTY_MATH, rClone->resetValue());
+}
+
 TEST(Clone, componentWithVariables)
 {
     auto c = libcellml::Component::create();
@@ -581,3 +581,151 @@ TEST(Component, preventSegfaultInAddSomething)
     EXPECT_FALSE(model->addComponent(nullptr));
     EXPECT_FALSE(model->addUnits(nullptr));
 }
+
+TEST(Component, lookUpByNameAfterEdits)
+{
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto v1 = libcellml::Variable::create("v1");
+    auto v2 = libcellml::Variable::create("v2");
+    auto u1 = libcellml::Units::create("u1");
+    auto u2 = libcellml::Units::create("u2");
+
+    model->addComponent(component);
+    model->addUnits(u1);
+    model->addUnits(u2);
+    component->addVariable(v1);
+    component->addVariable(v2);
+
+    EXPECT_EQ(v1, component->variable("v1"));
+    EXPECT_EQ(v2, component->variable("v2"));
+    EXPECT_EQ(component, model->component("component"));
+    EXPECT_EQ(u2, model->units("u2"));
+
+    // Renaming something must be reflected by name lookups.
+
+    v1->setName("v3");
+    component->setName("renamed_component");
+    u2->setName("u3");
+
+    EXPECT_EQ(nullptr, component->variable("v1"));
+    EXPECT_EQ(v1, component->variable("v3"));
+    EXPECT_EQ(nullptr, model->component("component"));
+    EXPECT_EQ(component, model->component("renamed_component"));
+    EXPECT_EQ(nullptr, model->units("u2"));
+    EXPECT_EQ(u2, model->units("u3"));
+
+    // Where several entities share the same name, the first one is found.
+
+    auto otherV2 = libcellml::Variable::create("v2");
+
+    component->addVariable(otherV2);
+
+    EXPECT_EQ(v2, component->variable("v2"));
+
+    component->removeVariable(v2);
+
+    EXPECT_EQ(otherV2, component->variable("v2"));
+
+    // Replacing, taking and removing things must be reflected by name lookups.
+
+    auto u4 = libcellml::Units::create("u4");
+
+    model->replaceUnits("u1", u4);
+
+    EXPECT_EQ(nullptr, model->units("u1"));
+    EXPECT_EQ(u4, model->units("u4"));
+    EXPECT_EQ(u4, model->takeUnits("u4"));
+    EXPECT_EQ(nullptr, model->units("u4"));
+    EXPECT_EQ(u2, model->units("u3"));
+
+    EXPECT_EQ(component, model->takeComponent("renamed_component"));
+    EXPECT_EQ(nullptr, model->component("renamed_component"));
+
+    component->removeAllVariables();
+
+    EXPECT_EQ(nullptr, component->variable("v3"));
+    EXPECT_EQ(nullptr, component->variable("v2"));
+}
+
+TEST(Component, lookUpByNameInLargeComponent)
+{
+    static const size_t VARIABLE_COUNT = 10000;
+
+    auto component = libcellml::Component::create("component");
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        component->addVariable(libcellml::Variable::create("v" + std::to_string(i)));
+    }
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        EXPECT_EQ(component->variable(i), component->variable("v" + std::to_string(i)));
+    }
+
+    component->removeVariable("v0");
+
+    EXPECT_EQ(nullptr, component->variable("v0"));
+    EXPECT_EQ(component->variable(0), component->variable("v1"));
+}
+
+TEST(Component, addVariables)
+{
+    auto component = libcellml::Component::create("component");
+    auto otherComponent = libcellml::Component::create("other_component");
+    auto v1 = libcellml::Variable::create("v1");
+    auto v2 = libcellml::Variable::create("v2");
+    auto v3 = libcellml::Variable::create("v3");
+
+    otherComponent->addVariable(v3);
+
+    component->reserveVariables(3);
+
+    EXPECT_TRUE(component->addVariables({v1, v2, v3}));
+    EXPECT_EQ(size_t(3), component->variableCount());
+    EXPECT_EQ(size_t(0), otherComponent->variableCount());
+    EXPECT_EQ(component, v3->parent());
+    EXPECT_EQ(v2, component->variable("v2"));
+
+    auto v4 = libcellml::Variable::create("v4");
+
+    EXPECT_FALSE(component->addVariables({v1, nullptr, v4, v4}));
+    EXPECT_EQ(size_t(4), component->variableCount());
+    EXPECT_EQ(v4, component->variable(3));
+    EXPECT_EQ(v4, component->variable("v4"));
+}
+
+TEST(Component, addVariablesToLargeComponent)
+{
+    static const size_t VARIABLE_COUNT = 10000;
+
+    auto component = libcellml::Component::create("component");
+    std::vector<libcellml::VariablePtr> variables;
+
+    variables.reserve(VARIABLE_COUNT);
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        variables.push_back(libcellml::Variable::create("v" + std::to_string(i)));
+    }
+
+    EXPECT_TRUE(component->addVariables(variables));
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        EXPECT_EQ(variables[i], component->variable("v" + std::to_string(i)));
+        EXPECT_EQ(component, variables[i]->parent());
+    }
+}
+
+TEST(Component, setMathByMove)
+{
+    auto component = libcellml::Component::create("component");
+    std::string math = NON_EMPTY_MATH;
+
+    component->setMath(std::move(math));
+
+    EXPECT_EQ(NON_EMPTY_MATH, component->math());
+    EXPECT_EQ(&component->math(), &component->math());
+
+    component->setMath(std::string());
+
+    EXPECT_EQ("", component->math());
+}
@@ -20,6 +20,8 @@ limitations under the License.
 
 #include <libcellml>
 
+#include <sstream>
+
 static const std::string EMPTY_STRING;
 
 TEST(Generator, emptyModel)
@@ -38,6 +40,15 @@ TEST(Generator, emptyModel)
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(EMPTY_STRING, generator->implementationCode());
+
+    std::ostringstream interfaceCode;
+    std::ostringstream implementationCode;
+
+    generator->writeInterface(interfaceCode);
+    generator->writeImplementation(implementationCode);
+
+    EXPECT_EQ(EMPTY_STRING, interfaceCode.str());
+    EXPECT_EQ(EMPTY_STRING, implementationCode.str());
 }
 
 TEST(Generator, algebraicEqnComputedVarOnRhs)
@@ -1824,6 +1835,16 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952WithExternalVariables)
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.py"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create();
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+    profile->setInterfaceFileNameString("model.external.single.h");
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.single.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.external.single.c"), generator->implementationCode());
 }
 
 #include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.external.c"
@@ -1855,6 +1876,320 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952WithExternalVariablesUse)
     deleteArray(variables);
 }
 
+namespace single {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.external.single.c"
+
+float externalVariable(float /* unused */, float * /* unused */,
+                       float * /* unused */, float * /* unused */,
+                       size_t index)
+{
+    return 123.0f + float(index);
+}
+} // namespace single
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithExternalVariablesSinglePrecisionUse)
+{
+    // Check that the single-precision version of our HH52 model gives the
+    // same results as its double-precision version, within single precision.
+
+    double *states = createStatesArray();
+    double *rates = createStatesArray();
+    double *variables = createVariablesArray();
+    float *singleStates = single::createStatesArray();
+    float *singleRates = single::createStatesArray();
+    float *singleVariables = single::createVariablesArray();
+
+    initialiseStatesAndConstants(states, variables);
+    computeComputedConstants(variables);
+    computeRates(10.25, states, rates, variables, externalVariable);
+    computeVariables(10.25, states, rates, variables, externalVariable);
+
+    single::initialiseStatesAndConstants(singleStates, singleVariables);
+    single::computeComputedConstants(singleVariables);
+    single::computeRates(10.25f, singleStates, singleRates, singleVariables, single::externalVariable);
+    single::computeVariables(10.25f, singleStates, singleRates, singleVariables, single::externalVariable);
+
+    for (size_t i = 0; i < STATE_COUNT; ++i) {
+        EXPECT_NEAR(rates[i], double(singleRates[i]), 1.0e-5 * (1.0 + std::abs(rates[i])));
+    }
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        EXPECT_NEAR(variables[i], double(singleVariables[i]), 1.0e-5 * (1.0 + std::abs(variables[i])));
+    }
+
+    deleteArray(states);
+    deleteArray(rates);
+    deleteArray(variables);
+    single::deleteArray(singleStates);
+    single::deleteArray(singleRates);
+    single::deleteArray(singleVariables);
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithCSimdProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto generator = libcellml::Generator::create();
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C_SIMD);
+
+    generator->setModel(analyser->model());
+    generator->setProfile(profile);
+
+    EXPECT_TRUE(profile->hasBranchlessPiecewise());
+
+    profile->setInterfaceFileNameString("model.simd.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.simd.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.simd.c"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithExternalVariablesAndCSimdProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->addExternalVariable(libcellml::AnalyserExternalVariable::create(model->component("membrane")->variable("V")));
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    const std::vector<std::string> expectedIssues = {
+        "Variable 'V' in component 'membrane' is external, but the profile cannot generate code for external variables, so the methods to compute the rates and variables of the model are not generated.",
+    };
+    const std::vector<libcellml::CellmlElementType> expectedCellmlElementTypes = {
+        libcellml::CellmlElementType::VARIABLE,
+    };
+    const std::vector<libcellml::Issue::Level> expectedLevels = {
+        libcellml::Issue::Level::ERROR,
+    };
+    const std::vector<libcellml::Issue::ReferenceRule> expectedReferenceRules = {
+        libcellml::Issue::ReferenceRule::GENERATOR_EXTERNAL_VARIABLE_NOT_SUPPORTED,
+    };
+
+    auto generator = libcellml::Generator::create();
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C_SIMD);
+
+    generator->setModel(analyser->model());
+    generator->setProfile(profile);
+
+    auto interfaceCode = generator->interfaceCode();
+
+    EXPECT_EQ(std::string::npos, interfaceCode.find("computeRates"));
+    EXPECT_EQ_ISSUES_CELLMLELEMENTTYPES_LEVELS_REFERENCERULES(expectedIssues, expectedCellmlElementTypes, expectedLevels, expectedReferenceRules, generator);
+
+    auto implementationCode = generator->implementationCode();
+
+    EXPECT_EQ(std::string::npos, implementationCode.find("computeRates"));
+    EXPECT_EQ_ISSUES_CELLMLELEMENTTYPES_LEVELS_REFERENCERULES(expectedIssues, expectedCellmlElementTypes, expectedLevels, expectedReferenceRules, generator);
+
+    // No issues are raised when our model has no external variables.
+
+    analyser->removeAllExternalVariables();
+    analyser->analyseModel(model);
+
+    generator->setModel(analyser->model());
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("computeRates"));
+    EXPECT_EQ(size_t(0), generator->issueCount());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithCxxProfile)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto generator = libcellml::Generator::create();
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::CXX);
+
+    generator->setModel(analyser->model());
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.hpp"), generator->implementationCode());
+}
+
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.hpp"
+
+template<typename Real>
+Model::States<Real> hodgkinHuxleySquidAxonModel1952Rates(const Real &v)
+{
+    auto states = Model::createStatesArray<Real>();
+    auto rates = Model::createStatesArray<Real>();
+    auto variables = Model::createVariablesArray<Real>();
+
+    Model::initialiseStatesAndConstants(states, variables);
+    Model::computeComputedConstants(variables);
+
+    states[3] = v;
+
+    Model::computeRates(Real(0.0), states, rates, variables);
+    Model::computeVariables(Real(0.0), states, rates, variables);
+
+    return rates;
+}
+
+namespace dual {
+
+// A minimal dual number, i.e. a value and its derivative, which is all that we
+// need to differentiate the rates of the HH52 model with respect to V.
+
+struct Dual
+{
+    double value = 0.0;
+    double derivative = 0.0;
+
+    Dual() = default;
+
+    explicit Dual(double value, double derivative = 0.0)
+        : value(value)
+        , derivative(derivative)
+    {
+    }
+};
+
+Dual operator-(const Dual &x)
+{
+    return Dual(-x.value, -x.derivative);
+}
+
+Dual operator+(const Dual &x, const Dual &y)
+{
+    return Dual(x.value + y.value, x.derivative + y.derivative);
+}
+
+Dual operator-(const Dual &x, const Dual &y)
+{
+    return Dual(x.value - y.value, x.derivative - y.derivative);
+}
+
+Dual operator*(const Dual &x, const Dual &y)
+{
+    return Dual(x.value * y.value, x.derivative * y.value + x.value * y.derivative);
+}
+
+Dual operator/(const Dual &x, const Dual &y)
+{
+    return Dual(x.value / y.value, (x.derivative * y.value - x.value * y.derivative) / (y.value * y.value));
+}
+
+bool operator<=(const Dual &x, const Dual &y)
+{
+    return x.value <= y.value;
+}
+
+bool operator>=(const Dual &x, const Dual &y)
+{
+    return x.value >= y.value;
+}
+
+Dual exp(const Dual &x)
+{
+    auto value = std::exp(x.value);
+
+    return Dual(value, value * x.derivative);
+}
+
+Dual pow(const Dual &x, const Dual &y)
+{
+    // Note: the HH52 model only raises a variable to a constant power.
+
+    auto value = std::pow(x.value, y.value);
+
+    return Dual(value, y.value * std::pow(x.value, y.value - 1.0) * x.derivative);
+}
+
+} // namespace dual
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithCxxProfileUse)
+{
+    static_assert(Model::STATE_COUNT == 4, "The HH52 model has 4 states.");
+    static_assert(Model::VARIABLE_COUNT == 18, "The HH52 model has 18 variables.");
+
+    EXPECT_STREQ("V", Model::STATE_INFO[3].name);
+
+    static const double V = -5.0;
+    static const double H = 1.0e-6;
+
+    auto rates = hodgkinHuxleySquidAxonModel1952Rates(V);
+    auto longDoubleRates = hodgkinHuxleySquidAxonModel1952Rates<long double>(V);
+    auto floatRates = hodgkinHuxleySquidAxonModel1952Rates<float>(V);
+    auto dualRates = hodgkinHuxleySquidAxonModel1952Rates(dual::Dual(V, 1.0));
+    auto ratesAbove = hodgkinHuxleySquidAxonModel1952Rates(V + H);
+    auto ratesBelow = hodgkinHuxleySquidAxonModel1952Rates(V - H);
+
+    for (size_t i = 0; i < Model::STATE_COUNT; ++i) {
+        SCOPED_TRACE(i);
+
+        EXPECT_NEAR(rates[i], double(longDoubleRates[i]), 1.0e-12 * (1.0 + std::abs(rates[i])));
+        EXPECT_NEAR(rates[i], double(floatRates[i]), 1.0e-4 * (1.0 + std::abs(rates[i])));
+        EXPECT_EQ(rates[i], dualRates[i].value);
+
+        // The derivative of a rate with respect to V is the same as its
+        // central finite difference approximation.
+
+        auto derivative = (ratesAbove[i] - ratesBelow[i]) / (2.0 * H);
+
+        EXPECT_NEAR(derivative, dualRates[i].derivative, 1.0e-6 * (1.0 + std::abs(derivative)));
+    }
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithStreamedCode)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyser->model());
+
+    std::ostringstream interfaceCode;
+    std::ostringstream implementationCode;
+
+    generator->writeInterface(interfaceCode);
+    generator->writeImplementation(implementationCode);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), interfaceCode.str());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), implementationCode.str());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    interfaceCode.str({});
+    implementationCode.str({});
+
+    generator->writeInterface(interfaceCode);
+    generator->writeImplementation(implementationCode);
+
+    EXPECT_EQ(EMPTY_STRING, interfaceCode.str());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), implementationCode.str());
+}
+
 TEST(Generator, nobleModel1962)
 {
     auto parser = libcellml::Parser::create();
@@ -1951,6 +2286,52 @@ TEST(Generator, sineImports)
     EXPECT_EQ(fileContents("generator/sine_model_imports/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, branchlessPiecewise)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/branchless_piecewise/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+
+    EXPECT_EQ(libcellml::AnalyserModel::Type::ODE, analyserModel->type());
+
+    EXPECT_EQ(size_t(1), analyserModel->stateCount());
+    EXPECT_EQ(size_t(9), analyserModel->variableCount());
+    EXPECT_EQ(size_t(7), analyserModel->equationCount());
+
+    auto generator = libcellml::Generator::create();
+
+    generator->setModel(analyserModel);
+
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.c"), generator->implementationCode());
+
+    generator->profile()->setHasBranchlessPiecewise(true);
+
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.branchless.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.branchless.c"), generator->implementationCode());
+
+    auto profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.py"), generator->implementationCode());
+
+    profile->setHasBranchlessPiecewise(true);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/branchless_piecewise/model.branchless.py"), generator->implementationCode());
+}
+
 TEST(Generator, coverage)
 {
     auto parser = libcellml::Parser::create();
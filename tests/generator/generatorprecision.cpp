@@ -0,0 +1,210 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "generatorprecision.h"
+
+libcellml::ModelPtr generatorModel(const std::string &name)
+{
+    auto parser = libcellml::Parser::create();
+
+    if (name == "sine_model_imports") {
+        auto model = parser->parseModel(fileContents("sine_approximations_import.xml"));
+        auto importer = libcellml::Importer::create();
+
+        importer->resolveImports(model, resourcePath());
+
+        return importer->flattenModel(model);
+    }
+
+    return parser->parseModel(fileContents("generator/" + name + "/model.cellml"));
+}
+
+TEST(GeneratorPrecision, singleAndMixedPrecisionCode)
+{
+    for (size_t i = 0; i < GENERATOR_PRECISION_MODEL_COUNT; ++i) {
+        std::string name = GENERATOR_PRECISION_MODELS[i].name;
+
+        SCOPED_TRACE(name);
+
+        auto model = generatorModel(name);
+        auto analyser = libcellml::Analyser::create();
+
+        analyser->analyseModel(model);
+
+        EXPECT_EQ(size_t(0), analyser->errorCount());
+
+        auto generator = libcellml::Generator::create();
+        auto profile = generator->profile();
+
+        generator->setModel(analyser->model());
+
+        EXPECT_TRUE(profile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE));
+
+        profile->setInterfaceFileNameString("model.single.h");
+
+        EXPECT_EQ(fileContents("generator/" + name + "/model.single.h"), generator->interfaceCode());
+        EXPECT_EQ(fileContents("generator/" + name + "/model.single.c"), generator->implementationCode());
+
+        EXPECT_TRUE(profile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED));
+
+        profile->setInterfaceFileNameString("model.mixed.h");
+
+        EXPECT_EQ(fileContents("generator/" + name + "/model.mixed.h"), generator->interfaceCode());
+        EXPECT_EQ(fileContents("generator/" + name + "/model.mixed.c"), generator->implementationCode());
+    }
+}
+
+struct Results
+{
+    std::vector<double> rates;
+    std::vector<double> variables;
+};
+
+Results results(const GeneratorPrecisionCode &code)
+{
+    static const double VOI = 10.25;
+
+    Results res = {std::vector<double>(code.stateCount()),
+                   std::vector<double>(code.variableCount())};
+
+    code.compute(VOI, nullptr, res.rates.data(), res.variables.data());
+
+    return res;
+}
+
+void expectNear(const std::vector<double> &expected, const std::vector<double> &actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        SCOPED_TRACE(i);
+
+        if (std::isnan(expected[i])) {
+            EXPECT_TRUE(std::isnan(actual[i]));
+        } else if (std::isinf(expected[i])) {
+            EXPECT_EQ(expected[i], actual[i]);
+        } else if (std::abs(expected[i]) > std::numeric_limits<float>::max()) {
+            // The value is too large to be represented in single precision.
+
+            EXPECT_TRUE(std::isinf(actual[i]) || (expected[i] == actual[i]));
+        } else {
+            // Some of our models lose a few digits through cancellation, hence
+            // we don't expect more than four significant digits to agree.
+
+            EXPECT_NEAR(expected[i], actual[i], 1.0e-4 * (1.0 + std::abs(expected[i])));
+        }
+    }
+}
+
+void expectNear(const Results &expected, const Results &actual)
+{
+    expectNear(expected.rates, actual.rates);
+    expectNear(expected.variables, actual.variables);
+}
+
+TEST(GeneratorPrecision, singleAndMixedPrecisionResults)
+{
+    // Check that the single- and mixed-precision versions of our generator
+    // models give the same results as their double-precision version, within
+    // single precision.
+
+    for (size_t i = 0; i < GENERATOR_PRECISION_MODEL_COUNT; ++i) {
+        const auto &model = GENERATOR_PRECISION_MODELS[i];
+
+        SCOPED_TRACE(model.name);
+
+        auto expected = results(model.doubleCode);
+
+        {
+            SCOPED_TRACE("single");
+
+            expectNear(expected, results(model.singleCode));
+        }
+        {
+            SCOPED_TRACE("mixed");
+
+            expectNear(expected, results(model.mixedCode));
+        }
+    }
+}
+
+TEST(GeneratorPrecision, simdResults)
+{
+    // Check that each lane of the C SIMD version of our generator models gives
+    // the same results as their double-precision version, using different
+    // states for each lane. Vectorised maths functions may not be correctly
+    // rounded, hence we allow for a tiny difference.
+
+    static const double VOI = 10.25;
+
+    for (size_t i = 0; i < GENERATOR_SIMD_MODEL_COUNT; ++i) {
+        const auto &model = GENERATOR_SIMD_MODELS[i];
+
+        SCOPED_TRACE(model.name);
+
+        const GeneratorPrecisionCode *doubleCode = nullptr;
+
+        for (size_t j = 0; j < GENERATOR_PRECISION_MODEL_COUNT; ++j) {
+            if (std::string(GENERATOR_PRECISION_MODELS[j].name) == model.name) {
+                doubleCode = &GENERATOR_PRECISION_MODELS[j].doubleCode;
+            }
+        }
+
+        ASSERT_NE(nullptr, doubleCode);
+
+        auto laneCount = model.laneCount();
+        auto stateCount = doubleCode->stateCount();
+        auto variableCount = doubleCode->variableCount();
+        std::vector<double> states(laneCount * stateCount);
+        std::vector<double> rates(laneCount * stateCount);
+        std::vector<double> variables(laneCount * variableCount);
+
+        for (size_t lane = 0; lane < laneCount; ++lane) {
+            for (size_t j = 0; j < stateCount; ++j) {
+                states[lane * stateCount + j] = 0.05 + 0.1 * double(lane) + 0.01 * double(j);
+            }
+        }
+
+        model.compute(VOI, states.data(), rates.data(), variables.data());
+
+        for (size_t lane = 0; lane < laneCount; ++lane) {
+            SCOPED_TRACE(lane);
+
+            Results expected = {std::vector<double>(stateCount),
+                                std::vector<double>(variableCount)};
+
+            doubleCode->compute(VOI, states.data() + lane * stateCount, expected.rates.data(), expected.variables.data());
+
+            for (size_t j = 0; j < stateCount; ++j) {
+                EXPECT_NEAR(expected.rates[j], rates[lane * stateCount + j], 1.0e-12 * (1.0 + std::abs(expected.rates[j])));
+            }
+
+            for (size_t j = 0; j < variableCount; ++j) {
+                EXPECT_NEAR(expected.variables[j], variables[lane * variableCount + j], 1.0e-12 * (1.0 + std::abs(expected.variables[j])));
+            }
+        }
+    }
+}
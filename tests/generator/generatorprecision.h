@@ -0,0 +1,69 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The code generated for a model using a given precision, compiled as C. The
+ * model is computed from its initial states, or from the given states if they
+ * are not NULL. The results of that code are returned in double precision,
+ * whatever its precision.
+ */
+typedef struct
+{
+    size_t (*stateCount)(void);
+    size_t (*variableCount)(void);
+    void (*compute)(double voi, const double *states, double *rates, double *variables);
+} GeneratorPrecisionCode;
+
+/**
+ * The code generated for a model using double, single and mixed precision.
+ */
+typedef struct
+{
+    const char *name;
+    GeneratorPrecisionCode doubleCode;
+    GeneratorPrecisionCode singleCode;
+    GeneratorPrecisionCode mixedCode;
+} GeneratorPrecisionModel;
+
+/**
+ * The code generated for a model using the C SIMD profile, compiled as C. The
+ * states, rates and variables of its lanes are stored one lane after the
+ * other, e.g. state i of lane l is states[l * stateCount + i].
+ */
+typedef struct
+{
+    const char *name;
+    size_t (*laneCount)(void);
+    void (*compute)(double voi, const double *states, double *rates, double *variables);
+} GeneratorSimdModel;
+
+extern const GeneratorPrecisionModel GENERATOR_PRECISION_MODELS[];
+extern const size_t GENERATOR_PRECISION_MODEL_COUNT;
+
+extern const GeneratorSimdModel GENERATOR_SIMD_MODELS[];
+extern const size_t GENERATOR_SIMD_MODEL_COUNT;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/*
+ * Prefix the symbols of the code generated for a model with PREFIX, which must
+ * be defined before including this file, so that the code of all our generator
+ * models can be linked together.
+ */
+
+#define GENERATOR_CONCATENATE_(a, b) a##b
+#define GENERATOR_CONCATENATE(a, b) GENERATOR_CONCATENATE_(a, b)
+#define GENERATOR_PREFIXED(name) GENERATOR_CONCATENATE(PREFIX, name)
+
+#define VERSION GENERATOR_PREFIXED(VERSION)
+#define LIBCELLML_VERSION GENERATOR_PREFIXED(LIBCELLML_VERSION)
+#define STATE_COUNT GENERATOR_PREFIXED(STATE_COUNT)
+#define VARIABLE_COUNT GENERATOR_PREFIXED(VARIABLE_COUNT)
+#define VOI_INFO GENERATOR_PREFIXED(VOI_INFO)
+#define STATE_INFO GENERATOR_PREFIXED(STATE_INFO)
+#define VARIABLE_INFO GENERATOR_PREFIXED(VARIABLE_INFO)
+#define createStatesArray GENERATOR_PREFIXED(createStatesArray)
+#define createVariablesArray GENERATOR_PREFIXED(createVariablesArray)
+#define deleteArray GENERATOR_PREFIXED(deleteArray)
+#define initialiseStatesAndConstants GENERATOR_PREFIXED(initialiseStatesAndConstants)
+#define computeComputedConstants GENERATOR_PREFIXED(computeComputedConstants)
+#define computeRates GENERATOR_PREFIXED(computeRates)
+#define computeVariables GENERATOR_PREFIXED(computeVariables)
+#define xor GENERATOR_PREFIXED(xor)
+#define min GENERATOR_PREFIXED(min)
+#define max GENERATOR_PREFIXED(max)
+#define blend GENERATOR_PREFIXED(blend)
+#define sec GENERATOR_PREFIXED(sec)
+#define csc GENERATOR_PREFIXED(csc)
+#define cot GENERATOR_PREFIXED(cot)
+#define sech GENERATOR_PREFIXED(sech)
+#define csch GENERATOR_PREFIXED(csch)
+#define coth GENERATOR_PREFIXED(coth)
+#define asec GENERATOR_PREFIXED(asec)
+#define acsc GENERATOR_PREFIXED(acsc)
+#define acot GENERATOR_PREFIXED(acot)
+#define asech GENERATOR_PREFIXED(asech)
+#define acsch GENERATOR_PREFIXED(acsch)
+#define acoth GENERATOR_PREFIXED(acoth)
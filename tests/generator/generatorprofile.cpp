@@ -38,6 +38,7 @@ TEST(GeneratorProfile, defaultGeneralValues)
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
 
     EXPECT_EQ(libcellml::GeneratorProfile::Profile::C, generatorProfile->profile());
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->precision());
 
     EXPECT_EQ(true, generatorProfile->hasInterface());
 }
@@ -134,6 +135,10 @@ TEST(GeneratorProfile, defaultPiecewiseStatementValues)
     EXPECT_EQ("", generatorProfile->piecewiseElseString());
 
     EXPECT_EQ(true, generatorProfile->hasConditionalOperator());
+
+    EXPECT_EQ("blend(<CONDITION>, <IF_STATEMENT>, <ELSE_STATEMENT>)", generatorProfile->branchlessPiecewiseString());
+
+    EXPECT_EQ(false, generatorProfile->hasBranchlessPiecewise());
 }
 
 TEST(GeneratorProfile, defaultConstantValues)
@@ -146,6 +151,8 @@ TEST(GeneratorProfile, defaultConstantValues)
     EXPECT_EQ(convertToString(M_PI), generatorProfile->piString());
     EXPECT_EQ("INFINITY", generatorProfile->infString());
     EXPECT_EQ("NAN", generatorProfile->nanString());
+    EXPECT_EQ("", generatorProfile->realLiteralPrefixString());
+    EXPECT_EQ("", generatorProfile->realLiteralSuffixString());
 }
 
 TEST(GeneratorProfile, defaultArithmeticFunctionValues)
@@ -176,6 +183,11 @@ TEST(GeneratorProfile, defaultArithmeticFunctionValues)
               "    return (x > y)?x:y;\n"
               "}\n",
               generatorProfile->maxFunctionString());
+    EXPECT_EQ("double blend(double condition, double x, double y)\n"
+              "{\n"
+              "    return (condition != 0.0)?x:y;\n"
+              "}\n",
+              generatorProfile->blendFunctionString());
 }
 
 TEST(GeneratorProfile, defaultTrigonometricFunctionValues)
@@ -268,6 +280,7 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "#include <math.h>\n"
               "#include <stdlib.h>\n",
               generatorProfile->implementationHeaderString());
+    EXPECT_EQ("", generatorProfile->implementationFooterString());
 
     EXPECT_EQ("extern const char VERSION[];\n", generatorProfile->interfaceVersionString());
     EXPECT_EQ("const char VERSION[] = \"0.2.0\";\n", generatorProfile->implementationVersionString());
@@ -414,13 +427,19 @@ TEST(GeneratorProfile, generalSettings)
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
 
     const libcellml::GeneratorProfile::Profile profile = libcellml::GeneratorProfile::Profile::PYTHON;
+    const libcellml::GeneratorProfile::Precision precision = libcellml::GeneratorProfile::Precision::SINGLE;
     const bool falseValue = false;
 
+    EXPECT_TRUE(generatorProfile->setPrecision(precision));
+
     generatorProfile->setProfile(profile);
 
+    EXPECT_FALSE(generatorProfile->setPrecision(precision));
+
     generatorProfile->setHasInterface(falseValue);
 
     EXPECT_EQ(profile, generatorProfile->profile());
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->precision());
 
     EXPECT_EQ(falseValue, generatorProfile->hasInterface());
 }
@@ -589,6 +608,7 @@ TEST(GeneratorProfile, piecewiseStatement)
 
     const std::string value = "value";
     const bool falseValue = true;
+    const bool trueValue = true;
 
     generatorProfile->setConditionalOperatorIfString(value);
     generatorProfile->setConditionalOperatorElseString(value);
@@ -597,12 +617,20 @@ TEST(GeneratorProfile, piecewiseStatement)
 
     generatorProfile->setHasConditionalOperator(falseValue);
 
+    generatorProfile->setBranchlessPiecewiseString(value);
+
+    generatorProfile->setHasBranchlessPiecewise(trueValue);
+
     EXPECT_EQ(value, generatorProfile->conditionalOperatorIfString());
     EXPECT_EQ(value, generatorProfile->conditionalOperatorElseString());
     EXPECT_EQ(value, generatorProfile->piecewiseIfString());
     EXPECT_EQ(value, generatorProfile->piecewiseElseString());
 
     EXPECT_EQ(falseValue, generatorProfile->hasConditionalOperator());
+
+    EXPECT_EQ(value, generatorProfile->branchlessPiecewiseString());
+
+    EXPECT_EQ(trueValue, generatorProfile->hasBranchlessPiecewise());
 }
 
 TEST(GeneratorProfile, constants)
@@ -617,6 +645,8 @@ TEST(GeneratorProfile, constants)
     generatorProfile->setPiString(value);
     generatorProfile->setInfString(value);
     generatorProfile->setNanString(value);
+    generatorProfile->setRealLiteralPrefixString(value);
+    generatorProfile->setRealLiteralSuffixString(value);
 
     EXPECT_EQ(value, generatorProfile->trueString());
     EXPECT_EQ(value, generatorProfile->falseString());
@@ -624,6 +654,59 @@ TEST(GeneratorProfile, constants)
     EXPECT_EQ(value, generatorProfile->piString());
     EXPECT_EQ(value, generatorProfile->infString());
     EXPECT_EQ(value, generatorProfile->nanString());
+    EXPECT_EQ(value, generatorProfile->realLiteralPrefixString());
+    EXPECT_EQ(value, generatorProfile->realLiteralSuffixString());
+}
+
+TEST(GeneratorProfile, singlePrecision)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ("expf", generatorProfile->exponentialString());
+    EXPECT_EQ("1.0f", generatorProfile->trueString());
+    EXPECT_EQ("f", generatorProfile->realLiteralSuffixString());
+    EXPECT_EQ("float sec(float x)\n"
+              "{\n"
+              "    return 1.0f/cosf(x);\n"
+              "}\n",
+              generatorProfile->secFunctionString());
+    EXPECT_EQ("void computeRates(float voi, float *states, float *rates, float *variables<OPTIONAL_PARAMETER>);\n",
+              generatorProfile->interfaceComputeRatesMethodString());
+
+    // Going back to double precision restores the original settings.
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->realLiteralSuffixString());
+}
+
+TEST(GeneratorProfile, mixedPrecision)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->realLiteralSuffixString());
+    EXPECT_EQ("void computeRates(double voi, float *states, float *rates, double *variables<OPTIONAL_PARAMETER>);\n",
+              generatorProfile->interfaceComputeRatesMethodString());
+    EXPECT_EQ("void deleteArray(void *array);\n", generatorProfile->interfaceDeleteArrayMethodString());
+}
+
+TEST(GeneratorProfile, precisionOfNonCProfile)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_FALSE(generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE));
+    EXPECT_FALSE(generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED));
+    EXPECT_TRUE(generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE));
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->precision());
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->realLiteralSuffixString());
 }
 
 TEST(GeneratorProfile, arithmeticFunctions)
@@ -644,6 +727,7 @@ TEST(GeneratorProfile, arithmeticFunctions)
     generatorProfile->setNotFunctionString(value);
     generatorProfile->setMinFunctionString(value);
     generatorProfile->setMaxFunctionString(value);
+    generatorProfile->setBlendFunctionString(value);
 
     EXPECT_EQ(value, generatorProfile->eqFunctionString());
     EXPECT_EQ(value, generatorProfile->neqFunctionString());
@@ -657,6 +741,7 @@ TEST(GeneratorProfile, arithmeticFunctions)
     EXPECT_EQ(value, generatorProfile->notFunctionString());
     EXPECT_EQ(value, generatorProfile->minFunctionString());
     EXPECT_EQ(value, generatorProfile->maxFunctionString());
+    EXPECT_EQ(value, generatorProfile->blendFunctionString());
 }
 
 TEST(GeneratorProfile, trigonometricFunctions)
@@ -705,6 +790,7 @@ TEST(GeneratorProfile, miscellaneous)
 
     generatorProfile->setInterfaceHeaderString(value);
     generatorProfile->setImplementationHeaderString(value);
+    generatorProfile->setImplementationFooterString(value);
 
     generatorProfile->setInterfaceVersionString(value);
     generatorProfile->setImplementationVersionString(value);
@@ -795,6 +881,7 @@ TEST(GeneratorProfile, miscellaneous)
 
     EXPECT_EQ(value, generatorProfile->interfaceHeaderString());
     EXPECT_EQ(value, generatorProfile->implementationHeaderString());
+    EXPECT_EQ(value, generatorProfile->implementationFooterString());
 
     EXPECT_EQ(value, generatorProfile->interfaceVersionString());
     EXPECT_EQ(value, generatorProfile->implementationVersionString());
@@ -5,5 +5,145 @@ list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
 
 set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/generator.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorprecision.cpp
   ${CMAKE_CURRENT_LIST_DIR}/generatorprofile.cpp
 )
+set(${CURRENT_TEST}_HDRS
+  ${CMAKE_CURRENT_LIST_DIR}/generatorprecision.h
+  ${CMAKE_CURRENT_LIST_DIR}/generatorprefix.h
+)
+set(${CURRENT_TEST}_LIBS
+  generator_precision_models
+)
+
+# Compile the double-, single- and mixed-precision code of our generator models
+# as C, one object per model and precision, so that we can compare their
+# results. The symbols of each object are prefixed with the name of its model
+# and its precision.
+
+enable_language(C)
+
+set(GENERATOR_PRECISION_MODELS
+  algebraic_eqn_computed_var_on_rhs
+  algebraic_eqn_const_var_on_rhs
+  algebraic_eqn_constant_on_rhs
+  algebraic_eqn_derivative_on_rhs
+  algebraic_eqn_derivative_on_rhs_one_component
+  algebraic_eqn_state_var_on_rhs
+  algebraic_eqn_state_var_on_rhs_one_component
+  branchless_piecewise
+  cellml_mappings_and_encapsulations
+  cellml_state_initialised_using_variable
+  cellml_unit_scaling_constant
+  cellml_unit_scaling_rate
+  cellml_unit_scaling_state
+  cellml_unit_scaling_state_initialised_using_constant
+  cellml_unit_scaling_state_initialised_using_variable
+  cellml_unit_scaling_voi_direct
+  cellml_unit_scaling_voi_indirect
+  coverage
+  dependent_eqns
+  fabbri_fantini_wilders_severi_human_san_model_2017
+  garny_kohl_hunter_boyett_noble_rabbit_san_model_2003
+  hodgkin_huxley_squid_axon_model_1952
+  noble_model_1962
+  ode_computed_var_on_rhs
+  ode_computed_var_on_rhs_one_component
+  ode_const_var_on_rhs
+  ode_const_var_on_rhs_one_component
+  ode_constant_on_rhs
+  ode_constant_on_rhs_one_component
+  ode_multiple_dependent_odes
+  ode_multiple_dependent_odes_one_component
+  ode_multiple_odes_with_same_name
+  sine_model_imports
+)
+
+set(GENERATOR_PRECISION_SRCS)
+set(GENERATOR_PRECISION_DECLARATIONS)
+set(GENERATOR_PRECISION_ENTRIES)
+
+foreach(MODEL ${GENERATOR_PRECISION_MODELS})
+  foreach(PRECISION double single mixed)
+    set(PREFIX ${MODEL}_${PRECISION}_)
+
+    if(PRECISION STREQUAL "double")
+      set(MODEL_FILE ${CMAKE_CURRENT_LIST_DIR}/../resources/generator/${MODEL}/model.c)
+      set(STATE_TYPE double)
+      set(VARIABLE_TYPE double)
+      set(VOI_TYPE double)
+    elseif(PRECISION STREQUAL "single")
+      set(MODEL_FILE ${CMAKE_CURRENT_LIST_DIR}/../resources/generator/${MODEL}/model.single.c)
+      set(STATE_TYPE float)
+      set(VARIABLE_TYPE float)
+      set(VOI_TYPE float)
+    else()
+      set(MODEL_FILE ${CMAKE_CURRENT_LIST_DIR}/../resources/generator/${MODEL}/model.mixed.c)
+      set(STATE_TYPE float)
+      set(VARIABLE_TYPE double)
+      set(VOI_TYPE double)
+    endif()
+
+    set(GENERATOR_PRECISION_SRC ${CMAKE_CURRENT_BINARY_DIR}/generator/${MODEL}.${PRECISION}.c)
+
+    configure_file(${CMAKE_CURRENT_LIST_DIR}/generatorprecisionmodel.c.in ${GENERATOR_PRECISION_SRC} @ONLY)
+
+    list(APPEND GENERATOR_PRECISION_SRCS ${GENERATOR_PRECISION_SRC})
+  endforeach()
+
+  string(APPEND GENERATOR_PRECISION_DECLARATIONS "DECLARE_MODEL(${MODEL})\n")
+  string(APPEND GENERATOR_PRECISION_ENTRIES "    MODEL(${MODEL}),\n")
+endforeach()
+
+# Compile the C SIMD code of our generator models, with OpenMP SIMD support if
+# available, so that we can compare its lanes with the double-precision code.
+
+set(GENERATOR_SIMD_MODELS
+  hodgkin_huxley_squid_axon_model_1952
+)
+
+include(CheckCCompilerFlag)
+
+check_c_compiler_flag(-fopenmp-simd HAVE_FOPENMP_SIMD_FLAG)
+
+if(HAVE_FOPENMP_SIMD_FLAG)
+  set(GENERATOR_SIMD_COMPILE_OPTIONS -fopenmp-simd)
+elseif(NOT MSVC)
+  set(GENERATOR_SIMD_COMPILE_OPTIONS -Wno-unknown-pragmas)
+endif()
+
+set(GENERATOR_SIMD_DECLARATIONS)
+set(GENERATOR_SIMD_ENTRIES)
+
+foreach(MODEL ${GENERATOR_SIMD_MODELS})
+  set(PREFIX ${MODEL}_simd_)
+  set(MODEL_FILE ${CMAKE_CURRENT_LIST_DIR}/../resources/generator/${MODEL}/model.simd.c)
+  set(GENERATOR_SIMD_SRC ${CMAKE_CURRENT_BINARY_DIR}/generator/${MODEL}.simd.c)
+
+  configure_file(${CMAKE_CURRENT_LIST_DIR}/generatorsimdmodel.c.in ${GENERATOR_SIMD_SRC} @ONLY)
+  set_source_files_properties(${GENERATOR_SIMD_SRC} PROPERTIES COMPILE_OPTIONS "${GENERATOR_SIMD_COMPILE_OPTIONS}")
+
+  list(APPEND GENERATOR_PRECISION_SRCS ${GENERATOR_SIMD_SRC})
+
+  string(APPEND GENERATOR_SIMD_DECLARATIONS "DECLARE_SIMD_MODEL(${MODEL})\n")
+  string(APPEND GENERATOR_SIMD_ENTRIES "    SIMD_MODEL(${MODEL}),\n")
+endforeach()
+
+set(GENERATOR_PRECISION_SRC ${CMAKE_CURRENT_BINARY_DIR}/generator/generatorprecisionmodels.c)
+
+configure_file(${CMAKE_CURRENT_LIST_DIR}/generatorprecisionmodels.c.in ${GENERATOR_PRECISION_SRC} @ONLY)
+
+add_library(generator_precision_models STATIC ${GENERATOR_PRECISION_SRCS} ${GENERATOR_PRECISION_SRC})
+target_include_directories(generator_precision_models PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+set_target_properties(generator_precision_models PROPERTIES FOLDER tests)
+
+if(NOT MSVC)
+  target_link_libraries(generator_precision_models PRIVATE m)
+endif()
+
+if(CMAKE_C_COMPILER_ID STREQUAL "GNU")
+  # The coverage model has some constants that are too large for single
+  # precision.
+
+  target_compile_options(generator_precision_models PRIVATE -Wno-overflow)
+endif()
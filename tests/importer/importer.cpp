@@ -16,6 +16,14 @@ limitations under the License->
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <libcellml>
 
 #include "test_utils.h"
@@ -1021,3 +1029,742 @@ TEST(Importer, isResolvedCircularImport)
 
     EXPECT_FALSE(u->isResolved());
 }
+
+TEST(Importer, resolveImportsFromSeveralFiles)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"several_files\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"diamond_left.cellml\">\n"
+        "    <component component_ref=\"left\" name=\"left\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"missing_file.cellml\">\n"
+        "    <component component_ref=\"missing\" name=\"missing\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"diamond_right.cellml\">\n"
+        "    <component component_ref=\"nope\" name=\"nope\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+    const std::vector<std::string> expectedIssues = {
+        "The attempt to resolve imports with the model at '" + resourcePath("importer/missing_file.cellml") + "' failed: the file could not be opened.",
+        "Import of component 'nope' from 'diamond_right.cellml' requires component named 'nope' which cannot be found.",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(in);
+    auto importer = libcellml::Importer::create();
+
+    // All the files are read and parsed up front, but we should only keep the
+    // ones that we need, and get the same issues as if we had read and parsed
+    // the files one at a time.
+
+    EXPECT_FALSE(importer->resolveImports(model, resourcePath("importer/")));
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_EQ(resourcePath("importer/diamond_left.cellml"), importer->key(0));
+    EXPECT_EQ(resourcePath("importer/diamond_point.cellml"), importer->key(1));
+    EXPECT_EQ(resourcePath("importer/diamond_right.cellml"), importer->key(2));
+}
+
+TEST(Importer, resolveImportsUsingMemoryLoader)
+{
+    const std::vector<std::string> expectedIssues = {
+        "The attempt to resolve imports with the model at 'models/diamond_right.cellml' failed: the file could not be opened.",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(libcellml::Importer::memoryLoader({
+        {"models/diamond_left.cellml", fileContents("importer/diamond_left.cellml")},
+        {"models/diamond_point.cellml", fileContents("importer/diamond_point.cellml")},
+    }));
+
+    EXPECT_FALSE(importer->resolveImports(model, "models/diamond.cellml"));
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+    EXPECT_EQ(size_t(2), importer->libraryCount());
+    EXPECT_EQ("models/diamond_left.cellml", importer->key(0));
+    EXPECT_EQ("models/diamond_point.cellml", importer->key(1));
+
+    // Setting an empty loader is an error and keeps our memory loader.
+
+    const std::vector<std::string> expectedEmptyLoaderIssues = {
+        "The loader is empty.",
+    };
+
+    importer->removeAllIssues();
+    importer->setLoader(nullptr);
+
+    EXPECT_EQ_ISSUES(expectedEmptyLoaderIssues, importer);
+
+    importer->removeAllIssues();
+    importer->clearImports(model);
+
+    EXPECT_FALSE(importer->resolveImports(model, "models/diamond.cellml"));
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+
+    // Going back to our file loader reads the files from local disk.
+
+    importer->removeAllIssues();
+    importer->setLoader(libcellml::Importer::fileLoader());
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/diamond.cellml")));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+}
+
+TEST(Importer, resolveImportsUsingArchiveLoader)
+{
+    auto parser = libcellml::Parser::create();
+    auto loader = libcellml::Importer::archiveLoader(resourcePath("importer/diamond.tar"));
+    std::string contents;
+
+    EXPECT_TRUE(loader("diamond/diamond.cellml", contents));
+    EXPECT_EQ(fileContents("importer/diamond.cellml"), contents);
+    EXPECT_FALSE(loader("diamond/missing_file.cellml", contents));
+
+    auto model = parser->parseModel(contents);
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(loader);
+
+    EXPECT_TRUE(importer->resolveImports(model, "diamond/diamond.cellml"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_EQ("diamond/diamond_left.cellml", importer->key(0));
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_NE(nullptr, flatModel);
+    EXPECT_FALSE(flatModel->hasImports());
+}
+
+TEST(Importer, resolveImportsUsingPaxArchiveLoader)
+{
+    const std::string directory = "diamond_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long_long";
+
+    auto parser = libcellml::Parser::create();
+    auto loader = libcellml::Importer::archiveLoader(resourcePath("importer/diamond_pax.tar"));
+    std::string contents;
+
+    EXPECT_TRUE(loader(directory + "/diamond.cellml", contents));
+    EXPECT_EQ(fileContents("importer/diamond.cellml"), contents);
+
+    auto model = parser->parseModel(contents);
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(loader);
+
+    EXPECT_TRUE(importer->resolveImports(model, directory + "/diamond.cellml"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+}
+
+TEST(Importer, resolveImportsUsingArchiveLoaderWithBase256Sizes)
+{
+    // Rewrite the size of each entry of our archive in base-256, as done by GNU
+    // tar for files that are too large for an octal size.
+
+    static const size_t BLOCK_SIZE = 512;
+
+    auto archive = std::filesystem::temp_directory_path() / "libcellml_base256_archive.tar";
+    auto contents = fileContents("importer/diamond.tar");
+    auto rewriteSizes = [&](bool negative) {
+        auto res = contents;
+        size_t offset = 0;
+        while ((offset + BLOCK_SIZE <= res.size()) && (res[offset] != '\0')) {
+            auto header = &res[offset];
+            auto size = size_t(std::stoul(std::string(header + 124, 11), nullptr, 8));
+            for (size_t i = 0; i < 12; ++i) {
+                header[124 + i] = (i < 4) ? '\0' : static_cast<char>((size >> (8 * (11 - i))) & 0xff);
+            }
+            header[124] = static_cast<char>(negative ? 0xff : 0x80);
+            size_t checksum = 0;
+            for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+                checksum += ((i >= 148) && (i < 156)) ? size_t(' ') : size_t(static_cast<unsigned char>(header[i]));
+            }
+            snprintf(header + 148, 8, "%06o", static_cast<unsigned int>(checksum));
+            offset += BLOCK_SIZE + (size + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+        }
+        return res;
+    };
+
+    std::ofstream(archive, std::ios::binary) << rewriteSizes(false);
+
+    auto parser = libcellml::Parser::create();
+    auto loader = libcellml::Importer::archiveLoader(archive.string());
+
+    ASSERT_TRUE(loader);
+    EXPECT_TRUE(loader("diamond/diamond.cellml", contents));
+    EXPECT_EQ(fileContents("importer/diamond.cellml"), contents);
+
+    auto model = parser->parseModel(contents);
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(loader);
+
+    EXPECT_TRUE(importer->resolveImports(model, "diamond/diamond.cellml"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+
+    // Negative base-256 sizes are rejected.
+
+    contents = fileContents("importer/diamond.tar");
+
+    std::ofstream(archive, std::ios::binary) << rewriteSizes(true);
+
+    EXPECT_FALSE(libcellml::Importer::archiveLoader(archive.string()));
+
+    std::filesystem::remove(archive);
+}
+
+TEST(Importer, archiveLoaderWithMissingArchive)
+{
+    auto loader = libcellml::Importer::archiveLoader(resourcePath("importer/missing_file.tar"));
+
+    EXPECT_FALSE(loader);
+}
+
+TEST(Importer, archiveLoaderWithInvalidArchive)
+{
+    auto loader = libcellml::Importer::archiveLoader(resourcePath("importer/diamond.cellml"));
+
+    EXPECT_FALSE(loader);
+}
+
+TEST(Importer, archiveLoaderWithTruncatedArchive)
+{
+    auto archive = std::filesystem::temp_directory_path() / "libcellml_truncated_archive.tar";
+    auto contents = fileContents("importer/diamond.tar");
+
+    std::ofstream(archive, std::ios::binary) << contents.substr(0, 1000);
+
+    auto loader = libcellml::Importer::archiveLoader(archive.string());
+
+    EXPECT_FALSE(loader);
+
+    std::ofstream(archive, std::ios::binary) << contents.substr(0, 2048);
+
+    loader = libcellml::Importer::archiveLoader(archive.string());
+
+    EXPECT_FALSE(loader);
+
+    std::filesystem::remove(archive);
+}
+
+TEST(Importer, resolveImportsUsingCache)
+{
+    auto cacheDirectory = std::filesystem::temp_directory_path() / "libcellml_importer_cache";
+
+    std::filesystem::remove_all(cacheDirectory);
+    std::filesystem::create_directories(cacheDirectory);
+
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto importer = libcellml::Importer::create();
+
+    EXPECT_EQ("", importer->cacheDirectory());
+
+    importer->setCacheDirectory(cacheDirectory.string());
+
+    EXPECT_EQ(cacheDirectory.string(), importer->cacheDirectory());
+
+    // Populate our cache.
+
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+
+    auto flatModel = printer->printModel(importer->flattenModel(model));
+    size_t cacheEntryCount = 0;
+
+    for (const auto &entry : std::filesystem::directory_iterator(cacheDirectory)) {
+        EXPECT_EQ(".cellmlb", entry.path().extension().string());
+
+        ++cacheEntryCount;
+    }
+
+    EXPECT_EQ(size_t(3), cacheEntryCount);
+
+    // Use our cache, after having corrupted one of its entries, which should
+    // result in that entry being recreated.
+
+    std::ofstream(std::filesystem::directory_iterator(cacheDirectory)->path(), std::ios::binary) << "Corrupted cache entry";
+
+    for (size_t i = 0; i < 2; ++i) {
+        importer = libcellml::Importer::create();
+
+        importer->setCacheDirectory(cacheDirectory.string());
+
+        model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+        EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+        EXPECT_EQ(size_t(0), importer->issueCount());
+        EXPECT_EQ(flatModel, printer->printModel(importer->flattenModel(model)));
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+TEST(Importer, resolveAndFlattenSharedImports)
+{
+    // Both sides of the diamond import the same component under the same
+    // name, which must not be mistaken for a cyclic dependency.
+
+    const std::string side =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"side\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"point.cellml\">\n"
+        "    <component component_ref=\"point\" name=\"point\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"point.cellml\">\n"
+        "    <units units_ref=\"point_units\" name=\"point_units\"/>\n"
+        "  </import>\n"
+        "  <component name=\"side\">\n"
+        "    <variable name=\"x\" units=\"point_units\"/>\n"
+        "  </component>\n"
+        "  <encapsulation>\n"
+        "    <component_ref component=\"side\">\n"
+        "      <component_ref component=\"point\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "</model>\n";
+    const std::string point =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"point\">\n"
+        "  <units name=\"point_units\">\n"
+        "    <unit units=\"second\"/>\n"
+        "  </units>\n"
+        "  <component name=\"point\">\n"
+        "    <variable name=\"y\" units=\"point_units\"/>\n"
+        "  </component>\n"
+        "</model>\n";
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"diamond\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"left.cellml\">\n"
+        "    <component component_ref=\"side\" name=\"left\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"right.cellml\">\n"
+        "    <component component_ref=\"side\" name=\"right\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(in);
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(libcellml::Importer::memoryLoader({
+        {"left.cellml", side},
+        {"right.cellml", side},
+        {"point.cellml", point},
+    }));
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_NE(nullptr, flatModel);
+    EXPECT_FALSE(flatModel->hasImports());
+}
+
+TEST(Importer, resolveImportsLazily)
+{
+    const std::vector<std::string> expectedIssues = {
+        "The attempt to resolve imports with the model at 'missing_file.cellml' failed: the file could not be opened.",
+    };
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"lazy\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"diamond_left.cellml\">\n"
+        "    <component component_ref=\"left\" name=\"left\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"diamond_right.cellml\">\n"
+        "    <component component_ref=\"right\" name=\"right\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"missing_file.cellml\">\n"
+        "    <component component_ref=\"missing\" name=\"missing\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(in);
+    auto importer = libcellml::Importer::create();
+    auto memoryLoader = libcellml::Importer::memoryLoader({
+        {"diamond_left.cellml", fileContents("importer/diamond_left.cellml")},
+        {"diamond_right.cellml", fileContents("importer/diamond_right.cellml")},
+        {"diamond_point.cellml", fileContents("importer/diamond_point.cellml")},
+    });
+    std::vector<std::string> loadedFiles;
+
+    importer->setLoader([&](const std::string &url, std::string &contents) {
+        loadedFiles.push_back(url);
+        return memoryLoader(url, contents);
+    });
+
+    EXPECT_FALSE(importer->lazyResolution());
+
+    importer->setLazyResolution(true);
+
+    EXPECT_TRUE(importer->lazyResolution());
+
+    // Nothing gets loaded until it is needed.
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(0), importer->libraryCount());
+    EXPECT_EQ(std::vector<std::string>(), loadedFiles);
+
+    // Testing whether an import source has a model doesn't load it.
+
+    EXPECT_FALSE(model->component("left")->importSource()->hasModel());
+    EXPECT_EQ(std::vector<std::string>(), loadedFiles);
+
+    auto leftModel = model->component("left")->importSource()->model();
+
+    ASSERT_NE(nullptr, leftModel);
+    EXPECT_TRUE(model->component("left")->importSource()->hasModel());
+    EXPECT_EQ("diamond_left", leftModel->name());
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml"}), loadedFiles);
+
+    auto pointModel = leftModel->component("left")->importSource()->model();
+
+    ASSERT_NE(nullptr, pointModel);
+    EXPECT_EQ("pointyBitModel", pointModel->name());
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml", "diamond_point.cellml"}), loadedFiles);
+
+    // Issues get reported when a model that cannot be loaded is needed, and
+    // only then.
+
+    EXPECT_EQ(nullptr, model->component("missing")->importSource()->model());
+    EXPECT_EQ(nullptr, model->component("missing")->importSource()->model());
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml", "diamond_point.cellml", "missing_file.cellml"}), loadedFiles);
+
+    // Models that have already been loaded get reused.
+
+    EXPECT_EQ(pointModel, model->component("right")->importSource()->model()->component("right")->importSource()->model());
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml", "diamond_point.cellml", "missing_file.cellml", "diamond_right.cellml"}), loadedFiles);
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+}
+
+TEST(Importer, resolveImportsOnlyReadsNeededFiles)
+{
+    // The library model imports some component and units which our model
+    // doesn't need, so the files that they come from are not read.
+
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"library.cellml\">\n"
+        "    <component component_ref=\"used\" name=\"used\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+    const std::string library =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"library\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"used_units.cellml\">\n"
+        "    <units units_ref=\"used_units\" name=\"used_units\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"unused_units.cellml\">\n"
+        "    <units units_ref=\"unused_units\" name=\"unused_units\"/>\n"
+        "  </import>\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"unused_component.cellml\">\n"
+        "    <component component_ref=\"unused\" name=\"unused\"/>\n"
+        "  </import>\n"
+        "  <component name=\"used\">\n"
+        "    <variable name=\"x\" units=\"used_units\" interface=\"public_and_private\"/>\n"
+        "  </component>\n"
+        "</model>\n";
+    const std::string usedUnits =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"used_units\">\n"
+        "  <units name=\"used_units\">\n"
+        "    <unit units=\"second\"/>\n"
+        "  </units>\n"
+        "</model>\n";
+    const std::string unusedUnits =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"unused_units\">\n"
+        "  <units name=\"unused_units\">\n"
+        "    <unit units=\"metre\"/>\n"
+        "  </units>\n"
+        "</model>\n";
+    const std::string unusedComponent =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"unused_component\">\n"
+        "  <component name=\"unused\"/>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(in);
+    auto importer = libcellml::Importer::create();
+    auto memoryLoader = libcellml::Importer::memoryLoader({
+        {"library.cellml", library},
+        {"used_units.cellml", usedUnits},
+        {"unused_units.cellml", unusedUnits},
+        {"unused_component.cellml", unusedComponent},
+    });
+    std::mutex loadedFilesMutex;
+    std::set<std::string> loadedFiles;
+
+    importer->setLoader([&](const std::string &url, std::string &contents) {
+        std::lock_guard<std::mutex> lock(loadedFilesMutex);
+        loadedFiles.insert(url);
+        return memoryLoader(url, contents);
+    });
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(std::set<std::string>({"library.cellml", "used_units.cellml"}), loadedFiles);
+    EXPECT_EQ(size_t(2), importer->libraryCount());
+}
+
+TEST(Importer, resolveImportsLazilyAndFlatten)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto importer = libcellml::Importer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+
+    auto flatModel = printer->printModel(importer->flattenModel(model));
+
+    importer = libcellml::Importer::create();
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+    importer->setLazyResolution(true);
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+    EXPECT_EQ(size_t(0), importer->libraryCount());
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+    EXPECT_EQ(flatModel, printer->printModel(importer->flattenModel(model)));
+}
+
+TEST(Importer, resolveImportsLazilyFromSeveralThreads)
+{
+    auto parser = libcellml::Parser::create();
+    auto importer = libcellml::Importer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    std::atomic<size_t> loadedFileCount(0);
+    auto fileLoader = libcellml::Importer::fileLoader();
+
+    importer->setLoader([&](const std::string &url, std::string &contents) {
+        ++loadedFileCount;
+        return fileLoader(url, contents);
+    });
+    importer->setLazyResolution(true);
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+
+    const size_t threadCount = 8;
+    std::vector<libcellml::ModelPtr> pointModels(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            auto component = model->component((i % 2 == 0) ? "left" : "right");
+            pointModels[i] = component->importSource()->model()->component(component->name())->importSource()->model();
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (const auto &pointModel : pointModels) {
+        ASSERT_NE(nullptr, pointModel);
+        EXPECT_EQ(pointModels[0], pointModel);
+    }
+
+    EXPECT_EQ(size_t(3), loadedFileCount);
+    EXPECT_EQ(size_t(0), importer->issueCount());
+}
+
+TEST(Importer, resolveImportsLazilyAndDeleteImporter)
+{
+    auto parser = libcellml::Parser::create();
+    auto importer = libcellml::Importer::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+
+    importer->setLazyResolution(true);
+
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+
+    importer = nullptr;
+
+    EXPECT_EQ(nullptr, model->component("left")->importSource()->model());
+}
+
+TEST(Importer, dependencyGraphAndInvalidation)
+{
+    const std::string newPoint =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"pointyBitModel\">\n"
+        "  <component name=\"pointyBit\">\n"
+        "    <variable name=\"x\" units=\"second\"/>\n"
+        "  </component>\n"
+        "</model>\n";
+    const std::vector<std::string> expectedMissingComponentIssues = {
+        "Import of component 'left' from 'diamond_point.cellml' requires component named 'pointyBit' which cannot be found.",
+        "Import of component 'right' from 'diamond_point.cellml' requires component named 'pointyBit' which cannot be found.",
+    };
+    const std::vector<std::string> expectedIssues = {
+        "The attempt to invalidate the model at 'diamond_point.cellml' failed: the file could not be opened.",
+    };
+
+    std::map<std::string, std::string> files = {
+        {"diamond_left.cellml", fileContents("importer/diamond_left.cellml")},
+        {"diamond_right.cellml", fileContents("importer/diamond_right.cellml")},
+        {"diamond_point.cellml", fileContents("importer/diamond_point.cellml")},
+    };
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader([&](const std::string &url, std::string &contents) {
+        auto file = files.find(url);
+        if (file == files.end()) {
+            return false;
+        }
+        contents = file->second;
+        return true;
+    });
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+
+    EXPECT_EQ(std::vector<std::string>({"diamond_point.cellml"}), importer->dependencies("diamond_left.cellml"));
+    EXPECT_EQ(std::vector<std::string>({"diamond_point.cellml"}), importer->dependencies("diamond_right.cellml"));
+    EXPECT_EQ(std::vector<std::string>(), importer->dependencies("diamond_point.cellml"));
+    EXPECT_EQ(std::vector<std::string>(), importer->dependencies("unknown.cellml"));
+    EXPECT_EQ(std::vector<std::string>(), importer->dependants("diamond_left.cellml"));
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml", "diamond_right.cellml"}), importer->dependants("diamond_point.cellml"));
+
+    // Change a file that is imported by other files and invalidate it.
+
+    auto oldPointModel = importer->library("diamond_point.cellml");
+
+    files["diamond_point.cellml"] = newPoint;
+
+    EXPECT_FALSE(importer->invalidate("unknown.cellml"));
+    EXPECT_TRUE(importer->invalidate("diamond_point.cellml"));
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    EXPECT_EQ(size_t(3), importer->libraryCount());
+
+    auto pointModel = importer->library("diamond_point.cellml");
+
+    EXPECT_NE(oldPointModel, pointModel);
+    EXPECT_EQ(pointModel, importer->library("diamond_left.cellml")->importSource(0)->model());
+    EXPECT_EQ(pointModel, importer->library("diamond_right.cellml")->importSource(0)->model());
+    EXPECT_EQ(std::vector<std::string>({"diamond_left.cellml", "diamond_right.cellml"}), importer->dependants("diamond_point.cellml"));
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(1), flatModel->component("left")->variableCount());
+    EXPECT_EQ(size_t(1), flatModel->component("right")->variableCount());
+
+    // Invalidate a file that doesn't provide the imported component anymore.
+
+    files["diamond_point.cellml"] =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"pointyBitModel\">\n"
+        "  <component name=\"bluntBit\"/>\n"
+        "</model>\n";
+
+    EXPECT_FALSE(importer->invalidate("diamond_point.cellml"));
+    EXPECT_EQ_ISSUES(expectedMissingComponentIssues, importer);
+
+    // Invalidate a file that cannot be read anymore.
+
+    files["diamond_point.cellml"] = newPoint;
+
+    EXPECT_TRUE(importer->invalidate("diamond_point.cellml"));
+
+    pointModel = importer->library("diamond_point.cellml");
+
+    importer->removeAllIssues();
+    files.erase("diamond_point.cellml");
+
+    EXPECT_FALSE(importer->invalidate("diamond_point.cellml"));
+    EXPECT_EQ_ISSUES(expectedIssues, importer);
+    EXPECT_EQ(pointModel, importer->library("diamond_point.cellml"));
+}
+
+TEST(Importer, statistics)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    // No statistics are recorded by default.
+
+    EXPECT_FALSE(importer->statisticsEnabled());
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+    EXPECT_EQ(size_t(0), importer->statisticsCount());
+
+    // Record statistics while resolving and flattening imports.
+
+    model = parser->parseModel(fileContents("importer/diamond.cellml"));
+    importer = libcellml::Importer::create();
+    importer->setStatisticsEnabled(true);
+
+    EXPECT_TRUE(importer->statisticsEnabled());
+    EXPECT_TRUE(importer->resolveImports(model, resourcePath("importer/")));
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_NE(nullptr, flatModel);
+    EXPECT_EQ(size_t(3), importer->statisticsCount());
+
+    auto left = importer->statistics(resourcePath("importer/diamond_left.cellml"));
+    auto right = importer->statistics(resourcePath("importer/diamond_right.cellml"));
+    auto point = importer->statistics(resourcePath("importer/diamond_point.cellml"));
+
+    EXPECT_EQ(left, importer->statistics(0));
+    EXPECT_EQ(point, importer->statistics(1));
+    EXPECT_EQ(right, importer->statistics(2));
+    EXPECT_EQ(nullptr, importer->statistics(3));
+    EXPECT_EQ(nullptr, importer->statistics("unknown.cellml"));
+
+    EXPECT_EQ(resourcePath("importer/diamond_left.cellml"), left->key());
+    EXPECT_EQ(fileContents("importer/diamond_left.cellml").size(), left->bytesRead());
+    EXPECT_LE(0.0, left->parseTime());
+    EXPECT_EQ(size_t(0), left->cacheHitCount());
+    EXPECT_EQ(size_t(1), left->cacheMissCount());
+    EXPECT_EQ(size_t(1), left->componentCount());
+    EXPECT_EQ(size_t(0), left->unitsCount());
+    EXPECT_LT(0.0, left->flattenTime());
+
+    EXPECT_EQ(fileContents("importer/diamond_right.cellml").size(), right->bytesRead());
+    EXPECT_EQ(size_t(1), right->componentCount());
+
+    // Both the left and right models import from the point model, which is
+    // only read once.
+
+    EXPECT_EQ(fileContents("importer/diamond_point.cellml").size(), point->bytesRead());
+    EXPECT_EQ(size_t(1), point->cacheHitCount());
+    EXPECT_EQ(size_t(1), point->cacheMissCount());
+    EXPECT_EQ(size_t(2), point->componentCount());
+    EXPECT_LT(0.0, point->flattenTime());
+
+    // Reloading a model reads it again.
+
+    EXPECT_TRUE(importer->invalidate(resourcePath("importer/diamond_point.cellml")));
+    EXPECT_EQ(2 * fileContents("importer/diamond_point.cellml").size(), point->bytesRead());
+    EXPECT_EQ(size_t(2), point->cacheMissCount());
+
+    importer->removeAllStatistics();
+
+    EXPECT_EQ(size_t(0), importer->statisticsCount());
+}
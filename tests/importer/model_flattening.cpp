@@ -972,3 +972,187 @@ TEST(ModelFlattening, resolveFlattenMissingUnits)
     EXPECT_EQ(size_t(1), importer->issueCount());
     EXPECT_EQ(e, importer->issue(0)->description());
 }
+
+TEST(ModelFlattening, flattenComponentImportedManyTimes)
+{
+    const std::string channel =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" name=\"channel\">\n"
+        "  <units name=\"mV\">\n"
+        "    <unit prefix=\"milli\" units=\"volt\"/>\n"
+        "  </units>\n"
+        "  <component name=\"channel\">\n"
+        "    <variable name=\"V\" units=\"mV\" interface=\"public\"/>\n"
+        "    <variable name=\"V_half\" units=\"mV\"/>\n"
+        "    <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "      <apply>\n"
+        "        <eq/>\n"
+        "        <ci>V_half</ci>\n"
+        "        <apply>\n"
+        "          <divide/>\n"
+        "          <ci>V</ci>\n"
+        "          <cn cellml:units=\"dimensionless\">2</cn>\n"
+        "        </apply>\n"
+        "      </apply>\n"
+        "      <apply>\n"
+        "        <eq/>\n"
+        "        <ci>V</ci>\n"
+        "        <cn cellml:units=\"mV\">-80</cn>\n"
+        "      </apply>\n"
+        "    </math>\n"
+        "  </component>\n"
+        "</model>\n";
+    const size_t channelCount = 20;
+
+    // Our model has its own, different, mV units, so the imported ones need
+    // renaming, including in the math of every imported channel.
+
+    auto model = libcellml::Model::create("cell");
+    auto mV = libcellml::Units::create("mV");
+    auto importSource = libcellml::ImportSource::create();
+
+    mV->addUnit("second");
+    model->addUnits(mV);
+    importSource->setUrl("channel.cellml");
+
+    for (size_t i = 0; i < channelCount; ++i) {
+        auto component = libcellml::Component::create("channel_" + std::to_string(i));
+
+        component->setImportSource(importSource);
+        component->setImportReference("channel");
+        model->addComponent(component);
+    }
+
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(libcellml::Importer::memoryLoader({{"channel.cellml", channel}}));
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    ASSERT_NE(nullptr, flatModel);
+    EXPECT_EQ(size_t(2), flatModel->unitsCount());
+    EXPECT_EQ("mV_1", flatModel->units(1)->name());
+    EXPECT_EQ(channelCount, flatModel->componentCount());
+
+    auto expectedMath = flatModel->component(0)->math();
+
+    EXPECT_NE(std::string::npos, expectedMath.find("<cn cellml:units=\"mV_1\">-80</cn>"));
+
+    for (size_t i = 0; i < channelCount; ++i) {
+        auto component = flatModel->component(i);
+
+        EXPECT_EQ("channel_" + std::to_string(i), component->name());
+        EXPECT_EQ("mV_1", component->variable("V")->units()->name());
+        EXPECT_EQ(expectedMath, component->math());
+    }
+}
+
+TEST(ModelFlattening, flattenMergesEquivalentUnits)
+{
+    const std::string sodium =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\" name=\"sodium\">\n"
+        "  <units name=\"mV\">\n"
+        "    <unit prefix=\"milli\" units=\"volt\"/>\n"
+        "  </units>\n"
+        "  <units name=\"per_mV\">\n"
+        "    <unit units=\"mV\" exponent=\"-1\"/>\n"
+        "  </units>\n"
+        "  <component name=\"sodium\">\n"
+        "    <variable name=\"V\" units=\"mV\" interface=\"public\"/>\n"
+        "    <variable name=\"k\" units=\"per_mV\"/>\n"
+        "    <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "      <apply>\n"
+        "        <eq/>\n"
+        "        <ci>k</ci>\n"
+        "        <apply>\n"
+        "          <divide/>\n"
+        "          <cn cellml:units=\"dimensionless\">1</cn>\n"
+        "          <apply>\n"
+        "            <minus/>\n"
+        "            <ci>V</ci>\n"
+        "            <cn cellml:units=\"mV\">10</cn>\n"
+        "          </apply>\n"
+        "        </apply>\n"
+        "      </apply>\n"
+        "    </math>\n"
+        "  </component>\n"
+        "</model>\n";
+    const std::string potassium =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"potassium\">\n"
+        "  <units name=\"volt_milli\">\n"
+        "    <unit multiplier=\"0.001\" units=\"volt\"/>\n"
+        "  </units>\n"
+        "  <component name=\"potassium\">\n"
+        "    <variable name=\"V\" units=\"volt_milli\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "</model>\n";
+
+    // All the imported voltage units are equivalent to our millivolt units,
+    // so they all get merged into them, and the units that are defined in
+    // terms of them get updated accordingly.
+
+    auto model = libcellml::Model::create("cell");
+    auto millivolt = libcellml::Units::create("millivolt");
+    auto sodiumImportSource = libcellml::ImportSource::create();
+    auto potassiumImportSource = libcellml::ImportSource::create();
+    auto sodiumComponent = libcellml::Component::create("sodium");
+    auto potassiumComponent = libcellml::Component::create("potassium");
+
+    millivolt->addUnit("volt", "milli");
+    model->addUnits(millivolt);
+    sodiumImportSource->setUrl("sodium.cellml");
+    potassiumImportSource->setUrl("potassium.cellml");
+    sodiumComponent->setImportSource(sodiumImportSource);
+    sodiumComponent->setImportReference("sodium");
+    potassiumComponent->setImportSource(potassiumImportSource);
+    potassiumComponent->setImportReference("potassium");
+    model->addComponent(sodiumComponent);
+    model->addComponent(potassiumComponent);
+
+    auto importer = libcellml::Importer::create();
+
+    importer->setLoader(libcellml::Importer::memoryLoader({
+        {"sodium.cellml", sodium},
+        {"potassium.cellml", potassium},
+    }));
+
+    EXPECT_TRUE(importer->resolveImports(model, ""));
+
+    auto flatModel = importer->flattenModel(model);
+
+    EXPECT_EQ(size_t(0), importer->issueCount());
+    ASSERT_NE(nullptr, flatModel);
+    EXPECT_EQ(size_t(2), flatModel->unitsCount());
+    EXPECT_EQ("millivolt", flatModel->units(0)->name());
+    EXPECT_EQ("per_mV", flatModel->units(1)->name());
+
+    std::string reference;
+    std::string prefix;
+    std::string id;
+    double exponent;
+    double multiplier;
+
+    flatModel->units(1)->unitAttributes(0, reference, prefix, exponent, multiplier, id);
+
+    EXPECT_EQ("millivolt", reference);
+    EXPECT_EQ(-1.0, exponent);
+
+    auto flatSodium = flatModel->component("sodium");
+    auto flatPotassium = flatModel->component("potassium");
+
+    EXPECT_EQ(flatModel->units(0), flatSodium->variable("V")->units());
+    EXPECT_EQ(flatModel->units(1), flatSodium->variable("k")->units());
+    EXPECT_EQ(flatModel->units(0), flatPotassium->variable("V")->units());
+    EXPECT_NE(std::string::npos, flatSodium->math().find("<cn cellml:units=\"millivolt\">10</cn>"));
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(flatModel);
+
+    EXPECT_EQ(size_t(0), validator->issueCount());
+}
@@ -18,6 +18,8 @@ limitations under the License.
 
 #include <libcellml>
 
+#include <thread>
+
 #include "test_utils.h"
 
 TEST(Model, setGetId)
@@ -624,3 +626,146 @@ TEST(Model, removeComponentInsensitiveToOrder)
     EXPECT_EQ(size_t(0), modelParsed->componentCount());
     EXPECT_EQ(size_t(2), modelApi->componentCount());
 }
+
+TEST(Model, entityByPath)
+{
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"c1\">\n"
+        "    <variable name=\"v1\" units=\"dimensionless\"/>\n"
+        "  </component>\n"
+        "  <component name=\"c2\">\n"
+        "    <variable name=\"v2\" units=\"dimensionless\"/>\n"
+        "  </component>\n"
+        "  <encapsulation>\n"
+        "    <component_ref component=\"c1\">\n"
+        "      <component_ref component=\"c2\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "</model>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(e);
+    auto c1 = model->component("c1");
+    auto c2 = model->component("c2", true);
+
+    EXPECT_EQ(c1, model->componentByPath("c1"));
+    EXPECT_EQ(c2, model->componentByPath("c1/c2"));
+    EXPECT_EQ(nullptr, model->componentByPath("c2"));
+    EXPECT_EQ(nullptr, model->componentByPath(""));
+    EXPECT_EQ(c1->variable("v1"), model->variableByPath("c1/v1"));
+    EXPECT_EQ(c2->variable("v2"), model->variableByPath("c1/c2/v2"));
+    EXPECT_EQ(nullptr, model->variableByPath("c1/v2"));
+    EXPECT_EQ(nullptr, model->variableByPath("c1/c2"));
+
+    // Renaming a component or a variable must be reflected by the paths.
+
+    c1->setName("c0");
+    c2->variable("v2")->setName("v3");
+
+    EXPECT_EQ(nullptr, model->componentByPath("c1/c2"));
+    EXPECT_EQ(c2, model->componentByPath("c0/c2"));
+    EXPECT_EQ(nullptr, model->variableByPath("c0/c2/v2"));
+    EXPECT_EQ(c2->variable("v3"), model->variableByPath("c0/c2/v3"));
+
+    // So must adding and removing a component or a variable.
+
+    auto v4 = libcellml::Variable::create("v4");
+
+    c2->addVariable(v4);
+
+    EXPECT_EQ(v4, model->variableByPath("c0/c2/v4"));
+
+    model->addComponent(c2);
+
+    EXPECT_EQ(nullptr, model->componentByPath("c0/c2"));
+    EXPECT_EQ(c2, model->componentByPath("c2"));
+    EXPECT_EQ(v4, model->variableByPath("c2/v4"));
+
+    c2->removeVariable(v4);
+
+    EXPECT_EQ(nullptr, model->variableByPath("c2/v4"));
+
+    // Each model keeps track of its own structure, so moving a component to
+    // another model must be reflected by the paths of both models.
+
+    auto otherModel = libcellml::Model::create("other_model");
+
+    EXPECT_EQ(nullptr, otherModel->componentByPath("c2"));
+
+    otherModel->addComponent(c2);
+
+    EXPECT_EQ(nullptr, model->componentByPath("c2"));
+    EXPECT_EQ(c2, otherModel->componentByPath("c2"));
+
+    c2->variable("v3")->setName("v5");
+
+    EXPECT_EQ(c2->variable("v5"), otherModel->variableByPath("c2/v5"));
+
+    model->removeAllComponents();
+
+    EXPECT_EQ(nullptr, model->componentByPath("c0"));
+    EXPECT_EQ(nullptr, model->variableByPath("c0/v1"));
+}
+
+TEST(Model, concurrentReads)
+{
+    static const size_t THREAD_COUNT = 4;
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("Ohara_Rudy_2011.cellml"));
+    auto printer = libcellml::Printer::create();
+    auto expectedModel = printer->printModel(model);
+    auto analyser = libcellml::Analyser::create();
+
+    analyser->analyseModel(model);
+
+    EXPECT_EQ(size_t(0), analyser->errorCount());
+
+    auto analyserModel = analyser->model();
+    std::vector<std::thread> threads;
+    std::vector<int> results(THREAD_COUNT, 0);
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        threads.emplace_back([&model, &expectedModel, &analyserModel, &results, i]() {
+            auto threadPrinter = libcellml::Printer::create();
+            bool result = threadPrinter->printModel(model) == expectedModel;
+
+            for (size_t j = 0; j < model->componentCount(); ++j) {
+                auto component = model->component(j);
+
+                result = result && (model->component(component->name()) == component)
+                         && (model->componentByPath(component->name()) == component);
+
+                for (size_t k = 0; k < component->variableCount(); ++k) {
+                    auto variable = component->variable(k);
+
+                    result = result && (component->variable(variable->name()) == variable)
+                             && (model->variableByPath(component->name() + "/" + variable->name()) == variable);
+
+                    for (size_t l = 0; l < variable->equivalentVariableCount(); ++l) {
+                        result = result && variable->equivalentVariable(l)->hasEquivalentVariable(variable)
+                                 && analyserModel->areEquivalentVariables(variable, variable->equivalentVariable(l));
+                    }
+
+                    if (k > 0) {
+                        auto previousVariable = component->variable(k - 1);
+
+                        result = result && (analyserModel->areEquivalentVariables(variable, previousVariable) == variable->hasEquivalentVariable(previousVariable, true));
+                    }
+                }
+            }
+
+            results[i] = result ? 1 : 0;
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+        EXPECT_EQ(1, results[i]);
+    }
+}
@@ -2249,3 +2249,55 @@ TEST(Parser, parserDoesNotDeleteChildrenOfInvalidEncapsulation)
     EXPECT_EQ(size_t(2), parser->errorCount());
     EXPECT_EQ_ISSUES(expectedIssues, parser);
 }
+
+TEST(Parser, parseInvalidBinaryModel)
+{
+    const std::vector<std::string> expectedIssues = {
+        "Input is not a binary model.",
+        "Binary model is truncated.",
+        "Binary model has unexpected trailing data.",
+    };
+
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto binaryModel = printer->printBinaryModel(parser->parseModel(fileContents("sine_approximations.xml")));
+
+    parser->parseBinaryModel("<model/>");
+    EXPECT_EQ_ISSUES(std::vector<std::string>(expectedIssues.begin(), expectedIssues.begin() + 1), parser);
+
+    parser->parseBinaryModel(binaryModel.substr(0, binaryModel.size() / 2));
+    EXPECT_EQ_ISSUES(std::vector<std::string>(expectedIssues.begin() + 1, expectedIssues.begin() + 2), parser);
+
+    parser->parseBinaryModel(binaryModel + "trailing");
+    EXPECT_EQ_ISSUES(std::vector<std::string>(expectedIssues.begin() + 2, expectedIssues.end()), parser);
+    EXPECT_EQ(libcellml::Issue::ReferenceRule::INVALID_ARGUMENT, parser->issue(0)->referenceRule());
+}
+
+TEST(Parser, parseDeeplyNestedBinaryModel)
+{
+    const std::vector<std::string> expectedIssues = {
+        "Binary model has components nested more than 1000 levels deep.",
+    };
+
+    // A model without name, id, encapsulation id, import sources or units, but
+    // with one component, which itself has one child component, and so on.
+    // Each component has no name, id, encapsulation id, import reference,
+    // variables, resets or math.
+
+    static const size_t DEPTH = 100000;
+
+    std::string binaryModel = std::string("\x89"
+                                          "CellML\r\n\x01")
+                              + std::string(6, '\0') + "\x01";
+
+    for (size_t i = 0; i < DEPTH; ++i) {
+        binaryModel += std::string(7, '\0') + ((i == DEPTH - 1) ? '\0' : '\x01');
+    }
+
+    binaryModel += '\0';
+
+    auto parser = libcellml::Parser::create();
+
+    parser->parseBinaryModel(binaryModel);
+    EXPECT_EQ_ISSUES(expectedIssues, parser);
+}
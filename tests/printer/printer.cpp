@@ -20,6 +20,8 @@ limitations under the License.
 
 #include <libcellml>
 
+#include <filesystem>
+
 const std::string MATH_HEADER = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n";
 const std::string MATH_FOOTER = "</math>\n";
 const std::string PRETTY_MODEL_STRING =
@@ -978,3 +980,101 @@ TEST(Printer, prettyPrintSpacesWrongPlaceNewlines)
     component6->appendMath(MATH_FOOTER);
     EXPECT_EQ(PRETTY_MODEL_STRING, printer->printModel(model));
 }
+
+TEST(Printer, binaryModelRoundTrip)
+{
+    // Check that all the models in our test resources print the same once
+    // serialised to and deserialised from the binary model format.
+
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    size_t modelCount = 0;
+
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(resourcePath())) {
+        auto extension = entry.path().extension();
+
+        if ((extension != ".cellml") && (extension != ".xml")) {
+            continue;
+        }
+
+        auto model = parser->parseModel(fileContents(std::filesystem::relative(entry.path(), resourcePath()).string()));
+        auto binaryModel = printer->printBinaryModel(model);
+        auto parsedModel = parser->parseBinaryModel(binaryModel);
+
+        EXPECT_EQ(size_t(0), parser->issueCount()) << entry.path();
+        EXPECT_EQ(printer->printModel(model), printer->printModel(parsedModel)) << entry.path();
+        EXPECT_EQ(binaryModel, printer->printBinaryModel(parsedModel)) << entry.path();
+
+        ++modelCount;
+    }
+
+    EXPECT_LT(size_t(100), modelCount);
+    EXPECT_EQ("", printer->printBinaryModel(nullptr));
+}
+
+TEST(Printer, printModelToStream)
+{
+    auto parser = libcellml::Parser::create();
+    auto printer = libcellml::Printer::create();
+    auto model = parser->parseModel(fileContents("modelflattening/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto importer = libcellml::Importer::create();
+
+    importer->resolveImports(model, resourcePath("modelflattening/hodgkin_huxley_squid_axon_model_1952/"));
+
+    auto flatModel = importer->flattenModel(model);
+    std::ostringstream output;
+
+    EXPECT_TRUE(printer->printModel(flatModel, output));
+    EXPECT_EQ(printer->printModel(flatModel), output.str());
+
+    std::ostringstream autoIdsOutput;
+
+    EXPECT_TRUE(printer->printModel(parser->parseModel(fileContents("printer/spaced_model.cellml")), autoIdsOutput, true));
+    EXPECT_EQ(printer->printModel(parser->parseModel(fileContents("printer/spaced_model.cellml")), true), autoIdsOutput.str());
+
+    std::ostringstream failedOutput;
+
+    failedOutput.setstate(std::ios::badbit);
+
+    EXPECT_FALSE(printer->printModel(flatModel, failedOutput));
+    EXPECT_FALSE(printer->printModel(nullptr, output));
+}
+
+TEST(Printer, printModelWithMalformedMath)
+{
+    auto model = libcellml::Model::create("model");
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+    std::ostringstream output;
+
+    component->setMath("<math xmlns=\"http://www.w3.org/1998/Math/MathML\"><apply><eq/>");
+    model->addComponent(component);
+
+    EXPECT_EQ("", printer->printModel(model));
+    EXPECT_FALSE(printer->printModel(model, output));
+}
+
+TEST(Printer, printModelWithEscapedAttributeValues)
+{
+    const std::string e =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <import xmlns:xlink=\"http://www.w3.org/1999/xlink\" xlink:href=\"model.cellml?a=1&amp;b=&quot;2&quot;\">\n"
+        "    <component component_ref=\"component\" name=\"component\"/>\n"
+        "  </import>\n"
+        "</model>\n";
+
+    auto model = libcellml::Model::create("model");
+    auto importSource = libcellml::ImportSource::create();
+    auto component = libcellml::Component::create("component");
+    auto printer = libcellml::Printer::create();
+    auto parser = libcellml::Parser::create();
+
+    importSource->setUrl("model.cellml?a=1&b=\"2\"");
+    component->setImportSource(importSource);
+    component->setImportReference("component");
+    model->addComponent(component);
+
+    EXPECT_EQ(e, printer->printModel(model));
+    EXPECT_EQ("model.cellml?a=1&b=\"2\"", parser->parseModel(e)->component(0)->importSource()->url());
+}
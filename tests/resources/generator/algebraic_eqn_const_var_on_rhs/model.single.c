@@ -0,0 +1,55 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 0;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"", "", ""};
+
+const VariableInfo STATE_INFO[] = {
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "my_algebraic_eqn", CONSTANT},
+    {"x", "dimensionless", "my_algebraic_eqn", COMPUTED_CONSTANT}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 1.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[1] = variables[0];
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+}
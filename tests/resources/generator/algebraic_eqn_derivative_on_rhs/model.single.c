@@ -0,0 +1,58 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "second", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "dimensionless", "my_ode"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "per_s", "my_ode", COMPUTED_CONSTANT},
+    {"x", "per_s", "my_algebraic_eqn", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 1.0f;
+    states[0] = 1.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = variables[0];
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[1] = rates[0];
+}
@@ -0,0 +1,58 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.mixed.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "second", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "per_s", "my_component", COMPUTED_CONSTANT},
+    {"x", "per_s", "my_component", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(void *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, double *variables)
+{
+    variables[0] = 1.0;
+    states[0] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, float *states, float *rates, double *variables)
+{
+    rates[0] = variables[0];
+}
+
+void computeVariables(double voi, float *states, float *rates, double *variables)
+{
+    variables[1] = rates[0];
+}
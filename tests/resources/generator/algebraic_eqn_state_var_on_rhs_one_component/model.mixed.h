@@ -0,0 +1,43 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+
+typedef enum {
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[3];
+    char units[14];
+    char component[9];
+} VariableInfo;
+
+typedef struct {
+    char name[3];
+    char units[14];
+    char component[9];
+    VariableType type;
+} VariableInfoWithType;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfoWithType VARIABLE_INFO[];
+
+float * createStatesArray();
+double * createVariablesArray();
+void deleteArray(void *array);
+
+void initialiseStatesAndConstants(float *states, double *variables);
+void computeComputedConstants(double *variables);
+void computeRates(double voi, float *states, float *rates, double *variables);
+void computeVariables(double voi, float *states, float *rates, double *variables);
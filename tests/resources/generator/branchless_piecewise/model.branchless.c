@@ -0,0 +1,88 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0.post0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 9;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "my_component", CONSTANT},
+    {"b", "dimensionless", "my_component", CONSTANT},
+    {"c", "dimensionless", "my_component", CONSTANT},
+    {"min", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"max", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"p", "dimensionless", "my_component", ALGEBRAIC},
+    {"q", "dimensionless", "my_component", ALGEBRAIC},
+    {"r", "dimensionless", "my_component", ALGEBRAIC},
+    {"s", "dimensionless", "my_component", ALGEBRAIC}
+};
+
+double min(double x, double y)
+{
+    return (x < y)?x:y;
+}
+
+double max(double x, double y)
+{
+    return (x > y)?x:y;
+}
+
+double blend(double condition, double x, double y)
+{
+    return (condition != 0.0)?x:y;
+}
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(double *states, double *variables)
+{
+    variables[0] = 3.0;
+    variables[1] = 5.0;
+    variables[2] = 7.0;
+    states[0] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[3] = min(variables[0], variables[1]);
+    variables[4] = max(variables[1], variables[0]);
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[8] = 2.0*blend(voi >= states[0], exp(variables[0]), log(variables[1]));
+    variables[5] = blend(voi > 1.0, variables[0], blend(voi > 2.0, variables[1], variables[2]));
+    rates[0] = variables[3]+variables[4]+variables[5]+variables[8];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[6] = blend(voi > 1.0, variables[0], NAN);
+    variables[7] = blend(voi > 1.0, variables[0], blend(voi > 2.0, variables[1], NAN));
+    variables[8] = 2.0*blend(voi >= states[0], exp(variables[0]), log(variables[1]));
+}
@@ -0,0 +1,92 @@
+# The content of this file was generated using a modified Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.2.0.post0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 9
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "my_component"}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "my_component"}
+]
+
+VARIABLE_INFO = [
+    {"name": "a", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "c", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "min", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "max", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "p", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "q", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "r", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC},
+    {"name": "s", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC}
+]
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def gt_func(x, y):
+    return 1.0 if x > y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def min(x, y):
+    return x if x < y else y
+
+
+def max(x, y):
+    return x if x > y else y
+
+
+def blend_func(condition, x, y):
+    return x if bool(condition) else y
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialise_states_and_constants(states, variables):
+    variables[0] = 3.0
+    variables[1] = 5.0
+    variables[2] = 7.0
+    states[0] = 1.0
+
+
+def compute_computed_constants(variables):
+    variables[3] = min(variables[0], variables[1])
+    variables[4] = max(variables[1], variables[0])
+
+
+def compute_rates(voi, states, rates, variables):
+    variables[8] = 2.0*blend_func(geq_func(voi, states[0]), exp(variables[0]), log(variables[1]))
+    variables[5] = blend_func(gt_func(voi, 1.0), variables[0], blend_func(gt_func(voi, 2.0), variables[1], variables[2]))
+    rates[0] = variables[3]+variables[4]+variables[5]+variables[8]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[6] = blend_func(gt_func(voi, 1.0), variables[0], nan)
+    variables[7] = blend_func(gt_func(voi, 1.0), variables[0], blend_func(gt_func(voi, 2.0), variables[1], nan))
+    variables[8] = 2.0*blend_func(geq_func(voi, states[0]), exp(variables[0]), log(variables[1]))
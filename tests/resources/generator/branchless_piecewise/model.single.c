@@ -0,0 +1,73 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 9;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "my_component", CONSTANT},
+    {"b", "dimensionless", "my_component", CONSTANT},
+    {"c", "dimensionless", "my_component", CONSTANT},
+    {"min", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"max", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"p", "dimensionless", "my_component", ALGEBRAIC},
+    {"q", "dimensionless", "my_component", ALGEBRAIC},
+    {"r", "dimensionless", "my_component", ALGEBRAIC},
+    {"s", "dimensionless", "my_component", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 3.0f;
+    variables[1] = 5.0f;
+    variables[2] = 7.0f;
+    states[0] = 1.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[3] = (variables[0] < variables[1])?variables[0]:variables[1];
+    variables[4] = (variables[0] < variables[1])?variables[1]:variables[0];
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    variables[8] = 2.0f*((voi >= states[0])?expf(variables[0]):logf(variables[1]));
+    variables[5] = (voi > 1.0f)?variables[0]:(voi > 2.0f)?variables[1]:variables[2];
+    rates[0] = variables[3]+variables[4]+variables[5]+variables[8];
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[6] = (voi > 1.0f)?variables[0]:NAN;
+    variables[7] = (voi > 1.0f)?variables[0]:(voi > 2.0f)?variables[1]:NAN;
+    variables[8] = 2.0f*((voi >= states[0])?expf(variables[0]):logf(variables[1]));
+}
@@ -0,0 +1,61 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.mixed.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "ms", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "mM", "circle_x"},
+    {"y", "mM", "circle_y_implementation"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"local_complex_maths", "mM", "circle_sibling", ALGEBRAIC},
+    {"two_x", "milli_mole", "circle_x_sibling", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(void *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, double *variables)
+{
+    states[0] = 0.0;
+    states[1] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, float *states, float *rates, double *variables)
+{
+    rates[0] = -states[1]*1.0;
+    rates[1] = states[0]*1.0;
+}
+
+void computeVariables(double voi, float *states, float *rates, double *variables)
+{
+    variables[0] = states[1]+5.0*states[1]/3.0+1.0*exp(states[1]/2.0);
+    variables[1] = 2.0*states[0];
+}
@@ -0,0 +1,61 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "ms", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "mM", "circle_x"},
+    {"y", "mM", "circle_y_implementation"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"local_complex_maths", "mM", "circle_sibling", ALGEBRAIC},
+    {"two_x", "milli_mole", "circle_x_sibling", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    states[0] = 0.0f;
+    states[1] = 1.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = -states[1]*1.0f;
+    rates[1] = states[0]*1.0f;
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[0] = states[1]+5.0f*states[1]/3.0f+1.0f*expf(states[1]/2.0f);
+    variables[1] = 2.0f*states[0];
+}
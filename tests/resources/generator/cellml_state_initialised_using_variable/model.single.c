@@ -0,0 +1,56 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 1;
+
+const VariableInfo VOI_INFO = {"t", "ms", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "mV", "main"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"k", "mV", "constants", CONSTANT}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 123.0f;
+    states[0] = variables[0];
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = 1.23f;
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+}
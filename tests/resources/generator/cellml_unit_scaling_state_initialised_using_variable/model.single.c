@@ -0,0 +1,61 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "ms", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"k1", "mM", "main"},
+    {"k2", "M", "main"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"k1_cst", "mM", "constants", CONSTANT},
+    {"k2_cst", "mM", "constants", CONSTANT}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 123.0f;
+    variables[1] = 789.0f;
+    states[0] = variables[0];
+    states[1] = 0.001f*variables[1];
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = 1.23f;
+    rates[1] = 7.89f;
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+}
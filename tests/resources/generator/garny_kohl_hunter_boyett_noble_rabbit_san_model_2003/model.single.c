@@ -0,0 +1,518 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 15;
+const size_t VARIABLE_COUNT = 185;
+
+const VariableInfo VOI_INFO = {"time", "second", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_current_m_gate"},
+    {"h1", "dimensionless", "sodium_current_h_gate"},
+    {"h2", "dimensionless", "sodium_current_h_gate"},
+    {"d_L", "dimensionless", "L_type_Ca_channel_d_gate"},
+    {"f_L", "dimensionless", "L_type_Ca_channel_f_gate"},
+    {"d_T", "dimensionless", "T_type_Ca_channel_d_gate"},
+    {"f_T", "dimensionless", "T_type_Ca_channel_f_gate"},
+    {"q", "dimensionless", "four_AP_sensitive_currents_q_gate"},
+    {"r", "dimensionless", "four_AP_sensitive_currents_r_gate"},
+    {"P_af", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_af_gate"},
+    {"P_as", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_as_gate"},
+    {"P_i", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_i_gate"},
+    {"xs", "dimensionless", "slow_delayed_rectifying_potassium_current_xs_gate"},
+    {"y", "dimensionless", "hyperpolarisation_activated_current_y_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"E_Ca_L", "millivolt", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Centre_0DCapable", "microS", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Centre_1DCapable", "microS", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Centre_Published", "microS", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Periphery_0DCapable", "microS", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Periphery_1DCapable", "microS", "L_type_Ca_channel", CONSTANT},
+    {"g_Ca_L_Periphery_Published", "microS", "L_type_Ca_channel", CONSTANT},
+    {"E_Ca_T", "millivolt", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Centre_0DCapable", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Centre_1DCapable", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Centre_Published", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Periphery_0DCapable", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Periphery_1DCapable", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_Ca_T_Periphery_Published", "microS", "T_type_Ca_channel", CONSTANT},
+    {"g_b_Ca_Centre_0DCapable", "microS", "calcium_background_current", CONSTANT},
+    {"g_b_Ca_Centre_1DCapable", "microS", "calcium_background_current", CONSTANT},
+    {"g_b_Ca_Centre_Published", "microS", "calcium_background_current", CONSTANT},
+    {"g_b_Ca_Periphery_0DCapable", "microS", "calcium_background_current", CONSTANT},
+    {"g_b_Ca_Periphery_1DCapable", "microS", "calcium_background_current", CONSTANT},
+    {"g_b_Ca_Periphery_Published", "microS", "calcium_background_current", CONSTANT},
+    {"g_sus_Centre_0DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_sus_Centre_1DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_sus_Centre_Published", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_sus_Periphery_0DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_sus_Periphery_1DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_sus_Periphery_Published", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Centre_0DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Centre_1DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Centre_Published", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Periphery_0DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Periphery_1DCapable", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_to_Periphery_Published", "microS", "four_AP_sensitive_currents", CONSTANT},
+    {"g_f_K_Centre_0DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_K_Centre_1DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_K_Centre_Published", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_K_Periphery_0DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_K_Periphery_1DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_K_Periphery_Published", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Centre_0DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Centre_1DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Centre_Published", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Periphery_0DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Periphery_1DCapable", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"g_f_Na_Periphery_Published", "microS", "hyperpolarisation_activated_current", CONSTANT},
+    {"Ca_i", "millimolar", "ionic_concentrations", CONSTANT},
+    {"Ca_o", "millimolar", "ionic_concentrations", CONSTANT},
+    {"K_i", "millimolar", "ionic_concentrations", CONSTANT},
+    {"K_o", "millimolar", "ionic_concentrations", CONSTANT},
+    {"Na_i", "millimolar", "ionic_concentrations", CONSTANT},
+    {"Na_o", "millimolar", "ionic_concentrations", CONSTANT},
+    {"CmCentre", "microF", "membrane", CONSTANT},
+    {"CmPeriphery", "microF", "membrane", CONSTANT},
+    {"F", "coulomb_per_mole", "membrane", CONSTANT},
+    {"FCellConstant", "dimensionless", "membrane", CONSTANT},
+    {"R", "millijoule_per_mole_kelvin", "membrane", CONSTANT},
+    {"T", "kelvin", "membrane", CONSTANT},
+    {"Version", "dimensionless", "membrane", CONSTANT},
+    {"dCell", "dimensionless", "membrane", CONSTANT},
+    {"i_Ca_p_max_Centre_0DCapable", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"i_Ca_p_max_Centre_1DCapable", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"i_Ca_p_max_Centre_Published", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"i_Ca_p_max_Periphery_0DCapable", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"i_Ca_p_max_Periphery_1DCapable", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"i_Ca_p_max_Periphery_Published", "nanoA", "persistent_calcium_current", CONSTANT},
+    {"g_b_K_Centre_0DCapable", "microS", "potassium_background_current", CONSTANT},
+    {"g_b_K_Centre_1DCapable", "microS", "potassium_background_current", CONSTANT},
+    {"g_b_K_Centre_Published", "microS", "potassium_background_current", CONSTANT},
+    {"g_b_K_Periphery_0DCapable", "microS", "potassium_background_current", CONSTANT},
+    {"g_b_K_Periphery_1DCapable", "microS", "potassium_background_current", CONSTANT},
+    {"g_b_K_Periphery_Published", "microS", "potassium_background_current", CONSTANT},
+    {"g_K_r_Centre_0DCapable", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_r_Centre_1DCapable", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_r_Centre_Published", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_r_Periphery_0DCapable", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_r_Periphery_1DCapable", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_r_Periphery_Published", "microS", "rapid_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Centre_0DCapable", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Centre_1DCapable", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Centre_Published", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Periphery_0DCapable", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Periphery_1DCapable", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_K_s_Periphery_Published", "microS", "slow_delayed_rectifying_potassium_current", CONSTANT},
+    {"g_b_Na_Centre_0DCapable", "microS", "sodium_background_current", CONSTANT},
+    {"g_b_Na_Centre_1DCapable", "microS", "sodium_background_current", CONSTANT},
+    {"g_b_Na_Centre_Published", "microS", "sodium_background_current", CONSTANT},
+    {"g_b_Na_Periphery_0DCapable", "microS", "sodium_background_current", CONSTANT},
+    {"g_b_Na_Periphery_1DCapable", "microS", "sodium_background_current", CONSTANT},
+    {"g_b_Na_Periphery_Published", "microS", "sodium_background_current", CONSTANT},
+    {"d_NaCa", "dimensionless", "sodium_calcium_exchanger", CONSTANT},
+    {"gamma_NaCa", "dimensionless", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Centre_0DCapable", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Centre_1DCapable", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Centre_Published", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Periphery_0DCapable", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Periphery_1DCapable", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"k_NaCa_Periphery_Published", "nanoA", "sodium_calcium_exchanger", CONSTANT},
+    {"g_Na_Centre_0DCapable", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"g_Na_Centre_1DCapable", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"g_Na_Centre_Published", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"g_Na_Periphery_0DCapable", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"g_Na_Periphery_1DCapable", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"g_Na_Periphery_Published", "microlitre_per_second", "sodium_current", CONSTANT},
+    {"K_m_K", "millimolar", "sodium_potassium_pump", CONSTANT},
+    {"K_m_Na", "millimolar", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Centre_0DCapable", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Centre_1DCapable", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Centre_Published", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Periphery_0DCapable", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Periphery_1DCapable", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"i_p_max_Periphery_Published", "nanoA", "sodium_potassium_pump", CONSTANT},
+    {"FCell", "dimensionless", "membrane", COMPUTED_CONSTANT},
+    {"Cm", "microF", "membrane", COMPUTED_CONSTANT},
+    {"g_b_Na", "microS", "sodium_background_current", COMPUTED_CONSTANT},
+    {"g_b_K", "microS", "potassium_background_current", COMPUTED_CONSTANT},
+    {"g_b_Ca", "microS", "calcium_background_current", COMPUTED_CONSTANT},
+    {"k_NaCa", "nanoA", "sodium_calcium_exchanger", COMPUTED_CONSTANT},
+    {"i_NaCa", "nanoA", "sodium_calcium_exchanger", ALGEBRAIC},
+    {"i_p_max", "nanoA", "sodium_potassium_pump", COMPUTED_CONSTANT},
+    {"i_p", "nanoA", "sodium_potassium_pump", ALGEBRAIC},
+    {"i_Ca_p_max", "nanoA", "persistent_calcium_current", COMPUTED_CONSTANT},
+    {"i_Ca_p", "nanoA", "persistent_calcium_current", COMPUTED_CONSTANT},
+    {"E_Na", "millivolt", "reversal_and_equilibrium_potentials", COMPUTED_CONSTANT},
+    {"E_K", "millivolt", "reversal_and_equilibrium_potentials", COMPUTED_CONSTANT},
+    {"E_Ca", "millivolt", "reversal_and_equilibrium_potentials", COMPUTED_CONSTANT},
+    {"E_K_s", "millivolt", "reversal_and_equilibrium_potentials", COMPUTED_CONSTANT},
+    {"g_Na", "microlitre_per_second", "sodium_current", COMPUTED_CONSTANT},
+    {"m_infinity", "dimensionless", "sodium_current_m_gate", ALGEBRAIC},
+    {"tau_m", "second", "sodium_current_m_gate", ALGEBRAIC},
+    {"F_Na", "dimensionless", "sodium_current_h_gate", ALGEBRAIC},
+    {"h", "dimensionless", "sodium_current_h_gate", ALGEBRAIC},
+    {"h1_infinity", "dimensionless", "sodium_current_h_gate", ALGEBRAIC},
+    {"h2_infinity", "dimensionless", "sodium_current_h_gate", ALGEBRAIC},
+    {"tau_h1", "second", "sodium_current_h_gate", ALGEBRAIC},
+    {"tau_h2", "second", "sodium_current_h_gate", ALGEBRAIC},
+    {"g_Ca_L", "microS", "L_type_Ca_channel", COMPUTED_CONSTANT},
+    {"i_Ca_L", "nanoA", "L_type_Ca_channel", ALGEBRAIC},
+    {"alpha_d_L", "per_second", "L_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"beta_d_L", "per_second", "L_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"tau_d_L", "second", "L_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"d_L_infinity", "dimensionless", "L_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"alpha_f_L", "per_second", "L_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"beta_f_L", "per_second", "L_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"tau_f_L", "second", "L_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"f_L_infinity", "dimensionless", "L_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"g_Ca_T", "microS", "T_type_Ca_channel", COMPUTED_CONSTANT},
+    {"i_Ca_T", "nanoA", "T_type_Ca_channel", ALGEBRAIC},
+    {"alpha_d_T", "per_second", "T_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"beta_d_T", "per_second", "T_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"tau_d_T", "second", "T_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"d_T_infinity", "dimensionless", "T_type_Ca_channel_d_gate", ALGEBRAIC},
+    {"alpha_f_T", "per_second", "T_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"beta_f_T", "per_second", "T_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"tau_f_T", "second", "T_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"f_T_infinity", "dimensionless", "T_type_Ca_channel_f_gate", ALGEBRAIC},
+    {"g_to", "microS", "four_AP_sensitive_currents", COMPUTED_CONSTANT},
+    {"g_sus", "microS", "four_AP_sensitive_currents", COMPUTED_CONSTANT},
+    {"i_to", "nanoA", "four_AP_sensitive_currents", ALGEBRAIC},
+    {"i_sus", "nanoA", "four_AP_sensitive_currents", ALGEBRAIC},
+    {"q_infinity", "dimensionless", "four_AP_sensitive_currents_q_gate", ALGEBRAIC},
+    {"tau_q", "second", "four_AP_sensitive_currents_q_gate", ALGEBRAIC},
+    {"r_infinity", "dimensionless", "four_AP_sensitive_currents_r_gate", ALGEBRAIC},
+    {"tau_r", "second", "four_AP_sensitive_currents_r_gate", ALGEBRAIC},
+    {"g_K_r", "microS", "rapid_delayed_rectifying_potassium_current", COMPUTED_CONSTANT},
+    {"P_a", "dimensionless", "rapid_delayed_rectifying_potassium_current", ALGEBRAIC},
+    {"P_af_infinity", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_af_gate", ALGEBRAIC},
+    {"tau_P_af", "second", "rapid_delayed_rectifying_potassium_current_P_af_gate", ALGEBRAIC},
+    {"P_as_infinity", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_as_gate", ALGEBRAIC},
+    {"tau_P_as", "second", "rapid_delayed_rectifying_potassium_current_P_as_gate", ALGEBRAIC},
+    {"tau_P_i", "second", "rapid_delayed_rectifying_potassium_current_P_i_gate", COMPUTED_CONSTANT},
+    {"P_i_infinity", "dimensionless", "rapid_delayed_rectifying_potassium_current_P_i_gate", ALGEBRAIC},
+    {"g_K_s", "microS", "slow_delayed_rectifying_potassium_current", COMPUTED_CONSTANT},
+    {"i_K_s", "nanoA", "slow_delayed_rectifying_potassium_current", ALGEBRAIC},
+    {"alpha_xs", "per_second", "slow_delayed_rectifying_potassium_current_xs_gate", ALGEBRAIC},
+    {"beta_xs", "per_second", "slow_delayed_rectifying_potassium_current_xs_gate", ALGEBRAIC},
+    {"g_f_Na", "microS", "hyperpolarisation_activated_current", COMPUTED_CONSTANT},
+    {"i_f_Na", "nanoA", "hyperpolarisation_activated_current", ALGEBRAIC},
+    {"g_f_K", "microS", "hyperpolarisation_activated_current", COMPUTED_CONSTANT},
+    {"i_f_K", "nanoA", "hyperpolarisation_activated_current", ALGEBRAIC},
+    {"alpha_y", "per_second", "hyperpolarisation_activated_current_y_gate", ALGEBRAIC},
+    {"beta_y", "per_second", "hyperpolarisation_activated_current_y_gate", ALGEBRAIC},
+    {"i_b_Na", "nanoA", "sodium_background_current", ALGEBRAIC},
+    {"i_b_K", "nanoA", "potassium_background_current", ALGEBRAIC},
+    {"i_b_Ca", "nanoA", "calcium_background_current", ALGEBRAIC},
+    {"i_Na", "nanoA", "sodium_current", ALGEBRAIC},
+    {"i_K_r", "nanoA", "rapid_delayed_rectifying_potassium_current", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 46.4f;
+    variables[1] = 0.0057938f;
+    variables[2] = 0.0082f;
+    variables[3] = 0.0058f;
+    variables[4] = 0.06588648f;
+    variables[5] = 0.0659f;
+    variables[6] = 0.0659f;
+    variables[7] = 45.0f;
+    variables[8] = 0.00427806f;
+    variables[9] = 0.0021f;
+    variables[10] = 0.0043f;
+    variables[11] = 0.0138823f;
+    variables[12] = 0.00694f;
+    variables[13] = 0.0139f;
+    variables[14] = 1.3236e-5f;
+    variables[15] = 1.323e-5f;
+    variables[16] = 1.32e-5f;
+    variables[17] = 4.2952e-5f;
+    variables[18] = 4.29e-5f;
+    variables[19] = 4.3e-5f;
+    variables[20] = 6.645504e-5f;
+    variables[21] = 0.000266f;
+    variables[22] = 6.65e-5f;
+    variables[23] = 0.01138376f;
+    variables[24] = 0.0114f;
+    variables[25] = 0.0114f;
+    variables[26] = 0.004905f;
+    variables[27] = 0.004905f;
+    variables[28] = 0.00491f;
+    variables[29] = 0.036495f;
+    variables[30] = 0.0365f;
+    variables[31] = 0.03649f;
+    variables[32] = 0.0005465f;
+    variables[33] = 0.000437f;
+    variables[34] = 0.000548f;
+    variables[35] = 0.006875f;
+    variables[36] = 0.0055f;
+    variables[37] = 0.0069f;
+    variables[38] = 0.0005465f;
+    variables[39] = 0.000437f;
+    variables[40] = 0.000548f;
+    variables[41] = 0.006875f;
+    variables[42] = 0.0055f;
+    variables[43] = 0.0069f;
+    variables[44] = 0.0001f;
+    variables[45] = 2.0f;
+    variables[46] = 140.0f;
+    variables[47] = 5.4f;
+    variables[48] = 8.0f;
+    variables[49] = 140.0f;
+    variables[50] = 2.0e-5f;
+    variables[51] = 6.5e-5f;
+    variables[52] = 96845.0f;
+    variables[53] = 1.0309347f;
+    variables[54] = 8314.0f;
+    variables[55] = 310.0f;
+    variables[56] = 1.0f;
+    variables[57] = 0.0f;
+    variables[58] = 0.0f;
+    variables[59] = 0.0042f;
+    variables[60] = 0.0f;
+    variables[61] = 0.0f;
+    variables[62] = 0.03339f;
+    variables[63] = 0.0f;
+    variables[64] = 2.523636e-5f;
+    variables[65] = 2.52e-5f;
+    variables[66] = 2.52e-5f;
+    variables[67] = 8.1892e-5f;
+    variables[68] = 8.19e-5f;
+    variables[69] = 8.19e-5f;
+    variables[70] = 0.00079704f;
+    variables[71] = 0.000738f;
+    variables[72] = 0.000797f;
+    variables[73] = 0.016f;
+    variables[74] = 0.0208f;
+    variables[75] = 0.016f;
+    variables[76] = 0.0003445f;
+    variables[77] = 0.000345f;
+    variables[78] = 0.000518f;
+    variables[79] = 0.0104f;
+    variables[80] = 0.0104f;
+    variables[81] = 0.0104f;
+    variables[82] = 5.81818e-5f;
+    variables[83] = 5.8e-5f;
+    variables[84] = 5.8e-5f;
+    variables[85] = 0.0001888f;
+    variables[86] = 0.000189f;
+    variables[87] = 0.000189f;
+    variables[88] = 0.0001f;
+    variables[89] = 0.5f;
+    variables[90] = 2.7229e-6f;
+    variables[91] = 2.8e-6f;
+    variables[92] = 2.7e-6f;
+    variables[93] = 8.83584e-6f;
+    variables[94] = 8.8e-6f;
+    variables[95] = 8.8e-6f;
+    variables[96] = 0.0f;
+    variables[97] = 0.0f;
+    variables[98] = 0.0f;
+    variables[99] = 1.204e-6f;
+    variables[100] = 3.7e-7f;
+    variables[101] = 1.2e-6f;
+    variables[102] = 0.621f;
+    variables[103] = 5.64f;
+    variables[104] = 0.04782545f;
+    variables[105] = 0.0478f;
+    variables[106] = 0.0478f;
+    variables[107] = 0.1551936f;
+    variables[108] = 0.16f;
+    variables[109] = 0.16f;
+    states[0] = 0.092361701692f;
+    states[1] = 0.015905380261f;
+    states[2] = 0.01445216109f;
+    states[3] = 0.04804900895f;
+    states[4] = 0.48779845203f;
+    states[5] = 0.42074047435f;
+    states[6] = 0.038968420558f;
+    states[7] = 0.29760539675f;
+    states[8] = 0.064402950262f;
+    states[9] = 0.13034201158f;
+    states[10] = 0.46960956028f;
+    states[11] = 0.87993375273f;
+    states[12] = 0.082293827208f;
+    states[13] = 0.03889291759f;
+    states[14] = -39.013558536f;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[110] = (variables[56] == 0.0f)?1.07f*(3.0f*variables[57]-0.1f)/(3.0f*(1.0f+0.7745f*expf(-(3.0f*variables[57]-2.05f)/0.295f))):(variables[56] == 1.0f)?variables[53]*variables[57]/(1.0f+0.7745f*expf(-(3.0f*variables[57]-2.05f)/0.295f)):1.07f*29.0f*variables[57]/(30.0f*(1.0f+0.7745f*expf(-(29.0f*variables[57]-24.5f)/1.95f)));
+    variables[111] = variables[50]+variables[110]*(variables[51]-variables[50]);
+    variables[112] = (variables[56] == 0.0f)?variables[84]+variables[110]*(variables[87]-variables[84]):(variables[56] == 1.0f)?variables[82]+variables[110]*(variables[85]-variables[82]):variables[83]+variables[110]*(variables[86]-variables[83]);
+    variables[113] = (variables[56] == 0.0f)?variables[66]+variables[110]*(variables[69]-variables[66]):(variables[56] == 1.0f)?variables[64]+variables[110]*(variables[67]-variables[64]):variables[65]+variables[110]*(variables[68]-variables[65]);
+    variables[114] = (variables[56] == 0.0f)?variables[16]+variables[110]*(variables[19]-variables[16]):(variables[56] == 1.0f)?variables[14]+variables[110]*(variables[17]-variables[14]):variables[15]+variables[110]*(variables[18]-variables[15]);
+    variables[115] = (variables[56] == 0.0f)?variables[92]+variables[110]*(variables[95]-variables[92]):(variables[56] == 1.0f)?variables[90]+variables[110]*(variables[93]-variables[90]):variables[91]+variables[110]*(variables[94]-variables[91]);
+    variables[117] = (variables[56] == 0.0f)?variables[106]+variables[110]*(variables[109]-variables[106]):(variables[56] == 1.0f)?variables[104]+variables[110]*(variables[107]-variables[104]):variables[105]+variables[110]*(variables[108]-variables[105]);
+    variables[119] = (variables[56] == 0.0f)?variables[60]+variables[110]*(variables[63]-variables[60]):(variables[56] == 1.0f)?variables[58]+variables[110]*(variables[61]-variables[58]):variables[59]+variables[110]*(variables[62]-variables[59]);
+    variables[120] = variables[119]*variables[44]/(variables[44]+0.0004f);
+    variables[121] = variables[54]*variables[55]/variables[52]*logf(variables[49]/variables[48]);
+    variables[122] = variables[54]*variables[55]/variables[52]*logf(variables[47]/variables[46]);
+    variables[123] = variables[54]*variables[55]/(2.0f*variables[52])*logf(variables[45]/variables[44]);
+    variables[124] = (variables[56] == 0.0f)?variables[54]*variables[55]/variables[52]*logf((variables[47]+0.12f*variables[49])/(variables[46]+0.12f*variables[48])):variables[54]*variables[55]/variables[52]*logf((variables[47]+0.03f*variables[49])/(variables[46]+0.03f*variables[48]));
+    variables[125] = (variables[56] == 0.0f)?variables[98]+variables[110]*(variables[101]-variables[98]):(variables[56] == 1.0f)?variables[96]+variables[110]*(variables[99]-variables[96]):variables[97]+variables[110]*(variables[100]-variables[97]);
+    variables[134] = (variables[56] == 0.0f)?variables[3]+variables[110]*(variables[6]-variables[3]):(variables[56] == 1.0f)?variables[1]+variables[110]*(variables[4]-variables[1]):variables[2]+variables[110]*(variables[5]-variables[2]);
+    variables[144] = (variables[56] == 0.0f)?variables[10]+variables[110]*(variables[13]-variables[10]):(variables[56] == 1.0f)?variables[8]+variables[110]*(variables[11]-variables[8]):variables[9]+variables[110]*(variables[12]-variables[9]);
+    variables[154] = (variables[56] == 0.0f)?variables[28]+variables[110]*(variables[31]-variables[28]):(variables[56] == 1.0f)?variables[26]+variables[110]*(variables[29]-variables[26]):variables[27]+variables[110]*(variables[30]-variables[27]);
+    variables[155] = (variables[56] == 0.0f)?variables[22]+variables[110]*(variables[25]-variables[22]):(variables[56] == 1.0f)?variables[20]+variables[110]*(variables[23]-variables[20]):variables[21]+variables[110]*(variables[24]-variables[21]);
+    variables[162] = (variables[56] == 0.0f)?variables[72]+variables[110]*(variables[75]-variables[72]):(variables[56] == 1.0f)?variables[70]+variables[110]*(variables[73]-variables[70]):variables[71]+variables[110]*(variables[74]-variables[71]);
+    variables[168] = (variables[56] == 0.0f)?0.002f:(variables[56] == 1.0f)?0.002f:0.006f;
+    variables[170] = (variables[56] == 0.0f)?variables[78]+variables[110]*(variables[81]-variables[78]):(variables[56] == 1.0f)?variables[76]+variables[110]*(variables[79]-variables[76]):variables[77]+variables[110]*(variables[80]-variables[77]);
+    variables[174] = (variables[56] == 0.0f)?variables[40]+variables[110]*(variables[43]-variables[40]):(variables[56] == 1.0f)?variables[38]+variables[110]*(variables[41]-variables[38]):variables[39]+variables[110]*(variables[42]-variables[39]);
+    variables[176] = (variables[56] == 0.0f)?variables[34]+variables[110]*(variables[37]-variables[34]):(variables[56] == 1.0f)?variables[32]+variables[110]*(variables[35]-variables[32]):variables[33]+variables[110]*(variables[36]-variables[33]);
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    variables[126] = (variables[56] == 0.0f)?powf(1.0f/(1.0f+expf(-states[14]/5.46f)), 1.0f/3.0f):powf(1.0f/(1.0f+expf(-(states[14]+30.32f)/5.46f)), 1.0f/3.0f);
+    variables[127] = (variables[56] == 0.0f)?0.0006247f/(0.832f*expf(-0.335f*(states[14]+56.7f))+0.627f*expf(0.082f*(states[14]+65.01f)))+4.0e-5f:0.0006247f/(0.8322166f*expf(-0.33566f*(states[14]+56.7062f))+0.6274f*expf(0.0823f*(states[14]+65.0131f)))+4.569e-5f;
+    rates[0] = (variables[126]-states[0])/variables[127];
+    variables[130] = 1.0f/(1.0f+expf((states[14]+66.1f)/6.4f));
+    variables[132] = 3.717e-6f*expf(-0.2815f*(states[14]+17.11f))/(1.0f+0.003732f*expf(-0.3426f*(states[14]+37.76f)))+0.0005977f;
+    rates[1] = (variables[130]-states[1])/variables[132];
+    variables[131] = variables[130];
+    variables[133] = 3.186e-8f*expf(-0.6219f*(states[14]+18.8f))/(1.0f+7.189e-5f*expf(-0.6683f*(states[14]+34.07f)))+0.003556f;
+    rates[2] = (variables[131]-states[2])/variables[133];
+    variables[139] = (variables[56] == 0.0f)?1.0f/(1.0f+expf(-(states[14]+23.1f)/6.0f)):(variables[56] == 1.0f)?1.0f/(1.0f+expf(-(states[14]+22.3f+0.8f*variables[110])/6.0f)):1.0f/(1.0f+expf(-(states[14]+22.2f)/6.0f));
+    variables[136] = (variables[56] == 0.0f)?-28.38f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f):(variables[56] == 1.0f)?-28.39f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f):-28.4f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f);
+    variables[137] = (variables[56] == 1.0f)?11.43f*(states[14]-5.0f)/(expf(0.4f*(states[14]-5.0f))-1.0f):11.42f*(states[14]-5.0f)/(expf(0.4f*(states[14]-5.0f))-1.0f);
+    variables[138] = 2.0f/(variables[136]+variables[137]);
+    rates[3] = (variables[139]-states[3])/variables[138];
+    variables[143] = 1.0f/(1.0f+expf((states[14]+45.0f)/5.0f));
+    variables[140] = (variables[56] == 1.0f)?3.75f*(states[14]+28.0f)/(expf((states[14]+28.0f)/4.0f)-1.0f):3.12f*(states[14]+28.0f)/(expf((states[14]+28.0f)/4.0f)-1.0f);
+    variables[141] = (variables[56] == 1.0f)?30.0f/(1.0f+expf(-(states[14]+28.0f)/4.0f)):25.0f/(1.0f+expf(-(states[14]+28.0f)/4.0f));
+    variables[142] = (variables[56] == 1.0f)?(1.2f-0.2f*variables[110])/(variables[140]+variables[141]):1.0f/(variables[140]+variables[141]);
+    rates[4] = (variables[143]-states[4])/variables[142];
+    variables[149] = 1.0f/(1.0f+expf(-(states[14]+37.0f)/6.8f));
+    variables[146] = 1068.0f*expf((states[14]+26.3f)/30.0f);
+    variables[147] = 1068.0f*expf(-(states[14]+26.3f)/30.0f);
+    variables[148] = 1.0f/(variables[146]+variables[147]);
+    rates[5] = (variables[149]-states[5])/variables[148];
+    variables[153] = 1.0f/(1.0f+expf((states[14]+71.0f)/9.0f));
+    variables[150] = (variables[56] == 1.0f)?15.3f*expf(-(states[14]+71.0f+0.7f*variables[110])/83.3f):15.3f*expf(-(states[14]+71.7f)/83.3f);
+    variables[151] = (variables[56] == 1.0f)?15.0f*expf((states[14]+71.0f)/15.38f):15.0f*expf((states[14]+71.7f)/15.38f);
+    variables[152] = 1.0f/(variables[150]+variables[151]);
+    rates[6] = (variables[153]-states[6])/variables[152];
+    variables[158] = 1.0f/(1.0f+expf((states[14]+59.37f)/13.1f));
+    variables[159] = (variables[56] == 0.0f)?0.0101f+0.06517f/(0.57f*expf(-0.08f*(states[14]+49.0f)))+2.4e-5f*expf(0.1f*(states[14]+50.93f)):(variables[56] == 1.0f)?0.001f/3.0f*(30.31f+195.5f/(0.5686f*expf(-0.08161f*(states[14]+39.0f+10.0f*variables[110]))+0.7174f*expf((0.2719f-0.1719f*variables[110])*1.0f*(states[14]+40.93f+10.0f*variables[110])))):0.0101f+0.06517f/(0.5686f*expf(-0.08161f*(states[14]+39.0f))+0.7174f*expf(0.2719f*(states[14]+40.93f)));
+    rates[7] = (variables[158]-states[7])/variables[159];
+    variables[160] = 1.0f/(1.0f+expf(-(states[14]-10.93f)/19.7f));
+    variables[161] = (variables[56] == 0.0f)?0.001f*(2.98f+15.59f/(1.037f*expf(0.09f*(states[14]+30.61f))+0.369f*expf(-0.12f*(states[14]+23.84f)))):(variables[56] == 1.0f)?0.0025f*(1.191f+7.838f/(1.037f*expf(0.09012f*(states[14]+30.61f))+0.369f*expf(-0.119f*(states[14]+23.84f)))):0.001f*(2.98f+19.59f/(1.037f*expf(0.09012f*(states[14]+30.61f))+0.369f*expf(-0.119f*(states[14]+23.84f))));
+    rates[8] = (variables[160]-states[8])/variables[161];
+    variables[164] = (variables[56] != 2.0f)?1.0f/(1.0f+expf(-(states[14]+14.2f)/10.6f)):1.0f/(1.0f+expf(-(states[14]+13.2f)/10.6f));
+    variables[165] = (variables[56] != 2.0f)?1.0f/(37.2f*expf((states[14]-9.0f)/15.9f)+0.96f*expf(-(states[14]-9.0f)/22.5f)):1.0f/(37.2f*expf((states[14]-10.0f)/15.9f)+0.96f*expf(-(states[14]-10.0f)/22.5f));
+    rates[9] = (variables[164]-states[9])/variables[165];
+    variables[166] = variables[164];
+    variables[167] = (variables[56] != 2.0f)?1.0f/(4.2f*expf((states[14]-9.0f)/17.0f)+0.15f*expf(-(states[14]-9.0f)/21.6f)):1.0f/(4.2f*expf((states[14]-10.0f)/17.0f)+0.15f*expf(-(states[14]-10.0f)/21.6f));
+    rates[10] = (variables[166]-states[10])/variables[167];
+    variables[169] = 1.0f/(1.0f+expf((states[14]+18.6f)/10.1f));
+    rates[11] = (variables[169]-states[11])/variables[168];
+    variables[172] = 14.0f/(1.0f+expf(-(states[14]-40.0f)/9.0f));
+    variables[173] = 1.0f*expf(-states[14]/45.0f);
+    rates[12] = variables[172]*(1.0f-states[12])-variables[173]*states[12];
+    variables[178] = (variables[56] == 0.0f)?1.0f*expf(-(states[14]+78.91f)/26.62f):1.0f*expf(-(states[14]+78.91f)/26.63f);
+    variables[179] = 1.0f*expf((states[14]+75.13f)/21.25f);
+    rates[13] = variables[178]*(1.0f-states[13])-variables[179]*states[13];
+    variables[118] = variables[117]*powf(variables[48]/(variables[103]+variables[48]), 3.0f)*powf(variables[47]/(variables[102]+variables[47]), 2.0f)*1.6f/(1.5f+expf(-(states[14]+60.0f)/40.0f));
+    variables[116] = (variables[56] == 0.0f)?variables[115]*(powf(variables[48], 3.0f)*variables[45]*expf(0.03743f*states[14]*variables[89])-powf(variables[49], 3.0f)*variables[44]*expf(0.0374f*states[14]*(variables[89]-1.0f)))/(1.0f+variables[88]*(variables[44]*powf(variables[49], 3.0f)+variables[45]*powf(variables[48], 3.0f))):variables[115]*(powf(variables[48], 3.0f)*variables[45]*expf(0.03743f*states[14]*variables[89])-powf(variables[49], 3.0f)*variables[44]*expf(0.03743f*states[14]*(variables[89]-1.0f)))/(1.0f+variables[88]*(variables[44]*powf(variables[49], 3.0f)+variables[45]*powf(variables[48], 3.0f)));
+    variables[177] = (variables[56] != 2.0f)?variables[176]*states[13]*(states[14]-variables[122]):variables[176]*states[13]*(states[14]+102.0f);
+    variables[175] = (variables[56] != 2.0f)?variables[174]*states[13]*(states[14]-variables[121]):variables[174]*states[13]*(states[14]-77.6f);
+    variables[171] = variables[170]*powf(states[12], 2.0f)*(states[14]-variables[124]);
+    variables[157] = variables[155]*states[8]*(states[14]-variables[122]);
+    variables[156] = variables[154]*states[7]*states[8]*(states[14]-variables[122]);
+    variables[145] = variables[144]*states[5]*states[6]*(states[14]-variables[7]);
+    variables[135] = variables[134]*(states[4]*states[3]+0.006f/(1.0f+expf(-(states[14]+14.1f)/6.0f)))*(states[14]-variables[0]);
+    variables[128] = (variables[56] == 0.0f)?0.0952f*expf(-0.063f*(states[14]+34.4f))/(1.0f+1.66f*expf(-0.225f*(states[14]+63.7f)))+0.0869f:0.09518f*expf(-0.06306f*(states[14]+34.4f))/(1.0f+1.662f*expf(-0.2251f*(states[14]+63.7f)))+0.08693f;
+    variables[129] = (1.0f-variables[128])*states[1]+variables[128]*states[2];
+    variables[183] = variables[125]*powf(states[0], 3.0f)*variables[129]*variables[49]*powf(variables[52], 2.0f)/(variables[54]*variables[55])*(expf((states[14]-variables[121])*variables[52]/(variables[54]*variables[55]))-1.0f)/(expf(states[14]*variables[52]/(variables[54]*variables[55]))-1.0f)*states[14];
+    variables[181] = variables[113]*(states[14]-variables[122]);
+    variables[182] = variables[114]*(states[14]-variables[123]);
+    variables[180] = variables[112]*(states[14]-variables[121]);
+    variables[163] = 0.6f*states[9]+0.4f*states[10];
+    variables[184] = variables[162]*variables[163]*states[11]*(states[14]-variables[122]);
+    rates[14] = -1.0f/variables[111]*(variables[183]+variables[135]+variables[145]+variables[156]+variables[157]+variables[184]+variables[171]+variables[175]+variables[177]+variables[180]+variables[182]+variables[181]+variables[116]+variables[118]+variables[120]);
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[116] = (variables[56] == 0.0f)?variables[115]*(powf(variables[48], 3.0f)*variables[45]*expf(0.03743f*states[14]*variables[89])-powf(variables[49], 3.0f)*variables[44]*expf(0.0374f*states[14]*(variables[89]-1.0f)))/(1.0f+variables[88]*(variables[44]*powf(variables[49], 3.0f)+variables[45]*powf(variables[48], 3.0f))):variables[115]*(powf(variables[48], 3.0f)*variables[45]*expf(0.03743f*states[14]*variables[89])-powf(variables[49], 3.0f)*variables[44]*expf(0.03743f*states[14]*(variables[89]-1.0f)))/(1.0f+variables[88]*(variables[44]*powf(variables[49], 3.0f)+variables[45]*powf(variables[48], 3.0f)));
+    variables[118] = variables[117]*powf(variables[48]/(variables[103]+variables[48]), 3.0f)*powf(variables[47]/(variables[102]+variables[47]), 2.0f)*1.6f/(1.5f+expf(-(states[14]+60.0f)/40.0f));
+    variables[126] = (variables[56] == 0.0f)?powf(1.0f/(1.0f+expf(-states[14]/5.46f)), 1.0f/3.0f):powf(1.0f/(1.0f+expf(-(states[14]+30.32f)/5.46f)), 1.0f/3.0f);
+    variables[127] = (variables[56] == 0.0f)?0.0006247f/(0.832f*expf(-0.335f*(states[14]+56.7f))+0.627f*expf(0.082f*(states[14]+65.01f)))+4.0e-5f:0.0006247f/(0.8322166f*expf(-0.33566f*(states[14]+56.7062f))+0.6274f*expf(0.0823f*(states[14]+65.0131f)))+4.569e-5f;
+    variables[128] = (variables[56] == 0.0f)?0.0952f*expf(-0.063f*(states[14]+34.4f))/(1.0f+1.66f*expf(-0.225f*(states[14]+63.7f)))+0.0869f:0.09518f*expf(-0.06306f*(states[14]+34.4f))/(1.0f+1.662f*expf(-0.2251f*(states[14]+63.7f)))+0.08693f;
+    variables[129] = (1.0f-variables[128])*states[1]+variables[128]*states[2];
+    variables[130] = 1.0f/(1.0f+expf((states[14]+66.1f)/6.4f));
+    variables[131] = variables[130];
+    variables[132] = 3.717e-6f*expf(-0.2815f*(states[14]+17.11f))/(1.0f+0.003732f*expf(-0.3426f*(states[14]+37.76f)))+0.0005977f;
+    variables[133] = 3.186e-8f*expf(-0.6219f*(states[14]+18.8f))/(1.0f+7.189e-5f*expf(-0.6683f*(states[14]+34.07f)))+0.003556f;
+    variables[135] = variables[134]*(states[4]*states[3]+0.006f/(1.0f+expf(-(states[14]+14.1f)/6.0f)))*(states[14]-variables[0]);
+    variables[136] = (variables[56] == 0.0f)?-28.38f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f):(variables[56] == 1.0f)?-28.39f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f):-28.4f*(states[14]+35.0f)/(expf(-(states[14]+35.0f)/2.5f)-1.0f)-84.9f*states[14]/(expf(-0.208f*states[14])-1.0f);
+    variables[137] = (variables[56] == 1.0f)?11.43f*(states[14]-5.0f)/(expf(0.4f*(states[14]-5.0f))-1.0f):11.42f*(states[14]-5.0f)/(expf(0.4f*(states[14]-5.0f))-1.0f);
+    variables[138] = 2.0f/(variables[136]+variables[137]);
+    variables[139] = (variables[56] == 0.0f)?1.0f/(1.0f+expf(-(states[14]+23.1f)/6.0f)):(variables[56] == 1.0f)?1.0f/(1.0f+expf(-(states[14]+22.3f+0.8f*variables[110])/6.0f)):1.0f/(1.0f+expf(-(states[14]+22.2f)/6.0f));
+    variables[140] = (variables[56] == 1.0f)?3.75f*(states[14]+28.0f)/(expf((states[14]+28.0f)/4.0f)-1.0f):3.12f*(states[14]+28.0f)/(expf((states[14]+28.0f)/4.0f)-1.0f);
+    variables[141] = (variables[56] == 1.0f)?30.0f/(1.0f+expf(-(states[14]+28.0f)/4.0f)):25.0f/(1.0f+expf(-(states[14]+28.0f)/4.0f));
+    variables[142] = (variables[56] == 1.0f)?(1.2f-0.2f*variables[110])/(variables[140]+variables[141]):1.0f/(variables[140]+variables[141]);
+    variables[143] = 1.0f/(1.0f+expf((states[14]+45.0f)/5.0f));
+    variables[145] = variables[144]*states[5]*states[6]*(states[14]-variables[7]);
+    variables[146] = 1068.0f*expf((states[14]+26.3f)/30.0f);
+    variables[147] = 1068.0f*expf(-(states[14]+26.3f)/30.0f);
+    variables[148] = 1.0f/(variables[146]+variables[147]);
+    variables[149] = 1.0f/(1.0f+expf(-(states[14]+37.0f)/6.8f));
+    variables[150] = (variables[56] == 1.0f)?15.3f*expf(-(states[14]+71.0f+0.7f*variables[110])/83.3f):15.3f*expf(-(states[14]+71.7f)/83.3f);
+    variables[151] = (variables[56] == 1.0f)?15.0f*expf((states[14]+71.0f)/15.38f):15.0f*expf((states[14]+71.7f)/15.38f);
+    variables[152] = 1.0f/(variables[150]+variables[151]);
+    variables[153] = 1.0f/(1.0f+expf((states[14]+71.0f)/9.0f));
+    variables[156] = variables[154]*states[7]*states[8]*(states[14]-variables[122]);
+    variables[157] = variables[155]*states[8]*(states[14]-variables[122]);
+    variables[158] = 1.0f/(1.0f+expf((states[14]+59.37f)/13.1f));
+    variables[159] = (variables[56] == 0.0f)?0.0101f+0.06517f/(0.57f*expf(-0.08f*(states[14]+49.0f)))+2.4e-5f*expf(0.1f*(states[14]+50.93f)):(variables[56] == 1.0f)?0.001f/3.0f*(30.31f+195.5f/(0.5686f*expf(-0.08161f*(states[14]+39.0f+10.0f*variables[110]))+0.7174f*expf((0.2719f-0.1719f*variables[110])*1.0f*(states[14]+40.93f+10.0f*variables[110])))):0.0101f+0.06517f/(0.5686f*expf(-0.08161f*(states[14]+39.0f))+0.7174f*expf(0.2719f*(states[14]+40.93f)));
+    variables[160] = 1.0f/(1.0f+expf(-(states[14]-10.93f)/19.7f));
+    variables[161] = (variables[56] == 0.0f)?0.001f*(2.98f+15.59f/(1.037f*expf(0.09f*(states[14]+30.61f))+0.369f*expf(-0.12f*(states[14]+23.84f)))):(variables[56] == 1.0f)?0.0025f*(1.191f+7.838f/(1.037f*expf(0.09012f*(states[14]+30.61f))+0.369f*expf(-0.119f*(states[14]+23.84f)))):0.001f*(2.98f+19.59f/(1.037f*expf(0.09012f*(states[14]+30.61f))+0.369f*expf(-0.119f*(states[14]+23.84f))));
+    variables[163] = 0.6f*states[9]+0.4f*states[10];
+    variables[164] = (variables[56] != 2.0f)?1.0f/(1.0f+expf(-(states[14]+14.2f)/10.6f)):1.0f/(1.0f+expf(-(states[14]+13.2f)/10.6f));
+    variables[165] = (variables[56] != 2.0f)?1.0f/(37.2f*expf((states[14]-9.0f)/15.9f)+0.96f*expf(-(states[14]-9.0f)/22.5f)):1.0f/(37.2f*expf((states[14]-10.0f)/15.9f)+0.96f*expf(-(states[14]-10.0f)/22.5f));
+    variables[166] = variables[164];
+    variables[167] = (variables[56] != 2.0f)?1.0f/(4.2f*expf((states[14]-9.0f)/17.0f)+0.15f*expf(-(states[14]-9.0f)/21.6f)):1.0f/(4.2f*expf((states[14]-10.0f)/17.0f)+0.15f*expf(-(states[14]-10.0f)/21.6f));
+    variables[169] = 1.0f/(1.0f+expf((states[14]+18.6f)/10.1f));
+    variables[171] = variables[170]*powf(states[12], 2.0f)*(states[14]-variables[124]);
+    variables[172] = 14.0f/(1.0f+expf(-(states[14]-40.0f)/9.0f));
+    variables[173] = 1.0f*expf(-states[14]/45.0f);
+    variables[175] = (variables[56] != 2.0f)?variables[174]*states[13]*(states[14]-variables[121]):variables[174]*states[13]*(states[14]-77.6f);
+    variables[177] = (variables[56] != 2.0f)?variables[176]*states[13]*(states[14]-variables[122]):variables[176]*states[13]*(states[14]+102.0f);
+    variables[178] = (variables[56] == 0.0f)?1.0f*expf(-(states[14]+78.91f)/26.62f):1.0f*expf(-(states[14]+78.91f)/26.63f);
+    variables[179] = 1.0f*expf((states[14]+75.13f)/21.25f);
+    variables[180] = variables[112]*(states[14]-variables[121]);
+    variables[181] = variables[113]*(states[14]-variables[122]);
+    variables[182] = variables[114]*(states[14]-variables[123]);
+    variables[183] = variables[125]*powf(states[0], 3.0f)*variables[129]*variables[49]*powf(variables[52], 2.0f)/(variables[54]*variables[55])*(expf((states[14]-variables[121])*variables[52]/(variables[54]*variables[55]))-1.0f)/(expf(states[14]*variables[52]/(variables[54]*variables[55]))-1.0f)*states[14];
+    variables[184] = variables[162]*variables[163]*states[11]*(states[14]-variables[122]);
+}
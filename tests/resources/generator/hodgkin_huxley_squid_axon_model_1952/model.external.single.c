@@ -0,0 +1,98 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.external.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 3;
+const size_t VARIABLE_COUNT = 19;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"V", "millivolt", "membrane", EXTERNAL},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"i_Na", "microA_per_cm2", "sodium_channel", EXTERNAL},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", EXTERNAL},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[1] = 0.3f;
+    variables[2] = 1.0f;
+    variables[3] = 0.0f;
+    variables[4] = 36.0f;
+    variables[5] = 120.0f;
+    states[0] = 0.05f;
+    states[1] = 0.6f;
+    states[2] = 0.325f;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[7] = variables[3]-10.613f;
+    variables[9] = variables[3]-115.0f;
+    variables[15] = variables[3]+12.0f;
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables, ExternalVariable externalVariable)
+{
+    variables[0] = externalVariable(voi, states, rates, variables, 0);
+    variables[11] = 0.1f*(variables[0]+25.0f)/(expf((variables[0]+25.0f)/10.0f)-1.0f);
+    variables[12] = 4.0f*expf(variables[0]/18.0f);
+    rates[0] = variables[11]*(1.0f-states[0])-variables[12]*states[0];
+    variables[13] = 0.07f*expf(variables[0]/20.0f);
+    variables[14] = 1.0f/(expf((variables[0]+30.0f)/10.0f)+1.0f);
+    rates[1] = variables[13]*(1.0f-states[1])-variables[14]*states[1];
+    variables[17] = externalVariable(voi, states, rates, variables, 17);
+    variables[18] = 0.125f*expf(variables[0]/80.0f);
+    rates[2] = variables[17]*(1.0f-states[2])-variables[18]*states[2];
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables, ExternalVariable externalVariable)
+{
+    variables[6] = ((voi >= 10.0f) && (voi <= 10.5f))?-20.0f:0.0f;
+    variables[8] = variables[1]*(variables[0]-variables[7]);
+    variables[10] = externalVariable(voi, states, rates, variables, 10);
+    variables[16] = variables[4]*powf(states[2], 4.0f)*(variables[0]-variables[15]);
+}
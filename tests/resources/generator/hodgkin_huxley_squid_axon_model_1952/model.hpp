@@ -0,0 +1,149 @@
+/* The content of this file was generated using the C++ profile of libCellML 0.2.0. */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+struct Model
+{
+    static constexpr char VERSION[] = "0.2.0";
+    static constexpr char LIBCELLML_VERSION[] = "0.2.0";
+
+    static constexpr size_t STATE_COUNT = 4;
+    static constexpr size_t VARIABLE_COUNT = 18;
+
+    enum class VariableType
+    {
+        CONSTANT,
+        COMPUTED_CONSTANT,
+        ALGEBRAIC
+    };
+
+    struct VariableInfo
+    {
+        char name[8];
+        char units[16];
+        char component[25];
+    };
+
+    struct VariableInfoWithType
+    {
+        char name[8];
+        char units[16];
+        char component[25];
+        VariableType type;
+    };
+
+    static constexpr VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+    static constexpr std::array<VariableInfo, STATE_COUNT> STATE_INFO = {{
+        {"m", "dimensionless", "sodium_channel_m_gate"},
+        {"h", "dimensionless", "sodium_channel_h_gate"},
+        {"n", "dimensionless", "potassium_channel_n_gate"},
+        {"V", "millivolt", "membrane"}
+    }};
+
+    static constexpr std::array<VariableInfoWithType, VARIABLE_COUNT> VARIABLE_INFO = {{
+        {"g_L", "milliS_per_cm2", "leakage_current", VariableType::CONSTANT},
+        {"Cm", "microF_per_cm2", "membrane", VariableType::CONSTANT},
+        {"E_R", "millivolt", "membrane", VariableType::CONSTANT},
+        {"g_K", "milliS_per_cm2", "potassium_channel", VariableType::CONSTANT},
+        {"g_Na", "milliS_per_cm2", "sodium_channel", VariableType::CONSTANT},
+        {"i_Stim", "microA_per_cm2", "membrane", VariableType::ALGEBRAIC},
+        {"E_L", "millivolt", "leakage_current", VariableType::COMPUTED_CONSTANT},
+        {"i_L", "microA_per_cm2", "leakage_current", VariableType::ALGEBRAIC},
+        {"E_Na", "millivolt", "sodium_channel", VariableType::COMPUTED_CONSTANT},
+        {"i_Na", "microA_per_cm2", "sodium_channel", VariableType::ALGEBRAIC},
+        {"alpha_m", "per_millisecond", "sodium_channel_m_gate", VariableType::ALGEBRAIC},
+        {"beta_m", "per_millisecond", "sodium_channel_m_gate", VariableType::ALGEBRAIC},
+        {"alpha_h", "per_millisecond", "sodium_channel_h_gate", VariableType::ALGEBRAIC},
+        {"beta_h", "per_millisecond", "sodium_channel_h_gate", VariableType::ALGEBRAIC},
+        {"E_K", "millivolt", "potassium_channel", VariableType::COMPUTED_CONSTANT},
+        {"i_K", "microA_per_cm2", "potassium_channel", VariableType::ALGEBRAIC},
+        {"alpha_n", "per_millisecond", "potassium_channel_n_gate", VariableType::ALGEBRAIC},
+        {"beta_n", "per_millisecond", "potassium_channel_n_gate", VariableType::ALGEBRAIC}
+    }};
+
+    template<typename Real>
+    using States = std::array<Real, STATE_COUNT>;
+
+    template<typename Real>
+    static States<Real> createStatesArray()
+    {
+        return {};
+    }
+
+    template<typename Real>
+    using Variables = std::array<Real, VARIABLE_COUNT>;
+
+    template<typename Real>
+    static Variables<Real> createVariablesArray()
+    {
+        return {};
+    }
+
+    template<typename Real>
+    static void initialiseStatesAndConstants([[maybe_unused]] States<Real> &states, [[maybe_unused]] Variables<Real> &variables)
+    {
+        using namespace std;
+
+        variables[0] = Real(0.3);
+        variables[1] = Real(1.0);
+        variables[2] = Real(0.0);
+        variables[3] = Real(36.0);
+        variables[4] = Real(120.0);
+        states[0] = Real(0.05);
+        states[1] = Real(0.6);
+        states[2] = Real(0.325);
+        states[3] = Real(0.0);
+    }
+
+    template<typename Real>
+    static void computeComputedConstants([[maybe_unused]] Variables<Real> &variables)
+    {
+        using namespace std;
+
+        variables[6] = variables[2]-Real(10.613);
+        variables[8] = variables[2]-Real(115.0);
+        variables[14] = variables[2]+Real(12.0);
+    }
+
+    template<typename Real>
+    static void computeRates([[maybe_unused]] Real voi, [[maybe_unused]] const States<Real> &states, [[maybe_unused]] States<Real> &rates, [[maybe_unused]] Variables<Real> &variables)
+    {
+        using namespace std;
+
+        variables[10] = Real(0.1)*(states[3]+Real(25.0))/(exp((states[3]+Real(25.0))/Real(10.0))-Real(1.0));
+        variables[11] = Real(4.0)*exp(states[3]/Real(18.0));
+        rates[0] = variables[10]*(Real(1.0)-states[0])-variables[11]*states[0];
+        variables[12] = Real(0.07)*exp(states[3]/Real(20.0));
+        variables[13] = Real(1.0)/(exp((states[3]+Real(30.0))/Real(10.0))+Real(1.0));
+        rates[1] = variables[12]*(Real(1.0)-states[1])-variables[13]*states[1];
+        variables[16] = Real(0.01)*(states[3]+Real(10.0))/(exp((states[3]+Real(10.0))/Real(10.0))-Real(1.0));
+        variables[17] = Real(0.125)*exp(states[3]/Real(80.0));
+        rates[2] = variables[16]*(Real(1.0)-states[2])-variables[17]*states[2];
+        variables[5] = ((voi >= Real(10.0)) && (voi <= Real(10.5)))?-Real(20.0):Real(0.0);
+        variables[7] = variables[0]*(states[3]-variables[6]);
+        variables[15] = variables[3]*pow(states[2], Real(4.0))*(states[3]-variables[14]);
+        variables[9] = variables[4]*pow(states[0], Real(3.0))*states[1]*(states[3]-variables[8]);
+        rates[3] = -(-variables[5]+variables[9]+variables[15]+variables[7])/variables[1];
+    }
+
+    template<typename Real>
+    static void computeVariables([[maybe_unused]] Real voi, [[maybe_unused]] const States<Real> &states, [[maybe_unused]] const States<Real> &rates, [[maybe_unused]] Variables<Real> &variables)
+    {
+        using namespace std;
+
+        variables[7] = variables[0]*(states[3]-variables[6]);
+        variables[9] = variables[4]*pow(states[0], Real(3.0))*states[1]*(states[3]-variables[8]);
+        variables[10] = Real(0.1)*(states[3]+Real(25.0))/(exp((states[3]+Real(25.0))/Real(10.0))-Real(1.0));
+        variables[11] = Real(4.0)*exp(states[3]/Real(18.0));
+        variables[12] = Real(0.07)*exp(states[3]/Real(20.0));
+        variables[13] = Real(1.0)/(exp((states[3]+Real(30.0))/Real(10.0))+Real(1.0));
+        variables[15] = variables[3]*pow(states[2], Real(4.0))*(states[3]-variables[14]);
+        variables[16] = Real(0.01)*(states[3]+Real(10.0))/(exp((states[3]+Real(10.0))/Real(10.0))-Real(1.0));
+        variables[17] = Real(0.125)*exp(states[3]/Real(80.0));
+    }
+};
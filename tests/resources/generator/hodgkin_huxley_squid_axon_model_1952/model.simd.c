@@ -0,0 +1,150 @@
+/* The content of this file was generated using the C SIMD profile of libCellML 0.2.0. */
+
+#include "model.simd.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+#pragma omp declare simd
+double blend(double condition, double x, double y)
+{
+    return (condition != 0.0)?x:y;
+}
+
+Lanes * createStatesArray()
+{
+    return (Lanes *) malloc(STATE_COUNT*sizeof(Lanes));
+}
+
+Lanes * createVariablesArray()
+{
+    return (Lanes *) malloc(VARIABLE_COUNT*sizeof(Lanes));
+}
+
+void deleteArray(Lanes *array)
+{
+    free(array);
+}
+
+#pragma omp declare simd uniform(states, variables) linear(lane)
+static void initialiseStatesAndConstantsLane(Lanes *states, Lanes *variables, size_t lane)
+{
+    variables[0][lane] = 0.3;
+    variables[1][lane] = 1.0;
+    variables[2][lane] = 0.0;
+    variables[3][lane] = 36.0;
+    variables[4][lane] = 120.0;
+    states[0][lane] = 0.05;
+    states[1][lane] = 0.6;
+    states[2][lane] = 0.325;
+    states[3][lane] = 0.0;
+}
+
+void initialiseStatesAndConstants(Lanes *states, Lanes *variables)
+{
+#pragma omp simd
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        initialiseStatesAndConstantsLane(states, variables, lane);
+    }
+}
+
+#pragma omp declare simd uniform(variables) linear(lane)
+static void computeComputedConstantsLane(Lanes *variables, size_t lane)
+{
+    variables[6][lane] = variables[2][lane]-10.613;
+    variables[8][lane] = variables[2][lane]-115.0;
+    variables[14][lane] = variables[2][lane]+12.0;
+}
+
+void computeComputedConstants(Lanes *variables)
+{
+#pragma omp simd
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        computeComputedConstantsLane(variables, lane);
+    }
+}
+
+#pragma omp declare simd uniform(voi, states, rates, variables) linear(lane)
+static void computeRatesLane(double voi, Lanes *states, Lanes *rates, Lanes *variables, size_t lane)
+{
+    variables[10][lane] = 0.1*(states[3][lane]+25.0)/(exp((states[3][lane]+25.0)/10.0)-1.0);
+    variables[11][lane] = 4.0*exp(states[3][lane]/18.0);
+    rates[0][lane] = variables[10][lane]*(1.0-states[0][lane])-variables[11][lane]*states[0][lane];
+    variables[12][lane] = 0.07*exp(states[3][lane]/20.0);
+    variables[13][lane] = 1.0/(exp((states[3][lane]+30.0)/10.0)+1.0);
+    rates[1][lane] = variables[12][lane]*(1.0-states[1][lane])-variables[13][lane]*states[1][lane];
+    variables[16][lane] = 0.01*(states[3][lane]+10.0)/(exp((states[3][lane]+10.0)/10.0)-1.0);
+    variables[17][lane] = 0.125*exp(states[3][lane]/80.0);
+    rates[2][lane] = variables[16][lane]*(1.0-states[2][lane])-variables[17][lane]*states[2][lane];
+    variables[5][lane] = blend((voi >= 10.0) && (voi <= 10.5), -20.0, 0.0);
+    variables[7][lane] = variables[0][lane]*(states[3][lane]-variables[6][lane]);
+    variables[15][lane] = variables[3][lane]*pow(states[2][lane], 4.0)*(states[3][lane]-variables[14][lane]);
+    variables[9][lane] = variables[4][lane]*pow(states[0][lane], 3.0)*states[1][lane]*(states[3][lane]-variables[8][lane]);
+    rates[3][lane] = -(-variables[5][lane]+variables[9][lane]+variables[15][lane]+variables[7][lane])/variables[1][lane];
+}
+
+void computeRates(double voi, Lanes *states, Lanes *rates, Lanes *variables)
+{
+#pragma omp simd
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        computeRatesLane(voi, states, rates, variables, lane);
+    }
+}
+
+#pragma omp declare simd uniform(voi, states, rates, variables) linear(lane)
+static void computeVariablesLane(double voi, Lanes *states, Lanes *rates, Lanes *variables, size_t lane)
+{
+    variables[7][lane] = variables[0][lane]*(states[3][lane]-variables[6][lane]);
+    variables[9][lane] = variables[4][lane]*pow(states[0][lane], 3.0)*states[1][lane]*(states[3][lane]-variables[8][lane]);
+    variables[10][lane] = 0.1*(states[3][lane]+25.0)/(exp((states[3][lane]+25.0)/10.0)-1.0);
+    variables[11][lane] = 4.0*exp(states[3][lane]/18.0);
+    variables[12][lane] = 0.07*exp(states[3][lane]/20.0);
+    variables[13][lane] = 1.0/(exp((states[3][lane]+30.0)/10.0)+1.0);
+    variables[15][lane] = variables[3][lane]*pow(states[2][lane], 4.0)*(states[3][lane]-variables[14][lane]);
+    variables[16][lane] = 0.01*(states[3][lane]+10.0)/(exp((states[3][lane]+10.0)/10.0)-1.0);
+    variables[17][lane] = 0.125*exp(states[3][lane]/80.0);
+}
+
+void computeVariables(double voi, Lanes *states, Lanes *rates, Lanes *variables)
+{
+#pragma omp simd
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+        computeVariablesLane(voi, states, rates, variables, lane);
+    }
+}
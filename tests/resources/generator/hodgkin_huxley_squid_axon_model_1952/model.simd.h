@@ -0,0 +1,49 @@
+/* The content of this file was generated using the C SIMD profile of libCellML 0.2.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+#ifndef LANE_COUNT
+#    define LANE_COUNT 8
+#endif
+
+typedef double Lanes[LANE_COUNT];
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+
+typedef enum {
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[8];
+    char units[16];
+    char component[25];
+} VariableInfo;
+
+typedef struct {
+    char name[8];
+    char units[16];
+    char component[25];
+    VariableType type;
+} VariableInfoWithType;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfoWithType VARIABLE_INFO[];
+
+Lanes * createStatesArray();
+Lanes * createVariablesArray();
+void deleteArray(Lanes *array);
+
+void initialiseStatesAndConstants(Lanes *states, Lanes *variables);
+void computeComputedConstants(Lanes *variables);
+void computeRates(double voi, Lanes *states, Lanes *rates, Lanes *variables);
+void computeVariables(double voi, Lanes *states, Lanes *rates, Lanes *variables);
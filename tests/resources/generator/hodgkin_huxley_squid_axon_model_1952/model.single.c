@@ -0,0 +1,108 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 0.3f;
+    variables[1] = 1.0f;
+    variables[2] = 0.0f;
+    variables[3] = 36.0f;
+    variables[4] = 120.0f;
+    states[0] = 0.05f;
+    states[1] = 0.6f;
+    states[2] = 0.325f;
+    states[3] = 0.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[6] = variables[2]-10.613f;
+    variables[8] = variables[2]-115.0f;
+    variables[14] = variables[2]+12.0f;
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    variables[10] = 0.1f*(states[3]+25.0f)/(expf((states[3]+25.0f)/10.0f)-1.0f);
+    variables[11] = 4.0f*expf(states[3]/18.0f);
+    rates[0] = variables[10]*(1.0f-states[0])-variables[11]*states[0];
+    variables[12] = 0.07f*expf(states[3]/20.0f);
+    variables[13] = 1.0f/(expf((states[3]+30.0f)/10.0f)+1.0f);
+    rates[1] = variables[12]*(1.0f-states[1])-variables[13]*states[1];
+    variables[16] = 0.01f*(states[3]+10.0f)/(expf((states[3]+10.0f)/10.0f)-1.0f);
+    variables[17] = 0.125f*expf(states[3]/80.0f);
+    rates[2] = variables[16]*(1.0f-states[2])-variables[17]*states[2];
+    variables[5] = ((voi >= 10.0f) && (voi <= 10.5f))?-20.0f:0.0f;
+    variables[7] = variables[0]*(states[3]-variables[6]);
+    variables[15] = variables[3]*powf(states[2], 4.0f)*(states[3]-variables[14]);
+    variables[9] = variables[4]*powf(states[0], 3.0f)*states[1]*(states[3]-variables[8]);
+    rates[3] = -(-variables[5]+variables[9]+variables[15]+variables[7])/variables[1];
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[7] = variables[0]*(states[3]-variables[6]);
+    variables[9] = variables[4]*powf(states[0], 3.0f)*states[1]*(states[3]-variables[8]);
+    variables[10] = 0.1f*(states[3]+25.0f)/(expf((states[3]+25.0f)/10.0f)-1.0f);
+    variables[11] = 4.0f*expf(states[3]/18.0f);
+    variables[12] = 0.07f*expf(states[3]/20.0f);
+    variables[13] = 1.0f/(expf((states[3]+30.0f)/10.0f)+1.0f);
+    variables[15] = variables[3]*powf(states[2], 4.0f)*(states[3]-variables[14]);
+    variables[16] = 0.01f*(states[3]+10.0f)/(expf((states[3]+10.0f)/10.0f)-1.0f);
+    variables[17] = 0.125f*expf(states[3]/80.0f);
+}
@@ -0,0 +1,109 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 17;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"E_L", "millivolt", "leakage_current", CONSTANT},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", CONSTANT},
+    {"g_Na_max", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"i_Leak", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"g_K1", "milliS_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"g_K2", "milliS_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = -60.0f;
+    variables[1] = 0.075f;
+    variables[2] = 12.0f;
+    variables[3] = 40.0f;
+    variables[4] = 400.0f;
+    states[0] = 0.01f;
+    states[1] = 0.8f;
+    states[2] = 0.01f;
+    states[3] = -87.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    variables[8] = 0.1f*(-states[3]-48.0f)/(expf((-states[3]-48.0f)/15.0f)-1.0f);
+    variables[9] = 0.12f*(states[3]+8.0f)/(expf((states[3]+8.0f)/5.0f)-1.0f);
+    rates[0] = variables[8]*(1.0f-states[0])-variables[9]*states[0];
+    variables[10] = 0.17f*expf((-states[3]-90.0f)/20.0f);
+    variables[11] = 1.0f/(1.0f+expf((-states[3]-42.0f)/10.0f));
+    rates[1] = variables[10]*(1.0f-states[1])-variables[11]*states[1];
+    variables[14] = 0.0001f*(-states[3]-50.0f)/(expf((-states[3]-50.0f)/10.0f)-1.0f);
+    variables[15] = 0.002f*expf((-states[3]-90.0f)/80.0f);
+    rates[2] = variables[14]*(1.0f-states[2])-variables[15]*states[2];
+    variables[6] = powf(states[0], 3.0f)*states[1]*variables[4];
+    variables[7] = (variables[6]+0.14f)*(states[3]-variables[3]);
+    variables[5] = variables[1]*(states[3]-variables[0]);
+    variables[12] = 1.2f*expf((-states[3]-90.0f)/50.0f)+0.015f*expf((states[3]+90.0f)/60.0f);
+    variables[13] = 1.2f*powf(states[2], 4.0f);
+    variables[16] = (variables[12]+variables[13])*(states[3]+100.0f);
+    rates[3] = -(variables[7]+variables[16]+variables[5])/variables[2];
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[5] = variables[1]*(states[3]-variables[0]);
+    variables[6] = powf(states[0], 3.0f)*states[1]*variables[4];
+    variables[7] = (variables[6]+0.14f)*(states[3]-variables[3]);
+    variables[8] = 0.1f*(-states[3]-48.0f)/(expf((-states[3]-48.0f)/15.0f)-1.0f);
+    variables[9] = 0.12f*(states[3]+8.0f)/(expf((states[3]+8.0f)/5.0f)-1.0f);
+    variables[10] = 0.17f*expf((-states[3]-90.0f)/20.0f);
+    variables[11] = 1.0f/(1.0f+expf((-states[3]-42.0f)/10.0f));
+    variables[12] = 1.2f*expf((-states[3]-90.0f)/50.0f)+0.015f*expf((states[3]+90.0f)/60.0f);
+    variables[13] = 1.2f*powf(states[2], 4.0f);
+    variables[14] = 0.0001f*(-states[3]-50.0f)/(expf((-states[3]-50.0f)/10.0f)-1.0f);
+    variables[15] = 0.002f*expf((-states[3]-90.0f)/80.0f);
+    variables[16] = (variables[12]+variables[13])*(states[3]+100.0f);
+}
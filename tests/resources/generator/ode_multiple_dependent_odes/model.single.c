@@ -0,0 +1,59 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 1;
+
+const VariableInfo VOI_INFO = {"t", "second", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_x_ode"},
+    {"y", "dimensionless", "my_y_ode"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"epsilon", "dimensionless", "my_y_ode", CONSTANT}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 1.0f;
+    states[0] = -2.0f;
+    states[1] = 0.0f;
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = states[1]*1.0f;
+    rates[1] = (variables[0]*(1.0f-powf(states[0], 2.0f))*states[1]-states[0])*1.0f;
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+}
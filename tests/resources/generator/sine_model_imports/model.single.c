@@ -0,0 +1,74 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.single.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.2.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 10;
+
+const VariableInfo VOI_INFO = {"x", "dimensionless", "main"};
+
+const VariableInfo STATE_INFO[] = {
+    {"sin", "dimensionless", "deriv_approx_sin"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"C", "dimensionless", "main", CONSTANT},
+    {"deriv_approx_initial_value", "dimensionless", "main", CONSTANT},
+    {"sin", "dimensionless", "actual_sin", ALGEBRAIC},
+    {"k2_oPi", "dimensionless", "parabolic_approx_sin", COMPUTED_CONSTANT},
+    {"k2Pi", "dimensionless", "parabolic_approx_sin", COMPUTED_CONSTANT},
+    {"kPi_2", "dimensionless", "parabolic_approx_sin", COMPUTED_CONSTANT},
+    {"kPi", "dimensionless", "parabolic_approx_sin", COMPUTED_CONSTANT},
+    {"kPi_32", "dimensionless", "parabolic_approx_sin", COMPUTED_CONSTANT},
+    {"z", "dimensionless", "parabolic_approx_sin", ALGEBRAIC},
+    {"sin", "dimensionless", "parabolic_approx_sin", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initialiseStatesAndConstants(float *states, float *variables)
+{
+    variables[0] = 0.75f;
+    variables[1] = 0.0f;
+    variables[3] = 2.0f/3.14159265358979f;
+    variables[4] = 2.0f*3.14159265358979f;
+    variables[5] = 3.14159265358979f/2.0f;
+    variables[6] = 3.14159265358979f;
+    variables[7] = 3.0f*3.14159265358979f/2.0f;
+    states[0] = variables[1];
+}
+
+void computeComputedConstants(float *variables)
+{
+}
+
+void computeRates(float voi, float *states, float *rates, float *variables)
+{
+    rates[0] = cosf(voi);
+}
+
+void computeVariables(float voi, float *states, float *rates, float *variables)
+{
+    variables[2] = sinf(voi);
+    variables[8] = (voi < variables[5])?voi*variables[3]-0.5f:(voi < variables[6])?(3.14159265358979f-voi)*variables[3]-0.5f:(voi < variables[7])?(voi-3.14159265358979f)*variables[3]-0.5f:(variables[4]-voi)*variables[3]-0.5f;
+    variables[9] = (voi < variables[5])?-variables[8]*variables[8]+variables[0]+variables[8]:(voi < variables[6])?-variables[8]*variables[8]+variables[0]+variables[8]:(voi < variables[7])?variables[8]*variables[8]-variables[0]-variables[8]:variables[8]*variables[8]-variables[0]-variables[8];
+}
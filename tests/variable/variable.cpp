@@ -529,6 +529,96 @@ TEST(Variable, hasEquivalentVariable)
     EXPECT_FALSE(v3->hasEquivalentVariable(v3));
 }
 
+TEST(Variable, equivalenceIdsFollowEquivalence)
+{
+    libcellml::VariablePtr v1 = libcellml::Variable::create();
+    libcellml::VariablePtr v2 = libcellml::Variable::create();
+    libcellml::VariablePtr v3 = libcellml::Variable::create();
+
+    libcellml::Variable::addEquivalence(v1, v2, "mapping_id", "connection_id");
+    libcellml::Variable::addEquivalence(v2, v3);
+
+    EXPECT_EQ("mapping_id", libcellml::Variable::equivalenceMappingId(v1, v2));
+    EXPECT_EQ("mapping_id", libcellml::Variable::equivalenceMappingId(v2, v1));
+    EXPECT_EQ("connection_id", libcellml::Variable::equivalenceConnectionId(v1, v2));
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v2, v3));
+
+    // The ids of an equivalence are removed along with it.
+
+    libcellml::Variable::removeEquivalence(v1, v2);
+    libcellml::Variable::addEquivalence(v1, v2);
+
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v1, v2));
+    EXPECT_EQ("", libcellml::Variable::equivalenceConnectionId(v1, v2));
+
+    libcellml::Variable::setEquivalenceMappingId(v2, v3, "other_mapping_id");
+
+    EXPECT_EQ("other_mapping_id", libcellml::Variable::equivalenceMappingId(v3, v2));
+
+    v2->removeAllEquivalences();
+
+    EXPECT_EQ(size_t(0), v1->equivalentVariableCount());
+    EXPECT_EQ(size_t(0), v3->equivalentVariableCount());
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v2, v3));
+}
+
+TEST(Variable, indirectEquivalenceIds)
+{
+    libcellml::VariablePtr v1 = libcellml::Variable::create();
+    libcellml::VariablePtr v2 = libcellml::Variable::create();
+    libcellml::VariablePtr v3 = libcellml::Variable::create();
+    libcellml::VariablePtr v4 = libcellml::Variable::create();
+
+    libcellml::Variable::addEquivalence(v1, v2);
+    libcellml::Variable::addEquivalence(v2, v3);
+
+    // Ids can be set for variables that are only indirectly equivalent.
+
+    libcellml::Variable::setEquivalenceMappingId(v1, v3, "mapping_id");
+    libcellml::Variable::setEquivalenceConnectionId(v1, v3, "connection_id");
+
+    EXPECT_EQ("mapping_id", libcellml::Variable::equivalenceMappingId(v1, v3));
+    EXPECT_EQ("mapping_id", libcellml::Variable::equivalenceMappingId(v3, v1));
+    EXPECT_EQ("connection_id", libcellml::Variable::equivalenceConnectionId(v1, v3));
+    EXPECT_EQ("connection_id", libcellml::Variable::equivalenceConnectionId(v3, v1));
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v1, v2));
+
+    // But not for variables that are not equivalent.
+
+    libcellml::Variable::setEquivalenceMappingId(v1, v4, "other_mapping_id");
+
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v1, v4));
+
+    // The ids are kept if the variables become directly equivalent.
+
+    libcellml::Variable::addEquivalence(v1, v3);
+
+    EXPECT_EQ("mapping_id", libcellml::Variable::equivalenceMappingId(v1, v3));
+    EXPECT_EQ("connection_id", libcellml::Variable::equivalenceConnectionId(v3, v1));
+
+    libcellml::Variable::removeEquivalenceMappingId(v1, v3);
+
+    EXPECT_EQ("", libcellml::Variable::equivalenceMappingId(v1, v3));
+}
+
+TEST(Variable, equivalenceToDestroyedVariable)
+{
+    libcellml::VariablePtr v1 = libcellml::Variable::create();
+    libcellml::VariablePtr v2 = libcellml::Variable::create();
+    libcellml::VariablePtr v3 = libcellml::Variable::create();
+
+    libcellml::Variable::addEquivalence(v1, v2);
+    libcellml::Variable::addEquivalence(v1, v3);
+
+    EXPECT_EQ(size_t(2), v1->equivalentVariableCount());
+
+    v2 = nullptr;
+
+    EXPECT_EQ(size_t(1), v1->equivalentVariableCount());
+    EXPECT_EQ(v3, v1->equivalentVariable(0));
+    EXPECT_EQ(nullptr, v1->equivalentVariable(1));
+}
+
 TEST(Variable, hasIndirectEquivalentVariable)
 {
     libcellml::VariablePtr v1 = libcellml::Variable::create();